@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_PERFTEST_ALGORITHMS_HPP
+#define KOKKOS_ALGORITHMS_PERFTEST_ALGORITHMS_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "Benchmark_Context.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+// The algorithms benchmarks are registered once for every enabled host
+// execution space: ARGS is a function configuring the arguments of the
+// benchmark and the trailing arguments are the remaining template arguments
+// of FUNC, after the execution space.
+#ifdef KOKKOS_ENABLE_SERIAL
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_SERIAL(FUNC, ARGS, ...) \
+  BENCHMARK_TEMPLATE(FUNC, Kokkos::Serial, __VA_ARGS__)->Apply(ARGS);
+#else
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_SERIAL(FUNC, ARGS, ...)
+#endif
+
+#ifdef KOKKOS_ENABLE_OPENMP
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_OPENMP(FUNC, ARGS, ...) \
+  BENCHMARK_TEMPLATE(FUNC, Kokkos::OpenMP, __VA_ARGS__)->Apply(ARGS);
+#else
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_OPENMP(FUNC, ARGS, ...)
+#endif
+
+#ifdef KOKKOS_ENABLE_THREADS
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_THREADS(FUNC, ARGS, ...) \
+  BENCHMARK_TEMPLATE(FUNC, Kokkos::Threads, __VA_ARGS__)->Apply(ARGS);
+#else
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_THREADS(FUNC, ARGS, ...)
+#endif
+
+#ifdef KOKKOS_ENABLE_HPX
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_HPX(FUNC, ARGS, ...)             \
+  BENCHMARK_TEMPLATE(FUNC, Kokkos::Experimental::HPX, __VA_ARGS__)->Apply( \
+      ARGS);
+#else
+#define KOKKOS_IMPL_ALGORITHMS_BENCHMARK_HPX(FUNC, ARGS, ...)
+#endif
+
+#define KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, ARGS, ...)           \
+  KOKKOS_IMPL_ALGORITHMS_BENCHMARK_SERIAL(FUNC, ARGS, __VA_ARGS__)  \
+  KOKKOS_IMPL_ALGORITHMS_BENCHMARK_OPENMP(FUNC, ARGS, __VA_ARGS__)  \
+  KOKKOS_IMPL_ALGORITHMS_BENCHMARK_THREADS(FUNC, ARGS, __VA_ARGS__) \
+  KOKKOS_IMPL_ALGORITHMS_BENCHMARK_HPX(FUNC, ARGS, __VA_ARGS__)
+
+namespace Test {
+
+// number of elements from 2^10 to 2^22, in steps of 16x
+inline void algorithms_benchmark_sizes(benchmark::internal::Benchmark* b) {
+  b->ArgName("N")->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+  b->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+/**
+ * \brief Report the time of one iteration along with the throughput in
+ * elements per second and the bandwidth for an algorithm processing
+ * num_elements elements and moving bytes_per_element bytes per element
+ */
+inline void report_algorithm_results(benchmark::State& state,
+                                     std::size_t num_elements,
+                                     std::size_t bytes_per_element,
+                                     double time) {
+  state.SetIterationTime(time);
+  state.counters["Melements/s"] =
+      benchmark::Counter(num_elements / 1'000'000.,
+                         benchmark::Counter::kIsIterationInvariantRate);
+  state.counters[KokkosBenchmark::benchmark_fom("GB/s")] = benchmark::Counter(
+      num_elements * bytes_per_element / 1'000'000'000.,
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// upper bound of the random values used by the benchmarks: the integral
+// values span the non-negative range of their type and the floating point
+// ones [0, 1)
+template <class ValueType>
+KOKKOS_INLINE_FUNCTION constexpr ValueType random_values_range() {
+  if constexpr (std::is_integral_v<ValueType>) {
+    return Kokkos::Experimental::finite_max_v<ValueType>;
+  } else {
+    return ValueType(1);
+  }
+}
+
+/**
+ * \brief Fill view with values uniformly distributed in
+ * [0, random_values_range())
+ */
+template <class ExecutionSpace, class ViewType>
+void fill_random_values(const ExecutionSpace& exec, const ViewType& view) {
+  using value_type = typename ViewType::non_const_value_type;
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> pool(5374857);
+  Kokkos::fill_random(exec, view, pool, random_values_range<value_type>());
+  exec.fence();
+}
+
+}  // namespace Test
+
+#endif
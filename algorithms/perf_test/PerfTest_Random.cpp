@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include "PerfTest_Algorithms.hpp"
+
+namespace Test {
+
+// fill_random draws many numbers from each state it acquires, this measures
+// the throughput of the generator itself
+template <class ExecutionSpace, template <class> class PoolType,
+          class ValueType>
+static void FillRandom(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  PoolType<ExecutionSpace> pool(5374857);
+  Kokkos::View<ValueType*, ExecutionSpace> values(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), n);
+
+  for (auto _ : state) {
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::fill_random(exec, values, pool, random_values_range<ValueType>());
+    exec.fence();
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+// every index acquires a state for a single number, this measures the cost
+// of get_state and free_state
+template <class ExecutionSpace, template <class> class PoolType,
+          class ValueType>
+static void RandomStatePerElement(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  PoolType<ExecutionSpace> pool(5374857);
+  Kokkos::View<ValueType*, ExecutionSpace> values(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "values"), n);
+
+  for (auto _ : state) {
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::parallel_for(
+        "Test::RandomStatePerElement",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          auto generator = pool.get_state();
+          values(i) = Kokkos::rand<decltype(generator), ValueType>::draw(
+              generator, random_values_range<ValueType>());
+          pool.free_state(generator);
+        });
+    exec.fence();
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+#define KOKKOS_RANDOM_BENCHMARK(FUNC, POOL)                                \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, POOL, \
+                                   std::uint64_t)                          \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, POOL, \
+                                   double)
+
+KOKKOS_RANDOM_BENCHMARK(FillRandom, Kokkos::Random_XorShift64_Pool)
+KOKKOS_RANDOM_BENCHMARK(FillRandom, Kokkos::Random_XorShift1024_Pool)
+KOKKOS_RANDOM_BENCHMARK(RandomStatePerElement, Kokkos::Random_XorShift64_Pool)
+KOKKOS_RANDOM_BENCHMARK(RandomStatePerElement,
+                        Kokkos::Random_XorShift1024_Pool)
+
+#undef KOKKOS_RANDOM_BENCHMARK
+
+}  // namespace Test
@@ -0,0 +1,186 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include "PerfTest_Algorithms.hpp"
+
+#include <Kokkos_Sort.hpp>
+#include <Kokkos_NestedSort.hpp>
+
+namespace Test {
+
+// The bandwidth of the sorting benchmarks counts a single read and write of
+// the keys (and values), the effective bandwidth makes sizes and key types
+// comparable even though the sorts move the data more than once.
+
+template <class ExecutionSpace, class KeyType>
+auto make_random_keys(const ExecutionSpace& exec, std::size_t n) {
+  Kokkos::View<KeyType*, ExecutionSpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys_init"), n);
+  fill_random_values(exec, keys);
+  return keys;
+}
+
+template <class KeyType>
+struct GreaterThan {
+  KOKKOS_FUNCTION bool operator()(const KeyType& a, const KeyType& b) const {
+    return a > b;
+  }
+};
+
+template <class ExecutionSpace, class KeyType>
+static void Sort(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  auto keys_init = make_random_keys<ExecutionSpace, KeyType>(exec, n);
+  Kokkos::View<KeyType*, ExecutionSpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), n);
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(exec, keys, keys_init);
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::sort(exec, keys);
+    exec.fence();
+    report_algorithm_results(state, n, 2 * sizeof(KeyType), timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class KeyType>
+static void SortWithComparator(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  auto keys_init = make_random_keys<ExecutionSpace, KeyType>(exec, n);
+  Kokkos::View<KeyType*, ExecutionSpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), n);
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(exec, keys, keys_init);
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::sort(exec, keys, GreaterThan<KeyType>());
+    exec.fence();
+    report_algorithm_results(state, n, 2 * sizeof(KeyType), timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class KeyType>
+static void SortByKey(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  auto keys_init = make_random_keys<ExecutionSpace, KeyType>(exec, n);
+  Kokkos::View<KeyType*, ExecutionSpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), n);
+  // the permutation does not depend on the values, they are not reset
+  Kokkos::View<int*, ExecutionSpace> values(Kokkos::view_alloc(exec, "values"),
+                                            n);
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(exec, keys, keys_init);
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::Experimental::sort_by_key(exec, keys, values);
+    exec.fence();
+    report_algorithm_results(state, n, 2 * (sizeof(KeyType) + sizeof(int)),
+                             timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class KeyType>
+static void BinSort(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  using keys_view_type = Kokkos::View<KeyType*, ExecutionSpace>;
+  using bin_op_type    = Kokkos::BinOp1D<keys_view_type>;
+
+  auto keys_init = make_random_keys<ExecutionSpace, KeyType>(exec, n);
+  keys_view_type keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), n);
+
+  // same range as the random keys and, like Kokkos::sort, about
+  // two keys per bin
+  const bin_op_type bin_op(n / 2, KeyType(0), random_values_range<KeyType>());
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(exec, keys, keys_init);
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::BinSort<keys_view_type, bin_op_type> bin_sort(exec, keys, bin_op,
+                                                          true);
+    bin_sort.create_permute_vector(exec);
+    bin_sort.sort(exec, keys);
+    exec.fence();
+    report_algorithm_results(state, n, 2 * sizeof(KeyType), timer.seconds());
+  }
+}
+
+// every team sorts one row of a matrix of keys
+template <class ExecutionSpace, class KeyType>
+static void NestedSortTeam(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+
+  constexpr std::size_t row_length = 256;
+  const std::size_t num_rows       = (n + row_length - 1) / row_length;
+
+  using keys_view_type = Kokkos::View<KeyType**, ExecutionSpace>;
+  keys_view_type keys_init(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys_init"),
+      num_rows, row_length);
+  fill_random_values(exec, keys_init);
+  keys_view_type keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), num_rows,
+      row_length);
+
+  using team_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+  using member_type = typename team_policy::member_type;
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(exec, keys, keys_init);
+    exec.fence();
+    Kokkos::Timer timer;
+    Kokkos::parallel_for(
+        "Test::NestedSortTeam", team_policy(exec, num_rows, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const member_type& t) {
+          Kokkos::Experimental::sort_team(
+              t, Kokkos::subview(keys, t.league_rank(), Kokkos::ALL));
+        });
+    exec.fence();
+    report_algorithm_results(state, num_rows * row_length, 2 * sizeof(KeyType),
+                             timer.seconds());
+  }
+}
+
+#define KOKKOS_SORTING_BENCHMARK(FUNC)                                    \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, int) \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes,      \
+                                   std::int64_t)                          \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes,      \
+                                   float)                                 \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, double)
+
+KOKKOS_SORTING_BENCHMARK(Sort)
+KOKKOS_SORTING_BENCHMARK(SortWithComparator)
+KOKKOS_SORTING_BENCHMARK(SortByKey)
+KOKKOS_SORTING_BENCHMARK(BinSort)
+KOKKOS_SORTING_BENCHMARK(NestedSortTeam)
+
+#undef KOKKOS_SORTING_BENCHMARK
+
+}  // namespace Test
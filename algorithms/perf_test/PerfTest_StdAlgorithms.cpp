@@ -0,0 +1,263 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include "PerfTest_Algorithms.hpp"
+
+#include <Kokkos_StdAlgorithms.hpp>
+
+namespace Test {
+
+namespace KE = Kokkos::Experimental;
+
+// The bandwidth of the std algorithms benchmarks counts the bytes of the
+// input read once and of the output written once.
+
+template <class ValueType>
+struct IsBelowHalfRange {
+  KOKKOS_FUNCTION bool operator()(const ValueType& a) const {
+    return a < random_values_range<ValueType>() / 2;
+  }
+};
+
+template <class ValueType>
+struct IsNegative {
+  KOKKOS_FUNCTION bool operator()(const ValueType& a) const {
+    return a < ValueType(0);
+  }
+};
+
+template <class ValueType>
+struct AffineTransform {
+  KOKKOS_FUNCTION ValueType operator()(const ValueType& a) const {
+    return ValueType(3) * a + ValueType(1);
+  }
+};
+
+// 256 bins evenly spread over the range of the random values
+template <class ValueType>
+struct EvenBins {
+  static constexpr int num_bins = 256;
+
+  KOKKOS_FUNCTION int operator()(const ValueType& a) const {
+    const int b =
+        static_cast<double>(a) / random_values_range<ValueType>() * num_bins;
+    return b < num_bins ? b : num_bins - 1;
+  }
+};
+
+template <class ExecutionSpace, class ValueType>
+struct StdAlgorithmsData {
+  using view_type = Kokkos::View<ValueType*, ExecutionSpace>;
+
+  view_type source;
+  view_type dest;
+
+  StdAlgorithmsData(const ExecutionSpace& exec, std::size_t n)
+      : source(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "source"),
+               n),
+        dest(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "dest"),
+             n) {
+    fill_random_values(exec, source);
+  }
+};
+
+template <class ExecutionSpace, class ValueType>
+static void StdCopy(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::copy(exec, data.source, data.dest);
+    report_algorithm_results(state, n, 2 * sizeof(ValueType),
+                             timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdTransform(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::transform(exec, data.source, data.dest, AffineTransform<ValueType>());
+    report_algorithm_results(state, n, 2 * sizeof(ValueType),
+                             timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdReduce(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    benchmark::DoNotOptimize(KE::reduce(exec, data.source));
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdInclusiveScan(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::inclusive_scan(exec, data.source, data.dest);
+    report_algorithm_results(state, n, 2 * sizeof(ValueType),
+                             timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdExclusiveScan(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::exclusive_scan(exec, data.source, data.dest, ValueType(0));
+    report_algorithm_results(state, n, 2 * sizeof(ValueType),
+                             timer.seconds());
+  }
+}
+
+// about half of the elements are copied
+template <class ExecutionSpace, class ValueType>
+static void StdCopyIf(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::copy_if(exec, data.source, data.dest, IsBelowHalfRange<ValueType>());
+    report_algorithm_results(state, n, 3 * sizeof(ValueType) / 2,
+                             timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdCountIf(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    benchmark::DoNotOptimize(
+        KE::count_if(exec, data.source, IsBelowHalfRange<ValueType>()));
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdMinElement(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    benchmark::DoNotOptimize(KE::min_element(exec, data.source));
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+// no element matches, the whole range is searched
+template <class ExecutionSpace, class ValueType>
+static void StdFindIf(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    benchmark::DoNotOptimize(
+        KE::find_if(exec, data.source, IsNegative<ValueType>()));
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+template <class ExecutionSpace, class ValueType>
+static void StdHistogram(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+  Kokkos::View<int*, ExecutionSpace> counts("counts",
+                                            EvenBins<ValueType>::num_bins);
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::histogram(exec, KE::cbegin(data.source), KE::cend(data.source),
+                  counts, EvenBins<ValueType>());
+    report_algorithm_results(state, n, sizeof(ValueType), timer.seconds());
+  }
+}
+
+// segments of 16 equal keys
+template <class ExecutionSpace, class ValueType>
+static void StdReduceByKey(benchmark::State& state) {
+  const std::size_t n = state.range(0);
+  ExecutionSpace exec;
+  StdAlgorithmsData<ExecutionSpace, ValueType> data(exec, n);
+
+  constexpr int segment_length = 16;
+  Kokkos::View<int*, ExecutionSpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys"), n);
+  Kokkos::View<int*, ExecutionSpace> keys_dest(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys_dest"), n);
+  Kokkos::parallel_for(
+      "Test::StdReduceByKey::keys",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) { keys(i) = i / segment_length; });
+  exec.fence();
+
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    KE::reduce_by_key(exec, keys, data.source, keys_dest, data.dest);
+    report_algorithm_results(state, n, sizeof(int) + sizeof(ValueType),
+                             timer.seconds());
+  }
+}
+
+#define KOKKOS_STD_ALGORITHMS_BENCHMARK(FUNC)                             \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, int) \
+  KOKKOS_ALGORITHMS_HOST_BENCHMARK(FUNC, algorithms_benchmark_sizes, double)
+
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdCopy)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdTransform)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdReduce)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdInclusiveScan)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdExclusiveScan)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdCopyIf)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdCountIf)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdMinElement)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdFindIf)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdHistogram)
+KOKKOS_STD_ALGORITHMS_BENCHMARK(StdReduceByKey)
+
+#undef KOKKOS_STD_ALGORITHMS_BENCHMARK
+
+}  // namespace Test
@@ -423,6 +423,22 @@ struct rand<Generator, unsigned long long> {
   }
 };
 
+#if (defined(KOKKOS_HALF_T_IS_FLOAT) && !KOKKOS_HALF_T_IS_FLOAT) || \
+    (defined(KOKKOS_BHALF_T_IS_FLOAT) && !KOKKOS_BHALF_T_IS_FLOAT)
+namespace Impl {
+// largest value of the 16-bit floating point type HalfType below val
+template <class HalfType>
+KOKKOS_INLINE_FUNCTION HalfType half_precision_prev(const HalfType& val) {
+  using bit_type = typename HalfType::bit_comparison_type;
+  const unsigned bits = Kokkos::bit_cast<std::uint16_t>(
+      static_cast<typename HalfType::impl_type>(val));
+  if ((bits & 0x7fffu) == 0) return HalfType(bit_type{0x8001u});
+  const unsigned prev = bits & 0x8000u ? bits + 1 : bits - 1;
+  return HalfType(bit_type{static_cast<std::uint16_t>(prev)});
+}
+}  // namespace Impl
+#endif
+
 #if defined(KOKKOS_HALF_T_IS_FLOAT) && !KOKKOS_HALF_T_IS_FLOAT
 template <class Generator>
 struct rand<Generator, Kokkos::Experimental::half_t> {
@@ -430,14 +446,16 @@ struct rand<Generator, Kokkos::Experimental::half_t> {
   KOKKOS_INLINE_FUNCTION
   static half max() { return half(1.0); }
   KOKKOS_INLINE_FUNCTION
-  static half draw(Generator& gen) { return half(gen.frand()); }
+  static half draw(Generator& gen) { return draw(gen, half(0.0), max()); }
   KOKKOS_INLINE_FUNCTION
   static half draw(Generator& gen, const half& range) {
-    return half(gen.frand(float(range)));
+    return draw(gen, half(0.0), range);
   }
   KOKKOS_INLINE_FUNCTION
   static half draw(Generator& gen, const half& start, const half& end) {
-    return half(gen.frand(float(start), float(end)));
+    // rounding the float draw can reach end, which is exclusive
+    const half val(gen.frand(float(start), float(end)));
+    return val < end || !(start < end) ? val : Impl::half_precision_prev(end);
   }
 };
 #endif  // defined(KOKKOS_HALF_T_IS_FLOAT) && !KOKKOS_HALF_T_IS_FLOAT
@@ -449,14 +467,16 @@ struct rand<Generator, Kokkos::Experimental::bhalf_t> {
   KOKKOS_INLINE_FUNCTION
   static bhalf max() { return bhalf(1.0); }
   KOKKOS_INLINE_FUNCTION
-  static bhalf draw(Generator& gen) { return bhalf(gen.frand()); }
+  static bhalf draw(Generator& gen) { return draw(gen, bhalf(0.0), max()); }
   KOKKOS_INLINE_FUNCTION
   static bhalf draw(Generator& gen, const bhalf& range) {
-    return bhalf(gen.frand(float(range)));
+    return draw(gen, bhalf(0.0), range);
   }
   KOKKOS_INLINE_FUNCTION
   static bhalf draw(Generator& gen, const bhalf& start, const bhalf& end) {
-    return bhalf(gen.frand(float(start), float(end)));
+    // rounding the float draw can reach end, which is exclusive
+    const bhalf val(gen.frand(float(start), float(end)));
+    return val < end || !(start < end) ? val : Impl::half_precision_prev(end);
   }
 };
 #endif  // defined(KOKKOS_BHALF_T_IS_FLOAT) && !KOKKOS_BHALF_T_IS_FLOAT
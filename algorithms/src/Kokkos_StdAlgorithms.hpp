@@ -90,6 +90,19 @@
 // sorting
 #include "std_algorithms/Kokkos_IsSortedUntil.hpp"
 #include "std_algorithms/Kokkos_IsSorted.hpp"
+#include "std_algorithms/Kokkos_NthElement.hpp"
+#include "std_algorithms/Kokkos_PartialSort.hpp"
+
+// binary search (on sorted ranges)
+#include "std_algorithms/Kokkos_LowerBound.hpp"
+#include "std_algorithms/Kokkos_UpperBound.hpp"
+
+// merge and set operations (on sorted ranges)
+#include "std_algorithms/Kokkos_Merge.hpp"
+#include "std_algorithms/Kokkos_InplaceMerge.hpp"
+#include "std_algorithms/Kokkos_SetUnion.hpp"
+#include "std_algorithms/Kokkos_SetIntersection.hpp"
+#include "std_algorithms/Kokkos_SetDifference.hpp"
 
 // min/max element
 #include "std_algorithms/Kokkos_MinElement.hpp"
@@ -98,6 +111,8 @@
 
 // partitioning
 #include "std_algorithms/Kokkos_IsPartitioned.hpp"
+#include "std_algorithms/Kokkos_Partition.hpp"
+#include "std_algorithms/Kokkos_StablePartition.hpp"
 #include "std_algorithms/Kokkos_PartitionCopy.hpp"
 #include "std_algorithms/Kokkos_PartitionPoint.hpp"
 
@@ -109,6 +124,10 @@
 #include "std_algorithms/Kokkos_TransformExclusiveScan.hpp"
 #include "std_algorithms/Kokkos_InclusiveScan.hpp"
 #include "std_algorithms/Kokkos_TransformInclusiveScan.hpp"
+#include "std_algorithms/Kokkos_ReduceByKey.hpp"
+#include "std_algorithms/Kokkos_InclusiveScanByKey.hpp"
+#include "std_algorithms/Kokkos_ExclusiveScanByKey.hpp"
+#include "std_algorithms/Kokkos_Histogram.hpp"
 
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_STD_ALGORITHMS
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE
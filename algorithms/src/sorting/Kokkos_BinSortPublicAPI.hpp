@@ -20,6 +20,7 @@
 #include "Kokkos_BinOpsPublicAPI.hpp"
 #include "impl/Kokkos_CopyOpsForBinSortImpl.hpp"
 #include <Kokkos_Core.hpp>
+#include <std_algorithms/impl/Kokkos_Histogram.hpp>
 #include <algorithm>
 
 namespace Kokkos {
@@ -97,7 +98,6 @@ class BinSort {
   using exec_space  = typename Space::execution_space;
   using bin_op_type = BinSortOp;
 
-  struct bin_count_tag {};
   struct bin_offset_tag {};
   struct bin_binning_tag {};
   struct bin_sort_bins_tag {};
@@ -132,6 +132,18 @@ class BinSort {
   const_key_view_type keys;
   const_rnd_key_view_type keys_rnd;
 
+  // maps the i-th key of the sorted range to its bin
+  struct bin_of_key {
+    const_key_view_type keys;
+    BinSortOp bin_op;
+    int range_begin;
+
+    KOKKOS_INLINE_FUNCTION
+    int operator()(const int i) const {
+      return bin_op.bin(keys, range_begin + i);
+    }
+  };
+
  public:
   BinSortOp bin_op;
   offset_type bin_offsets;
@@ -213,11 +225,13 @@ class BinSort {
         "The provided execution space must be able to access the memory space "
         "BinSort was initialized with!");
 
+    // the counts go through privatized bins rather than one atomic
+    // increment of the shared count array per key
     const size_t len = range_end - range_begin;
-    Kokkos::parallel_for(
-        "Kokkos::Sort::BinCount",
-        Kokkos::RangePolicy<ExecutionSpace, bin_count_tag>(exec, 0, len),
-        *this);
+    Kokkos::Experimental::Impl::histogram_impl(
+        "Kokkos::Sort::BinCount", exec, len,
+        Kokkos::View<int*, Space>(bin_count_atomic),
+        bin_of_key{keys, bin_op, range_begin});
     Kokkos::parallel_scan("Kokkos::Sort::BinOffset",
                           Kokkos::RangePolicy<ExecutionSpace, bin_offset_tag>(
                               exec, 0, bin_op.max_bins()),
@@ -352,12 +366,6 @@ class BinSort {
   bin_count_type get_bin_count() const { return bin_count_const; }
 
  public:
-  KOKKOS_INLINE_FUNCTION
-  void operator()(const bin_count_tag& /*tag*/, const int i) const {
-    const int j = range_begin + i;
-    bin_count_atomic(bin_op.bin(keys, j))++;
-  }
-
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_offset_tag& /*tag*/, const int i,
                   value_type& offset, const bool& final) const {
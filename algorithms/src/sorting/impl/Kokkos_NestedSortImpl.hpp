@@ -38,6 +38,14 @@ struct NestedRange<true> {
   KOKKOS_FUNCTION static void barrier(const TeamMember& t) {
     t.team_barrier();
   }
+  // Number of workers that execute a range concurrently, or 0 if the range is
+  // spread over enough hardware lanes that the full sorting network is cheaper
+  // than sorting blocks sequentially.
+  template <typename TeamMember>
+  KOKKOS_FUNCTION static int concurrency([[maybe_unused]] const TeamMember& t) {
+    KOKKOS_IF_ON_HOST((return t.team_size();))
+    KOKKOS_IF_ON_DEVICE((return 0;))
+  }
 };
 
 // Specialization for thread-level
@@ -51,10 +59,145 @@ struct NestedRange<false> {
   // after parallel region
   template <typename TeamMember>
   KOKKOS_FUNCTION static void barrier(const TeamMember&) {}
+  // Vector ranges are executed sequentially on host backends
+  template <typename TeamMember>
+  KOKKOS_FUNCTION static int concurrency(const TeamMember&) {
+    KOKKOS_IF_ON_HOST((return 1;))
+    KOKKOS_IF_ON_DEVICE((return 0;))
+  }
 };
 
+template <class KeyViewType, class ValueViewType, class SizeType>
+KOKKOS_INLINE_FUNCTION void sort_nested_swap(
+    const KeyViewType& keyView, [[maybe_unused]] const ValueViewType& valueView,
+    SizeType i, SizeType j) {
+  Kokkos::kokkos_swap(keyView(i), keyView(j));
+  if constexpr (!std::is_same_v<ValueViewType, std::nullptr_t>) {
+    Kokkos::kokkos_swap(valueView(i), valueView(j));
+  }
+}
+
+template <class KeyViewType, class ValueViewType, class Comparator,
+          class SizeType>
+KOKKOS_INLINE_FUNCTION void sort_nested_heapsort(
+    const KeyViewType& keyView, const ValueViewType& valueView,
+    const Comparator& comp, SizeType begin, SizeType end) {
+  SizeType const n = end - begin;
+  auto sift_down   = [&](SizeType root, SizeType len) {
+    while (2 * root + 1 < len) {
+      SizeType child = 2 * root + 1;
+      if (child + 1 < len &&
+          comp(keyView(begin + child), keyView(begin + child + 1)))
+        ++child;
+      if (!comp(keyView(begin + root), keyView(begin + child))) return;
+      sort_nested_swap(keyView, valueView, begin + root, begin + child);
+      root = child;
+    }
+  };
+  for (SizeType i = n / 2; i > 0; --i) sift_down(i - 1, n);
+  for (SizeType len = n; len > 1; --len) {
+    sort_nested_swap(keyView, valueView, begin, begin + len - 1);
+    sift_down(SizeType(0), len - 1);
+  }
+}
+
+// Sequential introsort of [begin, end): quicksort with median-of-three
+// pivoting, heapsort once the recursion gets too deep and insertion sort for
+// short ranges. Recursion is replaced by an explicit stack that always defers
+// the larger partition so that its depth stays logarithmic.
+template <class KeyViewType, class ValueViewType, class Comparator,
+          class SizeType>
+KOKKOS_INLINE_FUNCTION void sort_nested_sequential(
+    const KeyViewType& keyView, const ValueViewType& valueView,
+    Comparator comp, SizeType begin, SizeType end) {
+  using KeyType = typename KeyViewType::non_const_value_type;
+
+  constexpr SizeType insertion_max = 16;
+  constexpr int stack_max          = 64;
+  struct Segment {
+    SizeType lo;
+    SizeType hi;
+    int depth;
+  };
+  Segment stack[stack_max];
+  int top = 0;
+  if (end - begin > 1) {
+    stack[top++] = {begin, end,
+                    2 * static_cast<int>(Kokkos::bit_width(end - begin))};
+  }
+  while (top > 0) {
+    --top;
+    SizeType lo = stack[top].lo;
+    SizeType hi = stack[top].hi;
+    int depth   = stack[top].depth;
+    while (hi - lo > insertion_max) {
+      if (depth == 0) {
+        sort_nested_heapsort(keyView, valueView, comp, lo, hi);
+        lo = hi;
+        break;
+      }
+      --depth;
+      SizeType const mid = lo + (hi - lo) / 2;
+      if (comp(keyView(mid), keyView(lo)))
+        sort_nested_swap(keyView, valueView, lo, mid);
+      if (comp(keyView(hi - 1), keyView(mid))) {
+        sort_nested_swap(keyView, valueView, mid, hi - 1);
+        if (comp(keyView(mid), keyView(lo)))
+          sort_nested_swap(keyView, valueView, lo, mid);
+      }
+      KeyType const pivot = keyView(mid);
+      // Hoare partition into [lo, j] and [j + 1, hi)
+      SizeType i = lo;
+      SizeType j = hi - 1;
+      while (true) {
+        while (comp(keyView(i), pivot)) ++i;
+        while (comp(pivot, keyView(j))) --j;
+        if (i >= j) break;
+        sort_nested_swap(keyView, valueView, i, j);
+        ++i;
+        --j;
+      }
+      if (j + 1 - lo < hi - j - 1) {
+        stack[top++] = {j + 1, hi, depth};
+        hi           = j + 1;
+      } else {
+        stack[top++] = {lo, j + 1, depth};
+        lo           = j + 1;
+      }
+    }
+    for (SizeType k = lo + 1; k < hi; ++k) {
+      KeyType const key = keyView(k);
+      SizeType l        = k;
+      if constexpr (std::is_same_v<ValueViewType, std::nullptr_t>) {
+        for (; l > lo && comp(key, keyView(l - 1)); --l) {
+          keyView(l) = keyView(l - 1);
+        }
+      } else {
+        typename ValueViewType::non_const_value_type const value =
+            valueView(k);
+        for (; l > lo && comp(key, keyView(l - 1)); --l) {
+          keyView(l)   = keyView(l - 1);
+          valueView(l) = valueView(l - 1);
+        }
+        valueView(l) = value;
+      }
+      keyView(l) = key;
+    }
+  }
+}
+
 // When just doing sort (not sort_by_key), use nullptr_t for ValueViewType.
 // This only takes the NestedRange instance for template arg deduction.
+//
+// The keys are padded to the next power of two npot and split into blocks of
+// npot / blocks elements, with one block per worker of the range. Each block
+// is first sorted sequentially, then the blocks are merged with the bitonic
+// network: the phases comparing elements of different blocks are executed in
+// parallel over all pairs, while the phases that stay within a block are run
+// sequentially by the worker owning that block. This saves the barriers and
+// the log^2 work of the intra-block phases when there are fewer workers than
+// elements, i.e. on host backends. On devices every pair gets its own lane and
+// the full network is used.
 template <class TeamMember, class KeyViewType, class ValueViewType,
           class Comparator, bool useTeamLevel>
 KOKKOS_INLINE_FUNCTION void sort_nested_impl(
@@ -65,41 +208,75 @@ KOKKOS_INLINE_FUNCTION void sort_nested_impl(
   using KeyType   = typename KeyViewType::non_const_value_type;
   using Range     = NestedRange<useTeamLevel>;
   SizeType n      = keyView.extent(0);
-  SizeType npot   = 1;
-  SizeType levels = 0;
-  // FIXME: ceiling power-of-two is a common thing to need - make it a utility
-  while (npot < n) {
-    levels++;
-    npot <<= 1;
+  SizeType npot   = Kokkos::bit_ceil(n);
+  SizeType levels = Kokkos::countr_zero(npot);
+
+  // one block per worker, or one element per block for the full network
+  int const concurrency = Range::concurrency(t);
+  SizeType blocks       = npot;
+  if (concurrency > 0) {
+    blocks = Kokkos::min(
+        npot, Kokkos::bit_floor(static_cast<SizeType>(concurrency)));
   }
-  for (SizeType i = 0; i < levels; i++) {
-    for (SizeType j = 0; j <= i; j++) {
+  SizeType const blockSize   = npot / blocks;
+  SizeType const blockLevels = Kokkos::countr_zero(blockSize);
+
+  // Compare-exchange of the k-th pair in phase j of level i
+  auto compare_exchange = [=](SizeType i, SizeType j, SizeType k) {
+    // How big are the brown/pink boxes?
+    // (Terminology comes from Wikipedia diagram)
+    // https://commons.wikimedia.org/wiki/File:BitonicSort.svg#/media/File:BitonicSort.svg
+    SizeType boxSize = SizeType(2) << (i - j);
+    // Which box contains this thread?
+    SizeType boxID     = k >> (i - j);          // k * 2 / boxSize;
+    SizeType boxStart  = boxID << (1 + i - j);  // boxID * boxSize
+    SizeType boxOffset = k - (boxStart >> 1);   // k - boxID * boxSize / 2;
+    SizeType elem1     = boxStart + boxOffset;
+    // In first phase (j == 0, brown box): within a box, compare with the
+    // opposite value in the box.
+    // In later phases (j > 0, pink box): within a box, compare with fixed
+    // distance (boxSize / 2) apart.
+    SizeType elem2 = (j == 0) ? (boxStart + boxSize - 1 - boxOffset)
+                              : (elem1 + boxSize / 2);
+    if (elem2 < n) {
+      KeyType key1 = keyView(elem1);
+      KeyType key2 = keyView(elem2);
+      if (comp(key2, key1)) {
+        keyView(elem1) = key2;
+        keyView(elem2) = key1;
+        if constexpr (!std::is_same_v<ValueViewType, std::nullptr_t>) {
+          Kokkos::kokkos_swap(valueView(elem1), valueView(elem2));
+        }
+      }
+    }
+  };
+
+  if (blockLevels > 0) {
+    Kokkos::parallel_for(Range::create(t, blocks), [=](const SizeType b) {
+      SizeType const begin = b * blockSize;
+      SizeType const end   = Kokkos::min(begin + blockSize, n);
+      if (begin < end) {
+        sort_nested_sequential(keyView, valueView, comp, begin, end);
+      }
+    });
+    Range::barrier(t);
+  }
+  for (SizeType i = blockLevels; i < levels; i++) {
+    // phases comparing elements at least one block apart
+    for (SizeType j = 0; j + blockLevels <= i; j++) {
       // n/2 pairs of items are compared in parallel
       Kokkos::parallel_for(Range::create(t, npot / 2), [=](const SizeType k) {
-        // How big are the brown/pink boxes?
-        // (Terminology comes from Wikipedia diagram)
-        // https://commons.wikimedia.org/wiki/File:BitonicSort.svg#/media/File:BitonicSort.svg
-        SizeType boxSize = SizeType(2) << (i - j);
-        // Which box contains this thread?
-        SizeType boxID     = k >> (i - j);          // k * 2 / boxSize;
-        SizeType boxStart  = boxID << (1 + i - j);  // boxID * boxSize
-        SizeType boxOffset = k - (boxStart >> 1);   // k - boxID * boxSize / 2;
-        SizeType elem1     = boxStart + boxOffset;
-        // In first phase (j == 0, brown box): within a box, compare with the
-        // opposite value in the box.
-        // In later phases (j > 0, pink box): within a box, compare with fixed
-        // distance (boxSize / 2) apart.
-        SizeType elem2 = (j == 0) ? (boxStart + boxSize - 1 - boxOffset)
-                                  : (elem1 + boxSize / 2);
-        if (elem2 < n) {
-          KeyType key1 = keyView(elem1);
-          KeyType key2 = keyView(elem2);
-          if (comp(key2, key1)) {
-            keyView(elem1) = key2;
-            keyView(elem2) = key1;
-            if constexpr (!std::is_same_v<ValueViewType, std::nullptr_t>) {
-              Kokkos::kokkos_swap(valueView(elem1), valueView(elem2));
-            }
+        compare_exchange(i, j, k);
+      });
+      Range::barrier(t);
+    }
+    // remaining phases of the level stay within a block
+    if (blockLevels > 0) {
+      Kokkos::parallel_for(Range::create(t, blocks), [=](const SizeType b) {
+        for (SizeType j = i + 1 - blockLevels; j <= i; j++) {
+          for (SizeType k = b * blockSize / 2; k < (b + 1) * blockSize / 2;
+               k++) {
+            compare_exchange(i, j, k);
           }
         }
       });
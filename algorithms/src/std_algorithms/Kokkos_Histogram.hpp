@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_HISTOGRAM_HPP
+#define KOKKOS_STD_ALGORITHMS_HISTOGRAM_HPP
+
+#include "impl/Kokkos_Histogram.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+// Counts the elements of a range per bin: bin_op maps an element to
+// its bin in [0, counts.extent(0)), and counts is overwritten with the
+// number of elements of each bin.
+
+//
+// overload set accepting execution space
+//
+template <
+    typename ExecutionSpace, typename IteratorType, typename DataType,
+    typename... Properties, typename BinOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void histogram(const ExecutionSpace& ex, IteratorType first, IteratorType last,
+               const ::Kokkos::View<DataType, Properties...>& counts,
+               BinOpType bin_op) {
+  Impl::histogram_exespace_impl("Kokkos::histogram_iterator_api_default", ex,
+                                first, last, counts, std::move(bin_op));
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename DataType,
+    typename... Properties, typename BinOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void histogram(const std::string& label, const ExecutionSpace& ex,
+               IteratorType first, IteratorType last,
+               const ::Kokkos::View<DataType, Properties...>& counts,
+               BinOpType bin_op) {
+  Impl::histogram_exespace_impl(label, ex, first, last, counts,
+                                std::move(bin_op));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename BinOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void histogram(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view,
+               const ::Kokkos::View<DataType2, Properties2...>& counts,
+               BinOpType bin_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::histogram_exespace_impl("Kokkos::histogram_view_api_default", ex,
+                                cbegin(view), cend(view), counts,
+                                std::move(bin_op));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename BinOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void histogram(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view,
+               const ::Kokkos::View<DataType2, Properties2...>& counts,
+               BinOpType bin_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::histogram_exespace_impl(label, ex, cbegin(view), cend(view), counts,
+                                std::move(bin_op));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType, typename DataType,
+          typename... Properties, typename BinOpType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    const ::Kokkos::View<DataType, Properties...>& counts, BinOpType bin_op) {
+  Impl::histogram_team_impl(teamHandle, first, last, counts, std::move(bin_op));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename BinOpType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void histogram(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& counts, BinOpType bin_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::histogram_team_impl(teamHandle, cbegin(view), cend(view), counts,
+                            std::move(bin_op));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
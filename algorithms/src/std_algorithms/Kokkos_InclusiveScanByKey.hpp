@@ -0,0 +1,365 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_INCLUSIVE_SCAN_BY_KEY_HPP
+#define KOKKOS_STD_ALGORITHMS_INCLUSIVE_SCAN_BY_KEY_HPP
+
+#include "impl/Kokkos_ScanByKey.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+// Inclusive scan of the values that restarts at every run of
+// consecutive equal keys of [keys_first, keys_last).
+
+//
+// overload set accepting execution space
+//
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest);
+}
+
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const std::string& label,
+                                         const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest);
+}
+
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest,
+                                         BinaryPredicateType pred) {
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest, std::move(pred));
+}
+
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const std::string& label,
+                                         const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest,
+                                         BinaryPredicateType pred) {
+  return Impl::inclusive_scan_by_key_exespace_impl(label, ex, keys_first,
+                                                   keys_last, values_first,
+                                                   first_dest, std::move(pred));
+}
+
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType, typename BinaryOpType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest,
+                                         BinaryPredicateType pred,
+                                         BinaryOpType binary_op) {
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest, std::move(pred),
+      std::move(binary_op));
+}
+
+template <typename ExecutionSpace, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType, typename BinaryOpType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  ::Kokkos::is_execution_space_v<ExecutionSpace>,
+              int> = 0>
+OutputIteratorType inclusive_scan_by_key(const std::string& label,
+                                         const ExecutionSpace& ex,
+                                         KeysIteratorType keys_first,
+                                         KeysIteratorType keys_last,
+                                         ValuesIteratorType values_first,
+                                         OutputIteratorType first_dest,
+                                         BinaryPredicateType pred,
+                                         BinaryOpType binary_op) {
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest,
+      std::move(pred), std::move(binary_op));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_default", ex, cbegin(view_keys),
+      cend(view_keys), cbegin(view_values), begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      label, ex, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename BinaryPredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_default", ex, cbegin(view_keys),
+      cend(view_keys), cbegin(view_values), begin(view_dest), std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename BinaryPredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      label, ex, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest), std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename BinaryPredicateType,
+    typename BinaryOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_default", ex, cbegin(view_keys),
+      cend(view_keys), cbegin(view_values), begin(view_dest), std::move(pred),
+      std::move(binary_op));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename BinaryPredicateType,
+    typename BinaryOpType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_exespace_impl(
+      label, ex, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest), std::move(pred), std::move(binary_op));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  Kokkos::is_team_handle_v<TeamHandleType>,
+              int> = 0>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest);
+}
+
+template <typename TeamHandleType, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  Kokkos::is_team_handle_v<TeamHandleType>,
+              int> = 0>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, BinaryPredicateType pred) {
+  return Impl::inclusive_scan_by_key_team_impl(teamHandle, keys_first,
+                                               keys_last, values_first,
+                                               first_dest, std::move(pred));
+}
+
+template <typename TeamHandleType, typename KeysIteratorType,
+          typename ValuesIteratorType, typename OutputIteratorType,
+          typename BinaryPredicateType, typename BinaryOpType,
+          std::enable_if_t<
+              Impl::are_iterators_v<KeysIteratorType, ValuesIteratorType> &&
+                  Kokkos::is_team_handle_v<TeamHandleType>,
+              int> = 0>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, BinaryPredicateType pred,
+    BinaryOpType binary_op) {
+  return Impl::inclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest,
+      std::move(pred), std::move(binary_op));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto inclusive_scan_by_key(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_team_impl(
+      teamHandle, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3, typename BinaryPredicateType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto inclusive_scan_by_key(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_team_impl(
+      teamHandle, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest), std::move(pred));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3, typename BinaryPredicateType,
+          typename BinaryOpType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto inclusive_scan_by_key(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    BinaryPredicateType pred, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::inclusive_scan_by_key_team_impl(
+      teamHandle, cbegin(view_keys), cend(view_keys), cbegin(view_values),
+      begin(view_dest), std::move(pred), std::move(binary_op));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
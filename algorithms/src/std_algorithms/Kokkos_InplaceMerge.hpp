@@ -0,0 +1,166 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_INPLACE_MERGE_HPP
+#define KOKKOS_STD_ALGORITHMS_INPLACE_MERGE_HPP
+
+#include "impl/Kokkos_Merge.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <
+    typename ExecutionSpace, typename IteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const ExecutionSpace& ex, IteratorType first,
+                   IteratorType middle, IteratorType last) {
+  Impl::inplace_merge_exespace_impl(
+      "Kokkos::inplace_merge_iterator_api_default", ex, first, middle, last);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   IteratorType first, IteratorType middle, IteratorType last) {
+  Impl::inplace_merge_exespace_impl(label, ex, first, middle, last);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const ExecutionSpace& ex, IteratorType first,
+                   IteratorType middle, IteratorType last,
+                   ComparatorType comp) {
+  Impl::inplace_merge_exespace_impl(
+      "Kokkos::inplace_merge_iterator_api_default", ex, first, middle, last,
+      std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   IteratorType first, IteratorType middle, IteratorType last,
+                   ComparatorType comp) {
+  Impl::inplace_merge_exespace_impl(label, ex, first, middle, last,
+                                    std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_exespace_impl("Kokkos::inplace_merge_view_api_default",
+                                    ex, begin(view),
+                                    begin(view) + middle_location, end(view));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_exespace_impl(label, ex, begin(view),
+                                    begin(view) + middle_location, end(view));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_exespace_impl(
+      "Kokkos::inplace_merge_view_api_default", ex, begin(view),
+      begin(view) + middle_location, end(view), std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_exespace_impl(label, ex, begin(view),
+                                    begin(view) + middle_location, end(view),
+                                    std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void inplace_merge(const TeamHandleType& teamHandle,
+                                   IteratorType first, IteratorType middle,
+                                   IteratorType last) {
+  Impl::inplace_merge_team_impl(teamHandle, first, middle, last);
+}
+
+template <typename TeamHandleType, typename IteratorType,
+          typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void inplace_merge(const TeamHandleType& teamHandle,
+                                   IteratorType first, IteratorType middle,
+                                   IteratorType last, ComparatorType comp) {
+  Impl::inplace_merge_team_impl(teamHandle, first, middle, last,
+                                std::move(comp));
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void inplace_merge(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_team_impl(teamHandle, begin(view),
+                                begin(view) + middle_location, end(view));
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION void inplace_merge(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::inplace_merge_team_impl(teamHandle, begin(view),
+                                begin(view) + middle_location, end(view),
+                                std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
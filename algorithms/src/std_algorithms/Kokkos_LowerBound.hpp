@@ -0,0 +1,233 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_LOWER_BOUND_HPP
+#define KOKKOS_STD_ALGORITHMS_LOWER_BOUND_HPP
+
+#include "impl/Kokkos_LowerUpperBound.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+// For every value of [values_first, values_last), writes to result_first
+// the position in the sorted range [first, last) of the first element
+// that is not less than the value.
+
+//
+// overload set accepting execution space
+//
+template <
+    typename ExecutionSpace, typename IteratorType, typename ValuesIteratorType,
+    typename ResultIteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+ResultIteratorType lower_bound(const ExecutionSpace& ex, IteratorType first,
+                               IteratorType last,
+                               ValuesIteratorType values_first,
+                               ValuesIteratorType values_last,
+                               ResultIteratorType result_first) {
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      "Kokkos::lower_bound_iterator_api_default", ex, first, last, values_first,
+      values_last, result_first);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename ValuesIteratorType,
+    typename ResultIteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+ResultIteratorType lower_bound(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType last,
+                               ValuesIteratorType values_first,
+                               ValuesIteratorType values_last,
+                               ResultIteratorType result_first) {
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      label, ex, first, last, values_first, values_last, result_first);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename ValuesIteratorType,
+    typename ResultIteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+ResultIteratorType lower_bound(const ExecutionSpace& ex, IteratorType first,
+                               IteratorType last,
+                               ValuesIteratorType values_first,
+                               ValuesIteratorType values_last,
+                               ResultIteratorType result_first,
+                               ComparatorType comp) {
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      "Kokkos::lower_bound_iterator_api_default", ex, first, last, values_first,
+      values_last, result_first, std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename ValuesIteratorType,
+    typename ResultIteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+ResultIteratorType lower_bound(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType last,
+                               ValuesIteratorType values_first,
+                               ValuesIteratorType values_last,
+                               ResultIteratorType result_first,
+                               ComparatorType comp) {
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      label, ex, first, last, values_first, values_last, result_first,
+      std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType1, Properties1...>& view,
+                 const ::Kokkos::View<DataType2, Properties2...>& view_values,
+                 const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      "Kokkos::lower_bound_view_api_default", ex, cbegin(view), cend(view),
+      cbegin(view_values), cend(view_values), begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType1, Properties1...>& view,
+                 const ::Kokkos::View<DataType2, Properties2...>& view_values,
+                 const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      label, ex, cbegin(view), cend(view), cbegin(view_values),
+      cend(view_values), begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType1, Properties1...>& view,
+                 const ::Kokkos::View<DataType2, Properties2...>& view_values,
+                 const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+                 ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      "Kokkos::lower_bound_view_api_default", ex, cbegin(view), cend(view),
+      cbegin(view_values), cend(view_values), begin(view_dest),
+      std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto lower_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType1, Properties1...>& view,
+                 const ::Kokkos::View<DataType2, Properties2...>& view_values,
+                 const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+                 ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_exespace_impl<true>(
+      label, ex, cbegin(view), cend(view), cbegin(view_values),
+      cend(view_values), begin(view_dest), std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType,
+          typename ValuesIteratorType, typename ResultIteratorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION ResultIteratorType lower_bound(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValuesIteratorType values_first, ValuesIteratorType values_last,
+    ResultIteratorType result_first) {
+  return Impl::lower_upper_bound_team_impl<true>(
+      teamHandle, first, last, values_first, values_last, result_first);
+}
+
+template <typename TeamHandleType, typename IteratorType,
+          typename ValuesIteratorType, typename ResultIteratorType,
+          typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION ResultIteratorType lower_bound(const TeamHandleType& teamHandle,
+                                               IteratorType first,
+                                               IteratorType last,
+                                               ValuesIteratorType values_first,
+                                               ValuesIteratorType values_last,
+                                               ResultIteratorType result_first,
+                                               ComparatorType comp) {
+  return Impl::lower_upper_bound_team_impl<true>(teamHandle, first, last,
+                                                 values_first, values_last,
+                                                 result_first, std::move(comp));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto lower_bound(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_team_impl<true>(
+      teamHandle, cbegin(view), cend(view), cbegin(view_values),
+      cend(view_values), begin(view_dest));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3, typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto lower_bound(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::lower_upper_bound_team_impl<true>(
+      teamHandle, cbegin(view), cend(view), cbegin(view_values),
+      cend(view_values), begin(view_dest), std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_PARTITION_HPP
+#define KOKKOS_STD_ALGORITHMS_PARTITION_HPP
+
+#include "impl/Kokkos_PartitionStablePartition.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <
+    typename ExecutionSpace, typename IteratorType, typename PredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+IteratorType partition(const ExecutionSpace& ex, IteratorType first,
+                       IteratorType last, PredicateType pred) {
+  return Impl::partition_exespace_impl("Kokkos::partition_iterator_api_default",
+                                       ex, first, last, std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType, typename PredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+IteratorType partition(const std::string& label, const ExecutionSpace& ex,
+                       IteratorType first, IteratorType last,
+                       PredicateType pred) {
+  return Impl::partition_exespace_impl(label, ex, first, last, std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename PredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto partition(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType, Properties...>& view,
+               PredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::partition_exespace_impl("Kokkos::partition_view_api_default", ex,
+                                       begin(view), end(view), std::move(pred));
+}
+
+template <
+    typename ExecutionSpace, typename DataType, typename... Properties,
+    typename PredicateType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto partition(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType, Properties...>& view,
+               PredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::partition_exespace_impl(label, ex, begin(view), end(view),
+                                       std::move(pred));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType,
+          typename PredicateType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION IteratorType partition(const TeamHandleType& teamHandle,
+                                       IteratorType first, IteratorType last,
+                                       PredicateType pred) {
+  return Impl::partition_team_impl(teamHandle, first, last, std::move(pred));
+}
+
+template <typename TeamHandleType, typename DataType, typename... Properties,
+          typename PredicateType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto partition(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, PredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  return Impl::partition_team_impl(teamHandle, begin(view), end(view),
+                                   std::move(pred));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
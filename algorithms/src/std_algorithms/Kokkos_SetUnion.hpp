@@ -0,0 +1,219 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SET_UNION_HPP
+#define KOKKOS_STD_ALGORITHMS_SET_UNION_HPP
+
+#include "impl/Kokkos_SetOperations.hpp"
+#include "Kokkos_BeginEnd.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+
+//
+// overload set accepting execution space
+//
+template <
+    typename ExecutionSpace, typename IteratorType1, typename IteratorType2,
+    typename OutputIteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+OutputIteratorType set_union(const ExecutionSpace& ex, IteratorType1 first1,
+                             IteratorType1 last1, IteratorType2 first2,
+                             IteratorType2 last2, OutputIteratorType d_first) {
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      "Kokkos::set_union_iterator_api_default", ex, first1, last1, first2,
+      last2, d_first);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType1, typename IteratorType2,
+    typename OutputIteratorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+OutputIteratorType set_union(const std::string& label, const ExecutionSpace& ex,
+                             IteratorType1 first1, IteratorType1 last1,
+                             IteratorType2 first2, IteratorType2 last2,
+                             OutputIteratorType d_first) {
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      label, ex, first1, last1, first2, last2, d_first);
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType1, typename IteratorType2,
+    typename OutputIteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+OutputIteratorType set_union(const ExecutionSpace& ex, IteratorType1 first1,
+                             IteratorType1 last1, IteratorType2 first2,
+                             IteratorType2 last2, OutputIteratorType d_first,
+                             ComparatorType comp) {
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      "Kokkos::set_union_iterator_api_default", ex, first1, last1, first2,
+      last2, d_first, std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename IteratorType1, typename IteratorType2,
+    typename OutputIteratorType, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+OutputIteratorType set_union(const std::string& label, const ExecutionSpace& ex,
+                             IteratorType1 first1, IteratorType1 last1,
+                             IteratorType2 first2, IteratorType2 last2,
+                             OutputIteratorType d_first, ComparatorType comp) {
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      label, ex, first1, last1, first2, last2, d_first, std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto set_union(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      "Kokkos::set_union_view_api_default", ex, cbegin(view1), cend(view1),
+      cbegin(view2), cend(view2), begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto set_union(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      label, ex, cbegin(view1), cend(view1), cbegin(view2), cend(view2),
+      begin(view_dest));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto set_union(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+               ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      "Kokkos::set_union_view_api_default", ex, cbegin(view1), cend(view1),
+      cbegin(view2), cend(view2), begin(view_dest), std::move(comp));
+}
+
+template <
+    typename ExecutionSpace, typename DataType1, typename... Properties1,
+    typename DataType2, typename... Properties2, typename DataType3,
+    typename... Properties3, typename ComparatorType,
+    std::enable_if_t<::Kokkos::is_execution_space_v<ExecutionSpace>, int> = 0>
+auto set_union(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+               ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_exespace_impl<Impl::StdSetOperation::Union>(
+      label, ex, cbegin(view1), cend(view1), cbegin(view2), cend(view2),
+      begin(view_dest), std::move(comp));
+}
+
+//
+// overload set accepting a team handle
+// Note: for now omit the overloads accepting a label
+// since they cause issues on device because of the string allocation.
+//
+template <typename TeamHandleType, typename IteratorType1,
+          typename IteratorType2, typename OutputIteratorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION OutputIteratorType set_union(const TeamHandleType& teamHandle,
+                                             IteratorType1 first1,
+                                             IteratorType1 last1,
+                                             IteratorType2 first2,
+                                             IteratorType2 last2,
+                                             OutputIteratorType d_first) {
+  return Impl::set_operation_team_impl<Impl::StdSetOperation::Union>(
+      teamHandle, first1, last1, first2, last2, d_first);
+}
+
+template <typename TeamHandleType, typename IteratorType1,
+          typename IteratorType2, typename OutputIteratorType,
+          typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION OutputIteratorType set_union(const TeamHandleType& teamHandle,
+                                             IteratorType1 first1,
+                                             IteratorType1 last1,
+                                             IteratorType2 first2,
+                                             IteratorType2 last2,
+                                             OutputIteratorType d_first,
+                                             ComparatorType comp) {
+  return Impl::set_operation_team_impl<Impl::StdSetOperation::Union>(
+      teamHandle, first1, last1, first2, last2, d_first, std::move(comp));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto set_union(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_team_impl<Impl::StdSetOperation::Union>(
+      teamHandle, cbegin(view1), cend(view1), cbegin(view2), cend(view2),
+      begin(view_dest));
+}
+
+template <typename TeamHandleType, typename DataType1, typename... Properties1,
+          typename DataType2, typename... Properties2, typename DataType3,
+          typename... Properties3, typename ComparatorType,
+          std::enable_if_t<::Kokkos::is_team_handle_v<TeamHandleType>, int> = 0>
+KOKKOS_FUNCTION auto set_union(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  return Impl::set_operation_team_impl<Impl::StdSetOperation::Union>(
+      teamHandle, cbegin(view1), cend(view1), cbegin(view2), cend(view2),
+      begin(view_dest), std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -45,6 +46,24 @@ struct StdCountIfFunctor {
       : m_first(std::move(_first)), m_predicate(std::move(_predicate)) {}
 };
 
+template <class SimdType, class IndexType>
+struct StdCountSimdHostFunctor {
+  using kernels      = SimdHostKernels<SimdType>;
+  using element_type = typename kernels::value_type;
+
+  element_type const* m_first;
+  IndexType m_num_elements;
+  element_type m_value;
+
+  void operator()(const IndexType block, IndexType& lsum) const {
+    const IndexType begin = block * simd_host_block_size;
+    lsum += kernels::count(
+        m_first + begin,
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin),
+        m_value);
+  }
+};
+
 template <class ExecutionSpace, class IteratorType, class Predicate>
 typename IteratorType::difference_type count_if_exespace_impl(
     const std::string& label, const ExecutionSpace& ex, IteratorType first,
@@ -69,9 +88,35 @@ template <class ExecutionSpace, class IteratorType, class T>
 auto count_exespace_impl(const std::string& label, const ExecutionSpace& ex,
                          IteratorType first, IteratorType last,
                          const T& value) {
-  return count_if_exespace_impl(
-      label, ex, first, last,
-      ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
+  if constexpr (is_simd_host_range_v<ExecutionSpace, T, IteratorType>) {
+    // checks
+    Impl::static_assert_random_access_and_accessible(ex, first);
+    Impl::expect_valid_range(first, last);
+
+    using index_type = typename IteratorType::difference_type;
+
+    const auto num_elements = Kokkos::Experimental::distance(first, last);
+    index_type count        = 0;
+    if (num_elements == 0) {
+      return count;
+    }
+
+    // run
+    using functor_type =
+        StdCountSimdHostFunctor<simd_host_t<ExecutionSpace, T>, index_type>;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        functor_type{&*first, num_elements, value}, count);
+    ex.fence("Kokkos::count: fence after operation");
+
+    return count;
+  } else {
+    return count_if_exespace_impl(
+        label, ex, first, last,
+        ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(
+            value));
+  }
 }
 
 //
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Mismatch.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -65,13 +66,40 @@ bool equal_exespace_impl(const std::string& label, const ExecutionSpace& ex,
 
   // run
   const auto num_elements = Kokkos::Experimental::distance(first1, last1);
-  std::size_t different   = 0;
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-      StdEqualFunctor(first1, first2, predicate), different);
-  ex.fence("Kokkos::equal: fence after operation");
+  if constexpr (is_simd_host_mismatch_v<ExecutionSpace, IteratorType1,
+                                        IteratorType2, BinaryPredicateType>) {
+    if (num_elements == 0) {
+      return true;
+    }
 
-  return !different;
+    // aliases
+    using index_type           = typename IteratorType1::difference_type;
+    using reducer_type         = FirstLoc<index_type>;
+    using reduction_value_type = typename reducer_type::value_type;
+    using simd_func_t          = StdMismatchSimdHostFunctor<
+        simd_host_t<ExecutionSpace,
+                    std::remove_const_t<typename IteratorType1::value_type>>,
+        index_type, reducer_type>;
+
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+    index_type found = num_elements;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        simd_func_t{&*first1, &*first2, num_elements, reducer, &found},
+        reducer);
+
+    return found == num_elements;
+  } else {
+    std::size_t different = 0;
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+        StdEqualFunctor(first1, first2, predicate), different);
+    ex.fence("Kokkos::equal: fence after operation");
+
+    return !different;
+  }
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2>
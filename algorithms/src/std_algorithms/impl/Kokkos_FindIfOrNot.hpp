@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -61,6 +62,34 @@ struct StdFindIfOrNotFunctor {
         m_p(std::move(p)) {}
 };
 
+// Blocks starting past the first match found so far by any thread are
+// skipped, blocks are searched up to their first match.
+template <class SimdType, class IndexType, class ReducerType>
+struct StdFindSimdHostFunctor {
+  using kernels        = SimdHostKernels<SimdType>;
+  using element_type   = typename kernels::value_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first;
+  IndexType m_num_elements;
+  element_type m_value;
+  ReducerType m_reducer;
+  IndexType* m_found;
+
+  void operator()(const IndexType block, red_value_type& red_value) const {
+    const IndexType begin = block * simd_host_block_size;
+    if (begin > ::Kokkos::atomic_load(m_found)) return;
+
+    const IndexType n =
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin);
+    const IndexType pos = kernels::find(m_first + begin, n, m_value);
+    if (pos < n) {
+      ::Kokkos::atomic_min(m_found, begin + pos);
+      m_reducer.join(red_value, red_value_type{begin + pos});
+    }
+  }
+};
+
 //
 // exespace impl
 //
@@ -85,14 +114,31 @@ IteratorType find_if_or_not_exespace_impl(const std::string& label,
   using reduction_value_type = typename reducer_type::value_type;
   using func_t = StdFindIfOrNotFunctor<is_find_if, index_type, IteratorType,
                                        reducer_type, PredicateType>;
+  using value_type = std::remove_const_t<typename IteratorType::value_type>;
 
   // run
   reduction_value_type red_result;
   reducer_type reducer(red_result);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(label,
-                            RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-                            func_t(first, reducer, pred), reducer);
+  if constexpr (is_find_if &&
+                std::is_same_v<PredicateType,
+                               StdAlgoEqualsValUnaryPredicate<value_type>> &&
+                is_simd_host_range_v<ExecutionSpace, value_type,
+                                     IteratorType>) {
+    using simd_func_t =
+        StdFindSimdHostFunctor<simd_host_t<ExecutionSpace, value_type>,
+                               index_type, reducer_type>;
+    index_type found = num_elements;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        simd_func_t{&*first, num_elements, pred.m_value, reducer, &found},
+        reducer);
+  } else {
+    ::Kokkos::parallel_reduce(label,
+                              RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                              func_t(first, reducer, pred), reducer);
+  }
 
   // fence not needed because reducing into scalar
 
@@ -0,0 +1,277 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_HISTOGRAM_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_HISTOGRAM_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Above this many bytes of counts per thread, private copies no longer
+// stay in the L1/L2 cache of the host threads, and merging them costs
+// more than the contended atomics they avoid.
+constexpr std::size_t histogram_private_bins_max_bytes = 32 * 1024;
+
+// number of elements processed by each team of the scratch based version,
+// expressed per bin so that zeroing and flushing the bins stays cheap
+constexpr std::size_t histogram_elements_per_team_per_bin = 16;
+constexpr std::size_t histogram_min_elements_per_team     = 4096;
+
+// maps an element index to its bin by applying bin_op to the element
+template <class IteratorType, class BinOpType>
+struct StdHistogramIteratorBinFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  BinOpType m_bin_op;
+
+  KOKKOS_FUNCTION
+  auto operator()(const index_type i) const { return m_bin_op(m_first[i]); }
+};
+
+// every thread counts into its own copy of the bins, the copies are
+// merged by the array reduction
+template <class IndexType, class CountType, class BinFunctorType>
+struct StdHistogramPrivateBinsFunctor {
+  using value_type = CountType[];
+
+  unsigned value_count;
+  BinFunctorType m_bin_of;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type counts) const {
+    ++counts[m_bin_of(i)];
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type counts) const {
+    for (unsigned b = 0; b < value_count; ++b) {
+      counts[b] = 0;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void join(value_type counts, const value_type source) const {
+    for (unsigned b = 0; b < value_count; ++b) {
+      counts[b] += source[b];
+    }
+  }
+};
+
+// every team counts a contiguous chunk of the elements into bins living in
+// team scratch, and flushes the non-empty bins to the result with atomics
+template <class ExeSpace, class IndexType, class CountsViewType,
+          class BinFunctorType>
+struct StdHistogramTeamScratchFunctor {
+  using count_type   = typename CountsViewType::non_const_value_type;
+  using scratch_view = ::Kokkos::View<count_type*,
+                                      typename ExeSpace::scratch_memory_space,
+                                      ::Kokkos::MemoryUnmanaged>;
+
+  IndexType m_num_elements;
+  IndexType m_elements_per_team;
+  CountsViewType m_counts;
+  BinFunctorType m_bin_of;
+
+  template <class MemberType>
+  KOKKOS_FUNCTION void operator()(const MemberType& member) const {
+    const int num_bins = m_counts.extent(0);
+    scratch_view bins(member.team_scratch(0), num_bins);
+    ::Kokkos::parallel_for(::Kokkos::TeamThreadRange(member, num_bins),
+                           [=](const int b) { bins(b) = 0; });
+    member.team_barrier();
+
+    const IndexType begin = member.league_rank() * m_elements_per_team;
+    const IndexType end   = ::Kokkos::min(begin + m_elements_per_team,
+                                          m_num_elements);
+    ::Kokkos::parallel_for(::Kokkos::TeamThreadRange(member, begin, end),
+                           [=, *this](const IndexType i) {
+                             ::Kokkos::atomic_inc(&bins(m_bin_of(i)));
+                           });
+    member.team_barrier();
+
+    ::Kokkos::parallel_for(::Kokkos::TeamThreadRange(member, num_bins),
+                           [=, *this](const int b) {
+                             if (bins(b) != 0) {
+                               ::Kokkos::atomic_add(&m_counts(b), bins(b));
+                             }
+                           });
+  }
+};
+
+template <class IndexType, class CountsViewType, class BinFunctorType>
+struct StdHistogramAtomicFunctor {
+  using count_type = typename CountsViewType::non_const_value_type;
+
+  CountsViewType m_counts;
+  BinFunctorType m_bin_of;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i) const {
+    ::Kokkos::atomic_add(&m_counts(m_bin_of(i)), count_type(1));
+  }
+};
+
+//
+// counts the elements [0, num_elements) per bin, where bin_of maps an
+// element index to a bin in [0, counts.extent(0)), and overwrites counts.
+// The strategy depends on where the bins can live:
+// - private per-thread copies merged by a parallel reduction on host spaces,
+//   as long as they fit the cache budget above;
+// - per-team copies in scratch memory on the other spaces, as long as they
+//   fit the level 0 scratch;
+// - otherwise, atomic increments of counts.
+// Does not fence.
+//
+template <class ExecutionSpace, class IndexType, class CountsViewType,
+          class BinFunctorType>
+void histogram_impl(const std::string& label, const ExecutionSpace& ex,
+                    const IndexType num_elements, const CountsViewType& counts,
+                    const BinFunctorType& bin_of) {
+  static_assert(CountsViewType::rank() == 1,
+                "Kokkos::histogram: counts must be a rank-1 view");
+  static_assert(
+      std::is_integral_v<typename CountsViewType::non_const_value_type>,
+      "Kokkos::histogram: counts must have an integral value type");
+
+  using count_type   = typename CountsViewType::non_const_value_type;
+  using memory_space = typename ExecutionSpace::memory_space;
+  constexpr bool is_host_space =
+      ::Kokkos::SpaceAccessibility<ExecutionSpace,
+                                   ::Kokkos::HostSpace>::accessible;
+
+  const std::size_t num_bins  = counts.extent(0);
+  const std::size_t bin_bytes = num_bins * sizeof(count_type);
+
+  if (num_bins == 0) {
+    return;
+  }
+
+  if (is_host_space && bin_bytes <= histogram_private_bins_max_bytes) {
+    using func_type =
+        StdHistogramPrivateBinsFunctor<IndexType, count_type, BinFunctorType>;
+    // the reduction result must be contiguous
+    ::Kokkos::View<count_type*, memory_space> result(
+        ::Kokkos::view_alloc(ex, ::Kokkos::WithoutInitializing,
+                             "Kokkos::histogram::private_bins"),
+        num_bins);
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+        func_type{static_cast<unsigned>(num_bins), bin_of}, result);
+    ::Kokkos::deep_copy(ex, counts, result);
+    return;
+  }
+
+  ::Kokkos::deep_copy(ex, counts, count_type(0));
+  if (num_elements == 0) {
+    return;
+  }
+
+  using team_policy = ::Kokkos::TeamPolicy<ExecutionSpace>;
+  using scratch_func_type =
+      StdHistogramTeamScratchFunctor<ExecutionSpace, IndexType, CountsViewType,
+                                     BinFunctorType>;
+  const std::size_t scratch_bytes =
+      scratch_func_type::scratch_view::shmem_size(num_bins);
+  if (!is_host_space &&
+      scratch_bytes <= std::size_t(team_policy::scratch_size_max(0))) {
+    const IndexType elements_per_team = ::Kokkos::max(
+        IndexType(histogram_min_elements_per_team),
+        IndexType(num_bins * histogram_elements_per_team_per_bin));
+    const IndexType league_size =
+        (num_elements + elements_per_team - 1) / elements_per_team;
+    ::Kokkos::parallel_for(
+        label,
+        team_policy(ex, league_size, ::Kokkos::AUTO())
+            .set_scratch_size(0, ::Kokkos::PerTeam(scratch_bytes)),
+        scratch_func_type{num_elements, elements_per_team, counts, bin_of});
+    return;
+  }
+
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      StdHistogramAtomicFunctor<IndexType, CountsViewType, BinFunctorType>{
+          counts, bin_of});
+}
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class IteratorType, class CountsViewType,
+          class BinOpType>
+void histogram_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                             IteratorType first, IteratorType last,
+                             const CountsViewType& counts, BinOpType bin_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+  static_assert(
+      ::Kokkos::SpaceAccessibility<
+          ExecutionSpace, typename CountsViewType::memory_space>::accessible,
+      "Kokkos::histogram: counts must be accessible from the execution space");
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  histogram_impl(
+      label, ex, num_elements, counts,
+      StdHistogramIteratorBinFunctor<IteratorType, BinOpType>{first, bin_op});
+  ex.fence("Kokkos::histogram: fence after operation");
+}
+
+//
+// team impl
+//
+template <class TeamHandleType, class IteratorType, class CountsViewType,
+          class BinOpType>
+KOKKOS_FUNCTION void histogram_team_impl(const TeamHandleType& teamHandle,
+                                         IteratorType first, IteratorType last,
+                                         const CountsViewType& counts,
+                                         BinOpType bin_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+  static_assert(CountsViewType::rank() == 1,
+                "Kokkos::histogram: counts must be a rank-1 view");
+
+  // aliases
+  using index_type = typename IteratorType::difference_type;
+  using count_type = typename CountsViewType::non_const_value_type;
+
+  // run
+  const int num_bins      = counts.extent(0);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_bins),
+                         [=](const int b) { counts(b) = 0; });
+  teamHandle.team_barrier();
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         [=](const index_type i) {
+                           ::Kokkos::atomic_add(&counts(bin_op(first[i])),
+                                                count_type(1));
+                         });
+  teamHandle.team_barrier();
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
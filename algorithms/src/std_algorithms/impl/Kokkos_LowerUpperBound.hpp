@@ -0,0 +1,212 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_LOWER_UPPER_BOUND_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_LOWER_UPPER_BOUND_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// sequential binary searches, used by every thread of the batched
+// searches below and by the merge and set algorithms
+//
+template <class IteratorType, class ValueType, class ComparatorType>
+KOKKOS_FUNCTION IteratorType lower_bound_sequential(IteratorType first,
+                                                    IteratorType last,
+                                                    const ValueType& value,
+                                                    ComparatorType comp) {
+  auto count = last - first;
+  while (count > 0) {
+    const auto step = count / 2;
+    const auto it   = first + step;
+    if (comp(*it, value)) {
+      first = it + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+template <class IteratorType, class ValueType, class ComparatorType>
+KOKKOS_FUNCTION IteratorType upper_bound_sequential(IteratorType first,
+                                                    IteratorType last,
+                                                    const ValueType& value,
+                                                    ComparatorType comp) {
+  auto count = last - first;
+  while (count > 0) {
+    const auto step = count / 2;
+    const auto it   = first + step;
+    if (!comp(value, *it)) {
+      first = it + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+template <bool IsLowerBound, class IndexType, class IteratorType,
+          class ValuesIteratorType, class ResultIteratorType,
+          class ComparatorType>
+struct StdLowerUpperBoundFunctor {
+  IteratorType m_first;
+  IteratorType m_last;
+  ValuesIteratorType m_values_first;
+  ResultIteratorType m_result_first;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  StdLowerUpperBoundFunctor(IteratorType first, IteratorType last,
+                            ValuesIteratorType values_first,
+                            ResultIteratorType result_first,
+                            ComparatorType comp)
+      : m_first(std::move(first)),
+        m_last(std::move(last)),
+        m_values_first(std::move(values_first)),
+        m_result_first(std::move(result_first)),
+        m_comp(std::move(comp)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i) const {
+    const auto& value = m_values_first[i];
+    if constexpr (IsLowerBound) {
+      m_result_first[i] =
+          lower_bound_sequential(m_first, m_last, value, m_comp) - m_first;
+    } else {
+      m_result_first[i] =
+          upper_bound_sequential(m_first, m_last, value, m_comp) - m_first;
+    }
+  }
+};
+
+//
+// exespace impl
+//
+template <bool IsLowerBound, class ExecutionSpace, class IteratorType,
+          class ValuesIteratorType, class ResultIteratorType,
+          class ComparatorType>
+ResultIteratorType lower_upper_bound_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, ValuesIteratorType values_first,
+    ValuesIteratorType values_last, ResultIteratorType result_first,
+    ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first, values_first,
+                                                   result_first);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      first, values_first, result_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(values_first, values_last);
+
+  // aliases
+  using index_type = typename ValuesIteratorType::difference_type;
+  using func_t =
+      StdLowerUpperBoundFunctor<IsLowerBound, index_type, IteratorType,
+                                ValuesIteratorType, ResultIteratorType,
+                                ComparatorType>;
+
+  // run
+  const auto num_values =
+      Kokkos::Experimental::distance(values_first, values_last);
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_values),
+      func_t(first, last, values_first, result_first, std::move(comp)));
+  ex.fence(IsLowerBound ? "Kokkos::lower_bound: fence after operation"
+                        : "Kokkos::upper_bound: fence after operation");
+
+  // return
+  return result_first + num_values;
+}
+
+template <bool IsLowerBound, class ExecutionSpace, class IteratorType,
+          class ValuesIteratorType, class ResultIteratorType>
+ResultIteratorType lower_upper_bound_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, ValuesIteratorType values_first,
+    ValuesIteratorType values_last, ResultIteratorType result_first) {
+  using value_type = std::remove_const_t<typename IteratorType::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return lower_upper_bound_exespace_impl<IsLowerBound>(
+      label, ex, first, last, values_first, values_last, result_first,
+      comp_t());
+}
+
+//
+// team impl
+//
+template <bool IsLowerBound, class TeamHandleType, class IteratorType,
+          class ValuesIteratorType, class ResultIteratorType,
+          class ComparatorType>
+KOKKOS_FUNCTION ResultIteratorType lower_upper_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValuesIteratorType values_first, ValuesIteratorType values_last,
+    ResultIteratorType result_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first,
+                                                   values_first, result_first);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      first, values_first, result_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(values_first, values_last);
+
+  // aliases
+  using index_type = typename ValuesIteratorType::difference_type;
+  using func_t =
+      StdLowerUpperBoundFunctor<IsLowerBound, index_type, IteratorType,
+                                ValuesIteratorType, ResultIteratorType,
+                                ComparatorType>;
+
+  // run
+  const auto num_values =
+      Kokkos::Experimental::distance(values_first, values_last);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, num_values),
+      func_t(first, last, values_first, result_first, std::move(comp)));
+  teamHandle.team_barrier();
+
+  // return
+  return result_first + num_values;
+}
+
+template <bool IsLowerBound, class TeamHandleType, class IteratorType,
+          class ValuesIteratorType, class ResultIteratorType>
+KOKKOS_FUNCTION ResultIteratorType lower_upper_bound_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValuesIteratorType values_first, ValuesIteratorType values_last,
+    ResultIteratorType result_first) {
+  using value_type = std::remove_const_t<typename IteratorType::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return lower_upper_bound_team_impl<IsLowerBound>(
+      teamHandle, first, last, values_first, values_last, result_first,
+      comp_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
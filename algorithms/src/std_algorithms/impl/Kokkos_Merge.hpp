@@ -0,0 +1,400 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_MERGE_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_MERGE_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_LowerUpperBound.hpp"
+#include "Kokkos_Move.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// merge path
+//
+// The output of merging [first1, first1 + n1) and [first2, first2 + n2) is
+// cut into chunks of merge_path_chunk_size elements.  The elements of the
+// two inputs ending up in a chunk are found with a binary search along the
+// diagonal of the merge matrix, so every chunk is merged independently.
+//
+inline constexpr std::ptrdiff_t merge_path_chunk_size = 256;
+
+template <class IndexType>
+KOKKOS_FUNCTION IndexType merge_path_num_chunks(IndexType num_elements) {
+  return (num_elements + merge_path_chunk_size - 1) / merge_path_chunk_size;
+}
+
+// number of elements of the first range among the first diagonal elements
+// of the stable merge, ties are taken from the first range
+template <class IteratorType1, class IteratorType2, class IndexType,
+          class ComparatorType>
+KOKKOS_FUNCTION IndexType merge_path_split(IteratorType1 first1, IndexType n1,
+                                           IteratorType2 first2, IndexType n2,
+                                           IndexType diagonal,
+                                           ComparatorType comp) {
+  IndexType lo = diagonal > n2 ? diagonal - n2 : IndexType(0);
+  IndexType hi = diagonal < n1 ? diagonal : n1;
+  while (lo < hi) {
+    const IndexType mid = lo + (hi - lo) / 2;
+    if (comp(first2[diagonal - 1 - mid], first1[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+template <class IndexType>
+struct MergePathSplit {
+  IndexType first;
+  IndexType second;
+};
+
+// same as merge_path_split, moved back so that all elements equivalent to
+// the one following the split end up after it, in both ranges: the set
+// operations need a whole run of equivalent elements in one chunk
+template <class IteratorType1, class IteratorType2, class IndexType,
+          class ComparatorType>
+KOKKOS_FUNCTION MergePathSplit<IndexType> merge_path_split_at_value(
+    IteratorType1 first1, IndexType n1, IteratorType2 first2, IndexType n2,
+    IndexType diagonal, ComparatorType comp) {
+  const IndexType i = merge_path_split(first1, n1, first2, n2, diagonal, comp);
+  const IndexType j = diagonal - i;
+  if (diagonal == n1 + n2) {
+    return {i, j};
+  }
+
+  const bool next_is_first = i < n1 && (j == n2 || !comp(first2[j], first1[i]));
+  const auto& next         = next_is_first ? first1[i] : first2[j];
+  return {lower_bound_sequential(first1, first1 + i, next, comp) - first1,
+          lower_bound_sequential(first2, first2 + j, next, comp) - first2};
+}
+
+template <class IndexType, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+struct StdMergeFunctor {
+  IteratorType1 m_first1;
+  IteratorType2 m_first2;
+  OutputIteratorType m_dest_first;
+  IndexType m_n1;
+  IndexType m_n2;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  StdMergeFunctor(IteratorType1 first1, IndexType n1, IteratorType2 first2,
+                  IndexType n2, OutputIteratorType dest_first,
+                  ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_first2(std::move(first2)),
+        m_dest_first(std::move(dest_first)),
+        m_n1(n1),
+        m_n2(n2),
+        m_comp(std::move(comp)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType chunk) const {
+    const IndexType total = m_n1 + m_n2;
+    const IndexType diag_begin =
+        Kokkos::min(IndexType(chunk * merge_path_chunk_size), total);
+    const IndexType diag_end =
+        Kokkos::min(IndexType(diag_begin + merge_path_chunk_size), total);
+
+    IndexType i = merge_path_split(m_first1, m_n1, m_first2, m_n2, diag_begin,
+                                   m_comp);
+    IndexType j = diag_begin - i;
+    const IndexType i_end =
+        merge_path_split(m_first1, m_n1, m_first2, m_n2, diag_end, m_comp);
+    const IndexType j_end = diag_end - i_end;
+
+    for (IndexType k = diag_begin; k < diag_end; ++k) {
+      if (j < j_end && (i == i_end || m_comp(m_first2[j], m_first1[i]))) {
+        m_dest_first[k] = m_first2[j++];
+      } else {
+        m_dest_first[k] = m_first1[i++];
+      }
+    }
+  }
+};
+
+//
+// merge
+//
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType merge_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t = StdMergeFunctor<index_type, IteratorType1, IteratorType2,
+                                 OutputIteratorType, ComparatorType>;
+
+  // run
+  const auto n1 = Kokkos::Experimental::distance(first1, last1);
+  const auto n2 = Kokkos::Experimental::distance(first2, last2);
+  ::Kokkos::parallel_for(
+      label,
+      RangePolicy<ExecutionSpace>(ex, 0, merge_path_num_chunks(n1 + n2)),
+      func_t(first1, n1, first2, n2, d_first, std::move(comp)));
+  ex.fence("Kokkos::merge: fence after operation");
+
+  // return
+  return d_first + (n1 + n2);
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+OutputIteratorType merge_exespace_impl(const std::string& label,
+                                       const ExecutionSpace& ex,
+                                       IteratorType1 first1,
+                                       IteratorType1 last1,
+                                       IteratorType2 first2,
+                                       IteratorType2 last2,
+                                       OutputIteratorType d_first) {
+  using value_type = std::remove_const_t<typename IteratorType1::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return merge_exespace_impl(label, ex, first1, last1, first2, last2, d_first,
+                             comp_t());
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+KOKKOS_FUNCTION OutputIteratorType merge_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t = StdMergeFunctor<index_type, IteratorType1, IteratorType2,
+                                 OutputIteratorType, ComparatorType>;
+
+  // run
+  const auto n1 = Kokkos::Experimental::distance(first1, last1);
+  const auto n2 = Kokkos::Experimental::distance(first2, last2);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, merge_path_num_chunks(n1 + n2)),
+      func_t(first1, n1, first2, n2, d_first, std::move(comp)));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + (n1 + n2);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+KOKKOS_FUNCTION OutputIteratorType merge_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first) {
+  using value_type = std::remove_const_t<typename IteratorType1::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return merge_team_impl(teamHandle, first1, last1, first2, last2, d_first,
+                         comp_t());
+}
+
+//
+// sequential in-place helpers, used where no buffer can be allocated
+//
+template <class IteratorType>
+KOKKOS_FUNCTION void reverse_sequential(IteratorType first,
+                                        IteratorType last) {
+  while (first != last && first != --last) {
+    ::Kokkos::kokkos_swap(*first, *last);
+    ++first;
+  }
+}
+
+// returns the new position of *first, like std::rotate
+template <class IteratorType>
+KOKKOS_FUNCTION IteratorType rotate_sequential(IteratorType first,
+                                               IteratorType n_first,
+                                               IteratorType last) {
+  reverse_sequential(first, n_first);
+  reverse_sequential(n_first, last);
+  reverse_sequential(first, last);
+  return first + (last - n_first);
+}
+
+// Merges the sorted ranges [first, middle) and [middle, last) by recursive
+// rotations, O(n log(n)^2) operations without any buffer.  The recursion is
+// unrolled on an explicit stack, the smaller half is processed first so the
+// stack never holds more than log2(n) frames.
+template <class IteratorType, class ComparatorType>
+KOKKOS_FUNCTION void inplace_merge_sequential(IteratorType first,
+                                              IteratorType middle,
+                                              IteratorType last,
+                                              ComparatorType comp) {
+  struct Frame {
+    IteratorType first;
+    IteratorType middle;
+    IteratorType last;
+  };
+  constexpr int max_frames = 64;
+  Frame stack[max_frames];
+  int top      = 0;
+  stack[top++] = Frame{first, middle, last};
+
+  while (top > 0) {
+    const Frame frame = stack[--top];
+    const auto len1   = frame.middle - frame.first;
+    const auto len2   = frame.last - frame.middle;
+    if (len1 == 0 || len2 == 0) {
+      continue;
+    }
+    if (len1 + len2 == 2) {
+      if (comp(*frame.middle, *frame.first)) {
+        ::Kokkos::kokkos_swap(*frame.first, *frame.middle);
+      }
+      continue;
+    }
+
+    IteratorType cut1;
+    IteratorType cut2;
+    if (len1 > len2) {
+      cut1 = frame.first + len1 / 2;
+      cut2 = lower_bound_sequential(frame.middle, frame.last, *cut1, comp);
+    } else {
+      cut2 = frame.middle + len2 / 2;
+      cut1 = upper_bound_sequential(frame.first, frame.middle, *cut2, comp);
+    }
+    const auto new_middle = rotate_sequential(cut1, frame.middle, cut2);
+
+    const Frame left{frame.first, cut1, new_middle};
+    const Frame right{new_middle, cut2, frame.last};
+    if (new_middle - frame.first < frame.last - new_middle) {
+      stack[top++] = right;
+      stack[top++] = left;
+    } else {
+      stack[top++] = left;
+      stack[top++] = right;
+    }
+  }
+}
+
+//
+// inplace_merge
+//
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void inplace_merge_exespace_impl(const std::string& label,
+                                 const ExecutionSpace& ex, IteratorType first,
+                                 IteratorType middle, IteratorType last,
+                                 ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  if (first == middle || middle == last) {
+    return;
+  }
+
+  // merge into a tmp view and move back
+  using value_type    = typename IteratorType::value_type;
+  using tmp_view_type = Kokkos::View<value_type*, ExecutionSpace>;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  tmp_view_type tmp_view(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                            "std_inplace_merge_tmp_view"),
+                         num_elements);
+  auto tmp_first = ::Kokkos::Experimental::begin(tmp_view);
+
+  using index_type = typename IteratorType::difference_type;
+  using merge_func_t =
+      StdMergeFunctor<index_type, IteratorType, IteratorType,
+                      decltype(tmp_first), ComparatorType>;
+  ::Kokkos::parallel_for(
+      label,
+      RangePolicy<ExecutionSpace>(ex, 0, merge_path_num_chunks(num_elements)),
+      merge_func_t(first, middle - first, middle, last - middle, tmp_first,
+                   std::move(comp)));
+
+  using move_func_t =
+      StdMoveFunctor<index_type, decltype(tmp_first), IteratorType>;
+  ::Kokkos::parallel_for("inplace_merge_move_back",
+                         RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                         move_func_t(tmp_first, first));
+  ex.fence("Kokkos::inplace_merge: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void inplace_merge_exespace_impl(const std::string& label,
+                                 const ExecutionSpace& ex, IteratorType first,
+                                 IteratorType middle, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  inplace_merge_exespace_impl(label, ex, first, middle, last, comp_t());
+}
+
+template <class TeamHandleType, class IteratorType, class ComparatorType>
+KOKKOS_FUNCTION void inplace_merge_team_impl(const TeamHandleType& teamHandle,
+                                             IteratorType first,
+                                             IteratorType middle,
+                                             IteratorType last,
+                                             ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  // FIXME: the execution-space-based impl merges into an auxiliary
+  // allocation, at the team level we cannot do the same, so merge in place
+  // serially for now
+  Kokkos::single(Kokkos::PerTeam(teamHandle), [=]() {
+    inplace_merge_sequential(first, middle, last, comp);
+  });
+  teamHandle.team_barrier();
+}
+
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION void inplace_merge_team_impl(const TeamHandleType& teamHandle,
+                                             IteratorType first,
+                                             IteratorType middle,
+                                             IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  inplace_merge_team_impl(teamHandle, first, middle, last, comp_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -63,6 +64,63 @@ struct StdMinMaxElemFunctor {
       : m_first(std::move(first)), m_reducer(std::move(reducer)) {}
 };
 
+// The extremum of a block is found first and then located. NaNs are never
+// selected, blocks of NaNs only are skipped instead of letting the NaNs tie
+// with the extrema of the other blocks.
+template <bool is_min, class SimdType, class IndexType, class ReducerType>
+struct StdMinOrMaxElemSimdHostFunctor {
+  using kernels        = SimdHostKernels<SimdType>;
+  using element_type   = typename kernels::value_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first;
+  IndexType m_num_elements;
+  ReducerType m_reducer;
+
+  void operator()(const IndexType block, red_value_type& red_value) const {
+    const IndexType begin = block * simd_host_block_size;
+    const IndexType n =
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin);
+    element_type const* ptr = m_first + begin;
+
+    const element_type extremum =
+        is_min ? kernels::min_value(ptr, n) : kernels::max_value(ptr, n);
+    const IndexType pos = kernels::find(ptr, n, extremum);
+    if (pos < n) {
+      m_reducer.join(red_value, red_value_type{extremum, begin + pos});
+    }
+  }
+};
+
+template <class SimdType, class IndexType, class ReducerType>
+struct StdMinMaxElemSimdHostFunctor {
+  using kernels        = SimdHostKernels<SimdType>;
+  using element_type   = typename kernels::value_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first;
+  IndexType m_num_elements;
+  ReducerType m_reducer;
+
+  void operator()(const IndexType block, red_value_type& red_value) const {
+    const IndexType begin = block * simd_host_block_size;
+    const IndexType n =
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin);
+    element_type const* ptr = m_first + begin;
+
+    // first position of the minimum, last position of the maximum
+    const element_type min_value = kernels::min_value(ptr, n);
+    const element_type max_value = kernels::max_value(ptr, n);
+    const IndexType min_pos      = kernels::find(ptr, n, min_value);
+    const IndexType max_pos      = kernels::find_last(ptr, n, max_value);
+    if (min_pos < n && max_pos < n) {
+      m_reducer.join(red_value,
+                     red_value_type{min_value, max_value, begin + min_pos,
+                                    begin + max_pos});
+    }
+  }
+};
+
 //
 // exespace impl
 //
@@ -92,9 +150,34 @@ IteratorType min_or_max_element_exespace_impl(const std::string& label,
   reduction_value_type red_result;
   reducer_type reducer(red_result, std::forward<Args>(args)...);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(label,
-                            RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-                            func_t(first, reducer), reducer);
+  constexpr bool is_min = std::is_same_v<
+      reducer_type, ::Kokkos::MinFirstLoc<value_type, index_type>>;
+  constexpr bool is_max = std::is_same_v<
+      reducer_type, ::Kokkos::MaxFirstLoc<value_type, index_type>>;
+  using simd_value_type = std::remove_const_t<value_type>;
+  if constexpr ((is_min || is_max) &&
+                is_simd_host_range_supporting<simd_less_t, ExecutionSpace,
+                                              simd_value_type,
+                                              IteratorType>()) {
+    using simd_func_t = StdMinOrMaxElemSimdHostFunctor<
+        is_min, simd_host_t<ExecutionSpace, simd_value_type>, index_type,
+        reducer_type>;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        simd_func_t{&*first, num_elements, reducer}, reducer);
+
+    // only NaNs, none of them compares less, like std::min_element
+    reduction_value_type identity;
+    reducer.init(identity);
+    if (red_result.loc == identity.loc) {
+      return first;
+    }
+  } else {
+    ::Kokkos::parallel_reduce(label,
+                              RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                              func_t(first, reducer), reducer);
+  }
 
   // fence not needed because reducing into scalar
 
@@ -126,9 +209,32 @@ template <template <class... Args> class ReducerType, class ExecutionSpace,
   reduction_value_type red_result;
   reducer_type reducer(red_result, std::forward<Args>(args)...);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(label,
-                            RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-                            func_t(first, reducer), reducer);
+  using simd_value_type   = std::remove_const_t<value_type>;
+  if constexpr (std::is_same_v<reducer_type,
+                               ::Kokkos::MinMaxFirstLastLoc<value_type,
+                                                            index_type>> &&
+                is_simd_host_range_supporting<simd_less_t, ExecutionSpace,
+                                              simd_value_type,
+                                              IteratorType>()) {
+    using simd_func_t = StdMinMaxElemSimdHostFunctor<
+        simd_host_t<ExecutionSpace, simd_value_type>, index_type,
+        reducer_type>;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        simd_func_t{&*first, num_elements, reducer}, reducer);
+
+    // only NaNs, like std::minmax_element
+    reduction_value_type identity;
+    reducer.init(identity);
+    if (red_result.min_loc == identity.min_loc) {
+      return {first, last - 1};
+    }
+  } else {
+    ::Kokkos::parallel_reduce(label,
+                              RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                              func_t(first, reducer), reducer);
+  }
 
   // fence not needed because reducing into scalar
 
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -61,6 +62,48 @@ struct StdMismatchRedFunctor {
         m_predicate(std::move(predicate)) {}
 };
 
+// Blocks starting past the first mismatch found so far by any thread are
+// skipped, blocks are compared up to their first mismatch.
+template <class SimdType, class IndexType, class ReducerType>
+struct StdMismatchSimdHostFunctor {
+  using kernels        = SimdHostKernels<SimdType>;
+  using element_type   = typename kernels::value_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first1;
+  element_type const* m_first2;
+  IndexType m_num_elements;
+  ReducerType m_reducer;
+  IndexType* m_found;
+
+  void operator()(const IndexType block, red_value_type& red_value) const {
+    const IndexType begin = block * simd_host_block_size;
+    if (begin > ::Kokkos::atomic_load(m_found)) return;
+
+    const IndexType n =
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin);
+    const IndexType pos =
+        kernels::mismatch(m_first1 + begin, m_first2 + begin, n);
+    if (pos < n) {
+      ::Kokkos::atomic_min(m_found, begin + pos);
+      m_reducer.join(red_value, red_value_type{begin + pos});
+    }
+  }
+};
+
+// The default predicate on contiguous host ranges of the same type
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+inline constexpr bool is_simd_host_mismatch_v =
+    std::is_same_v<BinaryPredicateType,
+                   StdAlgoEqualBinaryPredicate<
+                       typename IteratorType1::value_type,
+                       typename IteratorType2::value_type>> &&
+    is_simd_host_range_v<
+        ExecutionSpace,
+        std::remove_const_t<typename IteratorType1::value_type>,
+        IteratorType1, IteratorType2>;
+
 //
 // exespace impl
 //
@@ -95,11 +138,27 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
   const auto num_elemen_par_reduce = (num_e1 <= num_e2) ? num_e1 : num_e2;
   reduction_value_type red_result;
   reducer_type reducer(red_result);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
-      // use CTAD
-      StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
-      reducer);
+  if constexpr (is_simd_host_mismatch_v<ExecutionSpace, IteratorType1,
+                                        IteratorType2, BinaryPredicateType>) {
+    using simd_func_t = StdMismatchSimdHostFunctor<
+        simd_host_t<ExecutionSpace,
+                    std::remove_const_t<typename IteratorType1::value_type>>,
+        index_type, reducer_type>;
+    index_type found = num_elemen_par_reduce;
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(
+            ex, 0, simd_host_num_blocks(num_elemen_par_reduce)),
+        simd_func_t{&*first1, &*first2, num_elemen_par_reduce, reducer,
+                    &found},
+        reducer);
+  } else {
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
+        // use CTAD
+        StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
+        reducer);
+  }
 
   // fence not needed because reducing into scalar
 
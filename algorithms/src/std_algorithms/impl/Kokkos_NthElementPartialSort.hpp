@@ -0,0 +1,334 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_NTH_ELEMENT_PARTIAL_SORT_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_NTH_ELEMENT_PARTIAL_SORT_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Move.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <sorting/Kokkos_SortPublicAPI.hpp>
+#include <sorting/Kokkos_NestedSortPublicAPI.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// below this size the remaining range is sorted by a single thread
+inline constexpr std::ptrdiff_t nth_element_serial_cutoff = 32;
+
+// median of the first, middle and last elements of [lo, hi)
+template <class IteratorType, class PivotViewType, class ComparatorType>
+struct StdNthElementPivotFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  index_type m_lo;
+  index_type m_hi;
+  PivotViewType m_pivot;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type) const {
+    const auto& a = m_first[m_lo];
+    const auto& b = m_first[m_lo + (m_hi - m_lo) / 2];
+    const auto& c = m_first[m_hi - 1];
+    if (m_comp(a, b)) {
+      m_pivot() = m_comp(b, c) ? b : (m_comp(a, c) ? c : a);
+    } else {
+      m_pivot() = m_comp(a, c) ? a : (m_comp(b, c) ? c : b);
+    }
+  }
+};
+
+// Copies [lo, hi) to the same positions of the tmp range, with the elements
+// going left first (in order) and the other ones after them (in reverse
+// order).  With IsStrict an element goes left if it is less than the pivot,
+// otherwise if it is not greater.
+template <bool IsStrict, class IteratorType, class TmpIteratorType,
+          class PivotViewType, class ComparatorType>
+struct StdNthElementPartitionFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  TmpIteratorType m_tmp_first;
+  index_type m_lo;
+  index_type m_hi;
+  PivotViewType m_pivot;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i, index_type& update,
+                  const bool final_pass) const {
+    const auto& myval = m_first[m_lo + i];
+    const bool goes_left =
+        IsStrict ? m_comp(myval, m_pivot()) : !m_comp(m_pivot(), myval);
+    if (final_pass) {
+      if (goes_left) {
+        m_tmp_first[m_lo + update] = myval;
+      } else {
+        m_tmp_first[m_hi - 1 - (i - update)] = myval;
+      }
+    }
+    if (goes_left) {
+      update += 1;
+    }
+  }
+};
+
+template <class IteratorType, class ComparatorType>
+struct StdInsertionSortFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  IteratorType m_last;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type) const {
+    for (IteratorType it = m_first; it != m_last; ++it) {
+      auto value       = std::move(*it);
+      IteratorType pos = it;
+      for (; pos != m_first && m_comp(value, *(pos - 1)); --pos) {
+        *pos = std::move(*(pos - 1));
+      }
+      *pos = std::move(value);
+    }
+  }
+};
+
+//
+// exespace impl
+//
+// Parallel quickselect: every round picks a pivot, partitions the range
+// still containing nth with a scan and keeps the side containing it.  When
+// no element is less than the pivot, the elements equivalent to it are
+// split off instead so that every round makes progress.
+//
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void nth_element_exespace_impl(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType nth, IteratorType last,
+                               ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, nth);
+  Impl::expect_valid_range(nth, last);
+
+  if (nth == last) {
+    return;
+  }
+
+  // aliases
+  using index_type        = typename IteratorType::difference_type;
+  using value_type        = typename IteratorType::value_type;
+  using tmp_view_type     = Kokkos::View<value_type*, ExecutionSpace>;
+  using pivot_view_type   = Kokkos::View<value_type, ExecutionSpace>;
+  using tmp_iterator_type = decltype(begin(std::declval<tmp_view_type>()));
+
+  using pivot_func_t =
+      StdNthElementPivotFunctor<IteratorType, pivot_view_type, ComparatorType>;
+  using less_func_t =
+      StdNthElementPartitionFunctor<true, IteratorType, tmp_iterator_type,
+                                    pivot_view_type, ComparatorType>;
+  using equal_func_t =
+      StdNthElementPartitionFunctor<false, IteratorType, tmp_iterator_type,
+                                    pivot_view_type, ComparatorType>;
+  using move_func_t =
+      StdMoveFunctor<index_type, tmp_iterator_type, IteratorType>;
+  using sort_func_t = StdInsertionSortFunctor<IteratorType, ComparatorType>;
+
+  const index_type n = Kokkos::Experimental::distance(first, last);
+  const index_type k = Kokkos::Experimental::distance(first, nth);
+  index_type lo      = 0;
+  index_type hi      = n;
+
+  if (hi - lo > nth_element_serial_cutoff) {
+    tmp_view_type tmp_view(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                              "std_nth_element_tmp_view"),
+                           n);
+    pivot_view_type pivot(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                             "std_nth_element_pivot"));
+    auto tmp_first = ::Kokkos::Experimental::begin(tmp_view);
+
+    while (hi - lo > nth_element_serial_cutoff) {
+      ::Kokkos::parallel_for("nth_element_pivot",
+                             RangePolicy<ExecutionSpace>(ex, 0, 1),
+                             pivot_func_t{first, lo, hi, pivot, comp});
+
+      index_type num_less = 0;
+      ::Kokkos::parallel_scan(
+          label, RangePolicy<ExecutionSpace>(ex, 0, hi - lo),
+          less_func_t{first, tmp_first, lo, hi, pivot, comp}, num_less);
+
+      index_type num_equal = 0;
+      if (num_less == 0) {
+        // the pivot is a minimum of the range, split off its equivalents
+        ::Kokkos::parallel_scan(
+            label, RangePolicy<ExecutionSpace>(ex, 0, hi - lo),
+            equal_func_t{first, tmp_first, lo, hi, pivot, comp}, num_equal);
+      }
+
+      ::Kokkos::parallel_for("nth_element_move_back",
+                             RangePolicy<ExecutionSpace>(ex, 0, hi - lo),
+                             move_func_t(tmp_first + lo, first + lo));
+
+      if (num_less == 0) {
+        if (k < lo + num_equal) {
+          // nth is among elements equivalent to each other, done
+          ex.fence("Kokkos::nth_element: fence after operation");
+          return;
+        }
+        lo += num_equal;
+      } else if (k < lo + num_less) {
+        hi = lo + num_less;
+      } else {
+        lo += num_less;
+      }
+    }
+  }
+
+  ::Kokkos::parallel_for("nth_element_sort_remainder",
+                         RangePolicy<ExecutionSpace>(ex, 0, 1),
+                         sort_func_t{first + lo, first + hi, comp});
+  ex.fence("Kokkos::nth_element: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void nth_element_exespace_impl(const std::string& label,
+                               const ExecutionSpace& ex, IteratorType first,
+                               IteratorType nth, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  nth_element_exespace_impl(label, ex, first, nth, last, comp_t());
+}
+
+// subview of the View iterated over by [first, last)
+template <class IteratorType>
+KOKKOS_FUNCTION auto iterator_range_subview(IteratorType first,
+                                            IteratorType last) {
+  const auto view         = first.view();
+  const std::size_t begin = first - IteratorType(view);
+  const std::size_t end   = last - IteratorType(view);
+  return Kokkos::subview(view,
+                         Kokkos::pair<std::size_t, std::size_t>(begin, end));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void partial_sort_exespace_impl(const std::string& label,
+                                const ExecutionSpace& ex, IteratorType first,
+                                IteratorType middle, IteratorType last,
+                                ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  if (first == middle) {
+    return;
+  }
+
+  // select the smallest elements, then sort them
+  if (middle != last) {
+    nth_element_exespace_impl(label, ex, first, middle, last, comp);
+  }
+  ::Kokkos::sort(ex, iterator_range_subview(first, middle), comp);
+  ex.fence("Kokkos::partial_sort: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void partial_sort_exespace_impl(const std::string& label,
+                                const ExecutionSpace& ex, IteratorType first,
+                                IteratorType middle, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  partial_sort_exespace_impl(label, ex, first, middle, last, comp_t());
+}
+
+//
+// team impl
+//
+// FIXME: without an auxiliary allocation the selection cannot be done at
+// the team level, so the whole range is sorted with the team sort
+//
+template <class TeamHandleType, class IteratorType, class ComparatorType>
+KOKKOS_FUNCTION void nth_element_team_impl(const TeamHandleType& teamHandle,
+                                           IteratorType first,
+                                           IteratorType nth, IteratorType last,
+                                           ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, nth);
+  Impl::expect_valid_range(nth, last);
+
+  if (nth == last) {
+    return;
+  }
+
+  ::Kokkos::Experimental::sort_team(
+      teamHandle, iterator_range_subview(first, last), comp);
+  teamHandle.team_barrier();
+}
+
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION void nth_element_team_impl(const TeamHandleType& teamHandle,
+                                           IteratorType first,
+                                           IteratorType nth,
+                                           IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  nth_element_team_impl(teamHandle, first, nth, last, comp_t());
+}
+
+template <class TeamHandleType, class IteratorType, class ComparatorType>
+KOKKOS_FUNCTION void partial_sort_team_impl(const TeamHandleType& teamHandle,
+                                            IteratorType first,
+                                            IteratorType middle,
+                                            IteratorType last,
+                                            ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  if (first == middle) {
+    return;
+  }
+
+  ::Kokkos::Experimental::sort_team(
+      teamHandle, iterator_range_subview(first, last), comp);
+  teamHandle.team_barrier();
+}
+
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION void partial_sort_team_impl(const TeamHandleType& teamHandle,
+                                            IteratorType first,
+                                            IteratorType middle,
+                                            IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  partial_sort_team_impl(teamHandle, first, middle, last, comp_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,184 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_PARTITION_STABLE_PARTITION_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_PARTITION_STABLE_PARTITION_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_CountCountIf.hpp"
+#include "Kokkos_Merge.hpp"
+#include "Kokkos_Move.hpp"
+#include "Kokkos_PartitionCopy.hpp"
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType partition_point_sequential(IteratorType first,
+                                                        IteratorType last,
+                                                        PredicateType pred) {
+  auto count = last - first;
+  while (count > 0) {
+    const auto step = count / 2;
+    const auto it   = first + step;
+    if (pred(*it)) {
+      first = it + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class IteratorType, class PredicateType>
+IteratorType stable_partition_exespace_impl(const std::string& label,
+                                            const ExecutionSpace& ex,
+                                            IteratorType first,
+                                            IteratorType last,
+                                            PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return first;
+  }
+
+  // step 1: count the elements satisfying pred
+  const auto num_true = Impl::count_if_exespace_impl(
+      "Kokkos::count_if_from_stable_partition", ex, first, last, pred);
+
+  // step 2: partition_copy into a tmp view, the elements satisfying pred
+  // go in front, the others right after them
+  using value_type    = typename IteratorType::value_type;
+  using tmp_view_type = Kokkos::View<value_type*, ExecutionSpace>;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  tmp_view_type tmp_view(Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                                            "std_stable_partition_tmp_view"),
+                         num_elements);
+  auto tmp_first = ::Kokkos::Experimental::begin(tmp_view);
+  [[maybe_unused]] auto unused_r = Impl::partition_copy_exespace_impl(
+      label, ex, first, last, tmp_first, tmp_first + num_true,
+      std::move(pred));
+
+  // step 3: move back
+  using index_type = typename IteratorType::difference_type;
+  using func_t = StdMoveFunctor<index_type, decltype(tmp_first), IteratorType>;
+  ::Kokkos::parallel_for("stable_partition_move_back",
+                         RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                         func_t(tmp_first, first));
+  ex.fence("Kokkos::stable_partition: fence after operation");
+
+  return first + num_true;
+}
+
+// the parallel implementation is stable anyway
+template <class ExecutionSpace, class IteratorType, class PredicateType>
+IteratorType partition_exespace_impl(const std::string& label,
+                                     const ExecutionSpace& ex,
+                                     IteratorType first, IteratorType last,
+                                     PredicateType pred) {
+  return stable_partition_exespace_impl(label, ex, first, last,
+                                        std::move(pred));
+}
+
+//
+// team impl
+//
+template <class TeamHandleType, class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType partition_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // FIXME: for the execution-space-based impl we used an auxiliary
+  // allocation, but for the team level we cannot do the same, so do this
+  // serially for now and later figure out if this can be done in parallel
+  std::size_t count = 0;
+  Kokkos::single(
+      Kokkos::PerTeam(teamHandle),
+      [=](std::size_t& lcount) {
+        IteratorType result = first;
+        for (IteratorType it = first; it != last; ++it) {
+          if (pred(*it)) {
+            if (it != result) {
+              ::Kokkos::kokkos_swap(*it, *result);
+            }
+            ++result;
+          }
+        }
+        lcount = Kokkos::Experimental::distance(first, result);
+      },
+      count);
+  // no barrier needed since single above broadcasts to all members
+
+  return first + count;
+}
+
+template <class TeamHandleType, class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType stable_partition_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // FIXME: same as partition, serial for now.  Without a buffer, adjacent
+  // partitioned blocks of doubling size are merged by rotating the elements
+  // not satisfying pred of the left block past the ones satisfying pred of
+  // the right block, O(n log(n)) swaps.
+  std::size_t count = 0;
+  Kokkos::single(
+      Kokkos::PerTeam(teamHandle),
+      [=](std::size_t& lcount) {
+        using index_type              = typename IteratorType::difference_type;
+        const index_type num_elements = last - first;
+        for (index_type width = 1; width < num_elements; width *= 2) {
+          for (index_type block = 0; block + width < num_elements;
+               block += 2 * width) {
+            const auto middle = first + (block + width);
+            const auto end    = first + Kokkos::min(block + 2 * width,
+                                                    num_elements);
+            rotate_sequential(
+                partition_point_sequential(first + block, middle, pred),
+                middle, partition_point_sequential(middle, end, pred));
+          }
+        }
+        lcount = Kokkos::Experimental::distance(
+            first, partition_point_sequential(first, last, pred));
+      },
+      count);
+  // no barrier needed since single above broadcasts to all members
+
+  return first + count;
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -21,6 +21,7 @@
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
 #include "Kokkos_ReducerWithArbitraryJoinerNoNeutralElement.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -48,6 +49,22 @@ struct StdReduceDefaultJoinFunctor {
   }
 };
 
+template <class SimdType, class IndexType>
+struct StdReduceDefaultSimdHostFunctor {
+  using kernels      = SimdHostKernels<SimdType>;
+  using element_type = typename kernels::value_type;
+
+  element_type const* m_first;
+  IndexType m_num_elements;
+
+  void operator()(const IndexType block, element_type& update) const {
+    const IndexType begin = block * simd_host_block_size;
+    update += kernels::sum(
+        m_first + begin,
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin));
+  }
+};
+
 template <class IteratorType, class ReducerType>
 struct StdReduceFunctor {
   using red_value_type = typename ReducerType::value_type;
@@ -138,9 +155,21 @@ ValueType reduce_default_functors_exespace_impl(
     // run
     value_type tmp;
     const auto num_elements = Kokkos::Experimental::distance(first, last);
-    ::Kokkos::parallel_reduce(label,
-                              RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-                              functor_type{first}, tmp);
+    if constexpr (is_simd_host_range_v<ExecutionSpace, value_type,
+                                       IteratorType>) {
+      using simd_functor_type = StdReduceDefaultSimdHostFunctor<
+          simd_host_t<ExecutionSpace, value_type>,
+          typename IteratorType::difference_type>;
+      ::Kokkos::parallel_reduce(
+          label,
+          RangePolicy<ExecutionSpace>(ex, 0,
+                                      simd_host_num_blocks(num_elements)),
+          simd_functor_type{&*first, num_elements}, tmp);
+    } else {
+      ::Kokkos::parallel_reduce(
+          label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+          functor_type{first}, tmp);
+    }
     // fence not needed since reducing into scalar
     tmp += init_reduction_value;
     return tmp;
@@ -0,0 +1,277 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_REDUCE_BY_KEY_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_REDUCE_BY_KEY_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_ScanByKey.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// the segmented scan reaches the reduction of a whole segment at its last
+// element, which is written at the position given by the number of
+// segment heads seen so far: no separate compaction pass is needed.
+// The key written for a segment is the one of its first element.
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class KeysDestIteratorType, class ValuesDestIteratorType,
+          class PredicateType, class BinaryOpType>
+struct ReduceByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = SegmentedScanValue<ValueType, IndexType>;
+
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  KeysDestIteratorType m_keys_dest;
+  ValuesDestIteratorType m_values_dest;
+  IndexType m_num_elements;
+  PredicateType m_pred;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  ReduceByKeyFunctor(KeysIteratorType keys_first,
+                     ValuesIteratorType values_first,
+                     KeysDestIteratorType keys_dest,
+                     ValuesDestIteratorType values_dest,
+                     IndexType num_elements, PredicateType pred,
+                     BinaryOpType binary_op)
+      : m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_keys_dest(std::move(keys_dest)),
+        m_values_dest(std::move(values_dest)),
+        m_num_elements(num_elements),
+        m_pred(std::move(pred)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    const bool head = is_segment_head(m_keys_first, i, m_pred);
+    this->join(update,
+               value_type{m_values_first[i], IndexType(head), head, false});
+
+    if (final_pass) {
+      if (head) {
+        m_keys_dest[update.num_segments - 1] = m_keys_first[i];
+      }
+      const bool tail = i + 1 == m_num_elements ||
+                        !m_pred(m_keys_first[i], m_keys_first[i + 1]);
+      if (tail) {
+        m_values_dest[update.num_segments - 1] = update.val;
+      }
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const { update = value_type{}; }
+
+  KOKKOS_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType, class PredicateType,
+          class BinaryOpType>
+::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                            KeysIteratorType keys_first,
+                            KeysIteratorType keys_last,
+                            ValuesIteratorType values_first,
+                            KeysDestIteratorType keys_dest,
+                            ValuesDestIteratorType values_dest,
+                            PredicateType pred, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(
+      ex, keys_first, values_first, keys_dest, values_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, keys_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(keys_dest,
+                                                              values_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using func_type =
+      ReduceByKeyFunctor<ExecutionSpace, index_type, value_type,
+                         KeysIteratorType, ValuesIteratorType,
+                         KeysDestIteratorType, ValuesDestIteratorType,
+                         PredicateType, BinaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  typename func_type::value_type total;
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      func_type(keys_first, values_first, keys_dest, values_dest, num_elements,
+                std::move(pred), std::move(binary_op)),
+      total);
+  // fence not needed because of the scan accumulating into total
+
+  // return
+  return {keys_dest + total.num_segments, values_dest + total.num_segments};
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType>
+::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                            KeysIteratorType keys_first,
+                            KeysIteratorType keys_last,
+                            ValuesIteratorType values_first,
+                            KeysDestIteratorType keys_dest,
+                            ValuesDestIteratorType values_dest) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return reduce_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, keys_dest, values_dest,
+      StdAlgoEqualBinaryPredicate<key_type>(),
+      StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType, class PredicateType>
+::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_exespace_impl(const std::string& label, const ExecutionSpace& ex,
+                            KeysIteratorType keys_first,
+                            KeysIteratorType keys_last,
+                            ValuesIteratorType values_first,
+                            KeysDestIteratorType keys_dest,
+                            ValuesDestIteratorType values_dest,
+                            PredicateType pred) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return reduce_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, keys_dest, values_dest,
+      std::move(pred), StdReduceDefaultJoinFunctor<value_type>());
+}
+
+//
+// team impl
+//
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType, class PredicateType,
+          class BinaryOpType>
+KOKKOS_FUNCTION ::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_team_impl(const TeamHandleType& teamHandle,
+                        KeysIteratorType keys_first, KeysIteratorType keys_last,
+                        ValuesIteratorType values_first,
+                        KeysDestIteratorType keys_dest,
+                        ValuesDestIteratorType values_dest,
+                        PredicateType pred, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(
+      teamHandle, keys_first, values_first, keys_dest, values_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, keys_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(keys_dest,
+                                                              values_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+
+  // FIXME: same as inclusive_scan_by_key, serial for now
+  std::size_t count = 0;
+  Kokkos::single(
+      Kokkos::PerTeam(teamHandle),
+      [=](std::size_t& lcount) {
+        lcount = 0;
+        value_type update{};
+        for (index_type i = 0; i < num_elements; ++i) {
+          if (is_segment_head(keys_first, i, pred)) {
+            if (i > 0) {
+              values_dest[lcount++] = update;
+            }
+            keys_dest[lcount] = keys_first[i];
+            update            = values_first[i];
+          } else {
+            update = binary_op(update, values_first[i]);
+          }
+        }
+        if (num_elements > 0) {
+          values_dest[lcount++] = update;
+        }
+      },
+      count);
+  // no barrier needed since single above broadcasts to all members
+
+  return {keys_dest + count, values_dest + count};
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType>
+KOKKOS_FUNCTION ::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_team_impl(const TeamHandleType& teamHandle,
+                        KeysIteratorType keys_first, KeysIteratorType keys_last,
+                        ValuesIteratorType values_first,
+                        KeysDestIteratorType keys_dest,
+                        ValuesDestIteratorType values_dest) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return reduce_by_key_team_impl(teamHandle, keys_first, keys_last,
+                                 values_first, keys_dest, values_dest,
+                                 StdAlgoEqualBinaryPredicate<key_type>(),
+                                 StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class KeysDestIteratorType,
+          class ValuesDestIteratorType, class PredicateType>
+KOKKOS_FUNCTION ::Kokkos::pair<KeysDestIteratorType, ValuesDestIteratorType>
+reduce_by_key_team_impl(const TeamHandleType& teamHandle,
+                        KeysIteratorType keys_first, KeysIteratorType keys_last,
+                        ValuesIteratorType values_first,
+                        KeysDestIteratorType keys_dest,
+                        ValuesDestIteratorType values_dest,
+                        PredicateType pred) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return reduce_by_key_team_impl(teamHandle, keys_first, keys_last,
+                                 values_first, keys_dest, values_dest,
+                                 std::move(pred),
+                                 StdReduceDefaultJoinFunctor<value_type>());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,439 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SCAN_BY_KEY_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_SCAN_BY_KEY_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Reduce.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// value of a segmented scan: a run of consecutive equal keys is a segment,
+// and the scan restarts at the first element of every segment.
+// Joining (a, a_has_head) with (b, b_has_head) gives
+// (b_has_head ? b : op(a, b), a_has_head || b_has_head), which is
+// associative, so the whole operation is a single parallel_scan.
+// num_segments counts the segment heads seen, which is the output
+// position of the current segment for reduce_by_key.
+//
+template <class ValueType, class IndexType>
+struct SegmentedScanValue {
+  ValueType val;
+  IndexType num_segments = 0;
+  bool has_head          = false;
+  bool is_initial        = true;
+};
+
+template <class ValueType, class IndexType, class BinaryOpType>
+KOKKOS_FUNCTION void segmented_scan_join(
+    SegmentedScanValue<ValueType, IndexType>& update,
+    const SegmentedScanValue<ValueType, IndexType>& input,
+    const BinaryOpType& binary_op) {
+  if (input.is_initial) return;
+
+  if (update.is_initial || input.has_head) {
+    update.val = input.val;
+  } else {
+    update.val = binary_op(update.val, input.val);
+  }
+  update.num_segments += input.num_segments;
+  update.has_head   = update.has_head || input.has_head;
+  update.is_initial = false;
+}
+
+template <class IndexType, class KeysIteratorType, class PredicateType>
+KOKKOS_FUNCTION bool is_segment_head(const KeysIteratorType& keys_first,
+                                     const IndexType i,
+                                     const PredicateType& pred) {
+  return i == 0 || !pred(keys_first[i - 1], keys_first[i]);
+}
+
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class OutputIteratorType, class PredicateType, class BinaryOpType>
+struct InclusiveScanByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = SegmentedScanValue<ValueType, IndexType>;
+
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  OutputIteratorType m_first_dest;
+  PredicateType m_pred;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  InclusiveScanByKeyFunctor(KeysIteratorType keys_first,
+                            ValuesIteratorType values_first,
+                            OutputIteratorType first_dest, PredicateType pred,
+                            BinaryOpType binary_op)
+      : m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_first_dest(std::move(first_dest)),
+        m_pred(std::move(pred)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    const bool head = is_segment_head(m_keys_first, i, m_pred);
+    this->join(update,
+               value_type{m_values_first[i], IndexType(head), head, false});
+
+    if (final_pass) {
+      m_first_dest[i] = update.val;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const { update = value_type{}; }
+
+  KOKKOS_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class OutputIteratorType, class PredicateType, class BinaryOpType>
+struct ExclusiveScanByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = SegmentedScanValue<ValueType, IndexType>;
+
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  OutputIteratorType m_first_dest;
+  ValueType m_init_value;
+  PredicateType m_pred;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  ExclusiveScanByKeyFunctor(KeysIteratorType keys_first,
+                            ValuesIteratorType values_first,
+                            OutputIteratorType first_dest, ValueType init,
+                            PredicateType pred, BinaryOpType binary_op)
+      : m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_first_dest(std::move(first_dest)),
+        m_init_value(std::move(init)),
+        m_pred(std::move(pred)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    // the init value is folded into the first element of every segment
+    const bool head = is_segment_head(m_keys_first, i, m_pred);
+    const ValueType tmp =
+        head ? m_binary_op(m_init_value, m_values_first[i])
+             : ValueType(m_values_first[i]);
+
+    if (final_pass) {
+      m_first_dest[i] = head ? m_init_value : update.val;
+    }
+
+    this->join(update, value_type{tmp, IndexType(head), head, false});
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const { update = value_type{}; }
+
+  KOKKOS_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+//
+// exespace impl
+//
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class PredicateType, class BinaryOpType>
+OutputIteratorType inclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    PredicateType pred, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using func_type =
+      InclusiveScanByKeyFunctor<ExecutionSpace, index_type, value_type,
+                                KeysIteratorType, ValuesIteratorType,
+                                OutputIteratorType, PredicateType,
+                                BinaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      func_type(keys_first, values_first, first_dest, std::move(pred),
+                std::move(binary_op)));
+  ex.fence("Kokkos::inclusive_scan_by_key: fence after operation");
+
+  // return
+  return first_dest + num_elements;
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType>
+OutputIteratorType inclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return inclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest,
+      StdAlgoEqualBinaryPredicate<key_type>(),
+      StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class PredicateType>
+OutputIteratorType inclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    PredicateType pred) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return inclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest,
+      std::move(pred), StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class PredicateType, class BinaryOpType>
+OutputIteratorType exclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value, PredicateType pred, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using func_type =
+      ExclusiveScanByKeyFunctor<ExecutionSpace, index_type, ValueType,
+                                KeysIteratorType, ValuesIteratorType,
+                                OutputIteratorType, PredicateType,
+                                BinaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      func_type(keys_first, values_first, first_dest, std::move(init_value),
+                std::move(pred), std::move(binary_op)));
+  ex.fence("Kokkos::exclusive_scan_by_key: fence after operation");
+
+  // return
+  return first_dest + num_elements;
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType>
+OutputIteratorType exclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  return exclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest,
+      std::move(init_value), StdAlgoEqualBinaryPredicate<key_type>(),
+      StdReduceDefaultJoinFunctor<ValueType>());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class PredicateType>
+OutputIteratorType exclusive_scan_by_key_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value, PredicateType pred) {
+  return exclusive_scan_by_key_exespace_impl(
+      label, ex, keys_first, keys_last, values_first, first_dest,
+      std::move(init_value), std::move(pred),
+      StdReduceDefaultJoinFunctor<ValueType>());
+}
+
+//
+// team impl
+//
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class PredicateType, class BinaryOpType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, PredicateType pred,
+    BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+
+  // FIXME: a team-level parallel_scan cannot take the custom join of the
+  // segmented scan, so do this serially for now
+  Kokkos::single(Kokkos::PerTeam(teamHandle), [=]() {
+    value_type update{};
+    for (index_type i = 0; i < num_elements; ++i) {
+      update = is_segment_head(keys_first, i, pred)
+                   ? value_type(values_first[i])
+                   : binary_op(update, values_first[i]);
+      first_dest[i] = update;
+    }
+  });
+  teamHandle.team_barrier();
+
+  return first_dest + num_elements;
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return inclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest,
+      StdAlgoEqualBinaryPredicate<key_type>(),
+      StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class PredicateType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, PredicateType pred) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  return inclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest,
+      std::move(pred), StdReduceDefaultJoinFunctor<value_type>());
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class PredicateType, class BinaryOpType>
+KOKKOS_FUNCTION OutputIteratorType exclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, ValueType init_value, PredicateType pred,
+    BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  using index_type = typename KeysIteratorType::difference_type;
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+
+  // FIXME: same as inclusive_scan_by_key, serial for now
+  Kokkos::single(Kokkos::PerTeam(teamHandle), [=]() {
+    ValueType update = init_value;
+    for (index_type i = 0; i < num_elements; ++i) {
+      if (is_segment_head(keys_first, i, pred)) {
+        update = init_value;
+      }
+      // read before writing, the output can alias the values
+      const ValueType tmp = binary_op(update, values_first[i]);
+      first_dest[i]       = update;
+      update              = tmp;
+    }
+  });
+  teamHandle.team_barrier();
+
+  return first_dest + num_elements;
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType>
+KOKKOS_FUNCTION OutputIteratorType exclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, ValueType init_value) {
+  using key_type = std::remove_const_t<typename KeysIteratorType::value_type>;
+  return exclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest,
+      std::move(init_value), StdAlgoEqualBinaryPredicate<key_type>(),
+      StdReduceDefaultJoinFunctor<ValueType>());
+}
+
+template <class TeamHandleType, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class PredicateType>
+KOKKOS_FUNCTION OutputIteratorType exclusive_scan_by_key_team_impl(
+    const TeamHandleType& teamHandle, KeysIteratorType keys_first,
+    KeysIteratorType keys_last, ValuesIteratorType values_first,
+    OutputIteratorType first_dest, ValueType init_value, PredicateType pred) {
+  return exclusive_scan_by_key_team_impl(
+      teamHandle, keys_first, keys_last, values_first, first_dest,
+      std::move(init_value), std::move(pred),
+      StdReduceDefaultJoinFunctor<ValueType>());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
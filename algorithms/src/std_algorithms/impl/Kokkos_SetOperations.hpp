@@ -0,0 +1,222 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SET_OPERATIONS_IMPL_HPP
+#define KOKKOS_STD_ALGORITHMS_SET_OPERATIONS_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Merge.hpp"
+#include "Kokkos_MustUseKokkosSingleInTeam.hpp"
+#include <std_algorithms/Kokkos_Distance.hpp>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+enum class StdSetOperation { Union, Intersection, Difference };
+
+// The inputs are cut in merge path chunks, moved to value boundaries so
+// that equivalent elements of both ranges fall in the same chunk.  Every
+// chunk then applies the sequential set operation, a scan over the number
+// of elements each chunk produces gives where to write them.
+template <StdSetOperation Operation, class IndexType, class IteratorType1,
+          class IteratorType2, class OutputIteratorType, class ComparatorType>
+struct StdSetOperationFunctor {
+  IteratorType1 m_first1;
+  IteratorType2 m_first2;
+  OutputIteratorType m_dest_first;
+  IndexType m_n1;
+  IndexType m_n2;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  StdSetOperationFunctor(IteratorType1 first1, IndexType n1,
+                         IteratorType2 first2, IndexType n2,
+                         OutputIteratorType dest_first, ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_first2(std::move(first2)),
+        m_dest_first(std::move(dest_first)),
+        m_n1(n1),
+        m_n2(n2),
+        m_comp(std::move(comp)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType chunk, IndexType& update,
+                  const bool final_pass) const {
+    const IndexType total = m_n1 + m_n2;
+    const IndexType diag_begin =
+        Kokkos::min(IndexType(chunk * merge_path_chunk_size), total);
+    const IndexType diag_end =
+        Kokkos::min(IndexType(diag_begin + merge_path_chunk_size), total);
+
+    const auto split_begin = merge_path_split_at_value(
+        m_first1, m_n1, m_first2, m_n2, diag_begin, m_comp);
+    const auto split_end = merge_path_split_at_value(
+        m_first1, m_n1, m_first2, m_n2, diag_end, m_comp);
+
+    IndexType i       = split_begin.first;
+    IndexType j       = split_begin.second;
+    const auto i_end  = split_end.first;
+    const auto j_end  = split_end.second;
+    IndexType count   = 0;
+    const auto output = [&](const auto& value) {
+      if (final_pass) {
+        m_dest_first[update + count] = value;
+      }
+      ++count;
+    };
+
+    while (i < i_end && j < j_end) {
+      if (m_comp(m_first1[i], m_first2[j])) {
+        if constexpr (Operation != StdSetOperation::Intersection) {
+          output(m_first1[i]);
+        }
+        ++i;
+      } else if (m_comp(m_first2[j], m_first1[i])) {
+        if constexpr (Operation == StdSetOperation::Union) {
+          output(m_first2[j]);
+        }
+        ++j;
+      } else {
+        if constexpr (Operation != StdSetOperation::Difference) {
+          output(m_first1[i]);
+        }
+        ++i;
+        ++j;
+      }
+    }
+    if constexpr (Operation != StdSetOperation::Intersection) {
+      for (; i < i_end; ++i) output(m_first1[i]);
+    }
+    if constexpr (Operation == StdSetOperation::Union) {
+      for (; j < j_end; ++j) output(m_first2[j]);
+    }
+
+    update += count;
+  }
+};
+
+template <StdSetOperation Operation, class ExecutionSpace, class IteratorType1,
+          class IteratorType2, class OutputIteratorType, class ComparatorType>
+OutputIteratorType set_operation_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t =
+      StdSetOperationFunctor<Operation, index_type, IteratorType1,
+                             IteratorType2, OutputIteratorType, ComparatorType>;
+
+  // run
+  const auto n1    = Kokkos::Experimental::distance(first1, last1);
+  const auto n2    = Kokkos::Experimental::distance(first2, last2);
+  index_type count = 0;
+  ::Kokkos::parallel_scan(
+      label,
+      RangePolicy<ExecutionSpace>(ex, 0, merge_path_num_chunks(n1 + n2)),
+      func_t(first1, n1, first2, n2, d_first, std::move(comp)), count);
+
+  // fence not needed because of the scan accumulating into count
+  return d_first + count;
+}
+
+template <StdSetOperation Operation, class ExecutionSpace, class IteratorType1,
+          class IteratorType2, class OutputIteratorType>
+OutputIteratorType set_operation_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first) {
+  using value_type = std::remove_const_t<typename IteratorType1::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return set_operation_exespace_impl<Operation>(
+      label, ex, first1, last1, first2, last2, d_first, comp_t());
+}
+
+template <StdSetOperation Operation, class TeamHandleType, class IteratorType1,
+          class IteratorType2, class OutputIteratorType, class ComparatorType>
+KOKKOS_FUNCTION OutputIteratorType set_operation_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t =
+      StdSetOperationFunctor<Operation, index_type, IteratorType1,
+                             IteratorType2, OutputIteratorType, ComparatorType>;
+
+  const auto n1         = Kokkos::Experimental::distance(first1, last1);
+  const auto n2         = Kokkos::Experimental::distance(first2, last2);
+  const auto num_chunks = merge_path_num_chunks(n1 + n2);
+  const func_t functor(first1, n1, first2, n2, d_first, std::move(comp));
+
+  index_type count = 0;
+  if constexpr (stdalgo_must_use_kokkos_single_for_team_scan_v<
+                    typename TeamHandleType::execution_space>) {
+    Kokkos::single(
+        Kokkos::PerTeam(teamHandle),
+        [=](index_type& lcount) {
+          lcount = 0;
+          for (index_type chunk = 0; chunk < num_chunks; ++chunk) {
+            functor(chunk, lcount, true);
+          }
+        },
+        count);
+    // no barrier needed since single above broadcasts to all members
+  } else {
+    ::Kokkos::parallel_scan(TeamThreadRange(teamHandle, 0, num_chunks),
+                            functor, count);
+    // no barrier needed because of the scan accumulating into count
+  }
+  return d_first + count;
+}
+
+template <StdSetOperation Operation, class TeamHandleType, class IteratorType1,
+          class IteratorType2, class OutputIteratorType>
+KOKKOS_FUNCTION OutputIteratorType set_operation_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first) {
+  using value_type = std::remove_const_t<typename IteratorType1::value_type>;
+  using comp_t     = StdAlgoLessThanBinaryPredicate<value_type>;
+  return set_operation_team_impl<Operation>(teamHandle, first1, last1, first2,
+                                            last2, d_first, comp_t());
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,279 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SIMD_HOST_FAST_PATH_HPP
+#define KOKKOS_STD_ALGORITHMS_SIMD_HOST_FAST_PATH_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+#include "Kokkos_RandomAccessIterator.hpp"
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+// Host fast paths for the std algorithms: when the range is a contiguous
+// host View of a type the native simd ABI supports, every iteration of the
+// parallel kernel processes a block of simd_host_block_size elements with
+// simd loads instead of a single element through the iterator.
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Large enough to amortize the per-iteration cost of the dispatch, small
+// enough that the two passes of the min/max kernels hit in L1.
+inline constexpr std::ptrdiff_t simd_host_block_size = 2048;
+
+template <class T, class DataTypes>
+struct is_simd_host_data_type : std::false_type {};
+
+template <class T, class... Ts>
+struct is_simd_host_data_type<T, data_types<Ts...>>
+    : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+// Iterators over contiguous host Views of ValueType qualify, provided
+// ExecutionSpace has a native simd ABI supporting ValueType. Without one the
+// blocked kernels are slower than the element-wise implementations.
+template <class ExecutionSpace, class ValueType, class IteratorType>
+struct is_simd_host_iterator : std::false_type {};
+
+template <class ExecutionSpace, class ValueType, class DataType,
+          class... Properties>
+struct is_simd_host_iterator<
+    ExecutionSpace, ValueType,
+    RandomAccessIterator<::Kokkos::View<DataType, Properties...>>> {
+ private:
+  using view_type = ::Kokkos::View<DataType, Properties...>;
+
+ public:
+  // rank 1 LayoutLeft and LayoutRight are contiguous, atomic and other
+  // proxy references rule out plain loads
+  static constexpr bool value =
+      std::is_same_v<typename ExecutionSpace::memory_space,
+                     ::Kokkos::HostSpace> &&
+      !std::is_same_v<simd_abi::ForSpace<ExecutionSpace>, simd_abi::scalar> &&
+      !std::is_same_v<typename view_type::array_layout,
+                      ::Kokkos::LayoutStride> &&
+      std::is_same_v<typename view_type::reference_type,
+                     typename view_type::value_type&> &&
+      std::is_same_v<typename view_type::non_const_value_type, ValueType> &&
+      is_simd_host_data_type<ValueType, data_type_set>::value;
+};
+
+template <class ExecutionSpace, class ValueType, class... IteratorTypes>
+inline constexpr bool is_simd_host_range_v =
+    (is_simd_host_iterator<ExecutionSpace, ValueType, IteratorTypes>::value &&
+     ...);
+
+template <class ExecutionSpace, class ValueType>
+using simd_host_t = simd<ValueType, simd_abi::ForSpace<ExecutionSpace>>;
+
+template <class SimdType>
+using simd_less_t =
+    decltype(std::declval<SimdType const&>() < std::declval<SimdType const&>());
+
+template <class SimdType>
+using simd_multiplies_t =
+    decltype(std::declval<SimdType const&>() * std::declval<SimdType const&>());
+
+// is_simd_host_range_v, also requiring the simd type to support Op
+template <template <class> class Op, class ExecutionSpace, class ValueType,
+          class... IteratorTypes>
+constexpr bool is_simd_host_range_supporting() {
+  if constexpr (is_simd_host_range_v<ExecutionSpace, ValueType,
+                                     IteratorTypes...>) {
+    return ::Kokkos::is_detected<Op,
+                                 simd_host_t<ExecutionSpace, ValueType>>::value;
+  } else {
+    return false;
+  }
+}
+
+template <class IndexType>
+IndexType simd_host_num_blocks(IndexType num_elements) {
+  return (num_elements + simd_host_block_size - 1) / simd_host_block_size;
+}
+
+// Per-block kernels, n is the number of elements starting at the pointers.
+// Searching kernels return n when nothing is found.
+template <class SimdType>
+struct SimdHostKernels {
+  using simd_type  = SimdType;
+  using mask_type  = typename simd_type::mask_type;
+  using value_type = typename simd_type::value_type;
+
+  static constexpr std::ptrdiff_t width = simd_type::size();
+
+  static simd_type load(value_type const* ptr) {
+    simd_type v;
+    v.copy_from(ptr, element_aligned_tag());
+    return v;
+  }
+
+  template <class BinaryOp>
+  static value_type horizontal(simd_type const& v, BinaryOp op) {
+    value_type result = v[0];
+    for (std::ptrdiff_t lane = 1; lane < width; ++lane) {
+      result = op(result, v[lane]);
+    }
+    return result;
+  }
+
+  static value_type hsum(simd_type const& v) {
+    return horizontal(v, std::plus<>());
+  }
+
+  static std::ptrdiff_t first_set(mask_type const& m) {
+    std::ptrdiff_t lane = 0;
+    while (!m[lane]) ++lane;
+    return lane;
+  }
+
+  static std::ptrdiff_t last_set(mask_type const& m) {
+    std::ptrdiff_t lane = width - 1;
+    while (!m[lane]) --lane;
+    return lane;
+  }
+
+  static value_type sum(value_type const* ptr, std::ptrdiff_t n) {
+    simd_type acc0(value_type(0)), acc1(value_type(0));
+    simd_type acc2(value_type(0)), acc3(value_type(0));
+    std::ptrdiff_t i = 0;
+    for (; i + 4 * width <= n; i += 4 * width) {
+      acc0 = acc0 + load(ptr + i);
+      acc1 = acc1 + load(ptr + i + width);
+      acc2 = acc2 + load(ptr + i + 2 * width);
+      acc3 = acc3 + load(ptr + i + 3 * width);
+    }
+    for (; i + width <= n; i += width) acc0 = acc0 + load(ptr + i);
+    value_type result = hsum((acc0 + acc1) + (acc2 + acc3));
+    for (; i < n; ++i) result += ptr[i];
+    return result;
+  }
+
+  static value_type dot(value_type const* ptr1, value_type const* ptr2,
+                        std::ptrdiff_t n) {
+    simd_type acc0(value_type(0)), acc1(value_type(0));
+    std::ptrdiff_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width) {
+      acc0 = acc0 + load(ptr1 + i) * load(ptr2 + i);
+      acc1 = acc1 + load(ptr1 + i + width) * load(ptr2 + i + width);
+    }
+    for (; i + width <= n; i += width) {
+      acc0 = acc0 + load(ptr1 + i) * load(ptr2 + i);
+    }
+    value_type result = hsum(acc0 + acc1);
+    for (; i < n; ++i) result += ptr1[i] * ptr2[i];
+    return result;
+  }
+
+  // counts in value_type lanes, exact since a block is far below 2^24
+  static std::ptrdiff_t count(value_type const* ptr, std::ptrdiff_t n,
+                              value_type value) {
+    simd_type const needle(value);
+    simd_type acc(value_type(0));
+    std::ptrdiff_t i = 0;
+    for (; i + width <= n; i += width) {
+      simd_type hit(value_type(0));
+      where(load(ptr + i) == needle, hit) = value_type(1);
+      acc = acc + hit;
+    }
+    auto result = static_cast<std::ptrdiff_t>(hsum(acc));
+    for (; i < n; ++i) result += (ptr[i] == value);
+    return result;
+  }
+
+  static std::ptrdiff_t find(value_type const* ptr, std::ptrdiff_t n,
+                             value_type value) {
+    simd_type const needle(value);
+    std::ptrdiff_t i = 0;
+    for (; i + width <= n; i += width) {
+      auto const m = load(ptr + i) == needle;
+      if (any_of(m)) return i + first_set(m);
+    }
+    for (; i < n; ++i) {
+      if (ptr[i] == value) return i;
+    }
+    return n;
+  }
+
+  static std::ptrdiff_t find_last(value_type const* ptr, std::ptrdiff_t n,
+                                  value_type value) {
+    simd_type const needle(value);
+    std::ptrdiff_t i = n;
+    for (; i > n - n % width; --i) {
+      if (ptr[i - 1] == value) return i - 1;
+    }
+    for (; i > 0; i -= width) {
+      auto const m = load(ptr + i - width) == needle;
+      if (any_of(m)) return i - width + last_set(m);
+    }
+    return n;
+  }
+
+  // matches !(a == b) of the default predicate, NaNs compare unequal
+  static std::ptrdiff_t mismatch(value_type const* ptr1,
+                                 value_type const* ptr2, std::ptrdiff_t n) {
+    std::ptrdiff_t i = 0;
+    for (; i + width <= n; i += width) {
+      auto const m = !(load(ptr1 + i) == load(ptr2 + i));
+      if (any_of(m)) return i + first_set(m);
+    }
+    for (; i < n; ++i) {
+      if (!(ptr1[i] == ptr2[i])) return i;
+    }
+    return n;
+  }
+
+  // The extrema are selected with operator< like the scalar reducers, so
+  // NaNs never replace a value.  If no element equals the extremum (all
+  // NaN) the positions below come back as n.
+  static value_type min_value(value_type const* ptr, std::ptrdiff_t n) {
+    simd_type acc(::Kokkos::reduction_identity<value_type>::min());
+    std::ptrdiff_t i = 0;
+    for (; i + width <= n; i += width) {
+      auto const v = load(ptr + i);
+      where(v < acc, acc) = v;
+    }
+    value_type result = horizontal(
+        acc, [](value_type a, value_type b) { return b < a ? b : a; });
+    for (; i < n; ++i) {
+      if (ptr[i] < result) result = ptr[i];
+    }
+    return result;
+  }
+
+  static value_type max_value(value_type const* ptr, std::ptrdiff_t n) {
+    simd_type acc(::Kokkos::reduction_identity<value_type>::max());
+    std::ptrdiff_t i = 0;
+    for (; i + width <= n; i += width) {
+      auto const v = load(ptr + i);
+      where(acc < v, acc) = v;
+    }
+    value_type result = horizontal(
+        acc, [](value_type a, value_type b) { return a < b ? b : a; });
+    for (; i < n; ++i) {
+      if (result < ptr[i]) result = ptr[i];
+    }
+    return result;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
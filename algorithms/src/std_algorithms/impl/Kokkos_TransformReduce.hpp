@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdHostFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -104,6 +105,23 @@ struct StdTransformReduceTwoIntervalsFunctor {
         m_transform(std::move(transform)) {}
 };
 
+template <class SimdType, class IndexType>
+struct StdTransformReduceDefaultSimdHostFunctor {
+  using kernels      = SimdHostKernels<SimdType>;
+  using element_type = typename kernels::value_type;
+
+  element_type const* m_first1;
+  element_type const* m_first2;
+  IndexType m_num_elements;
+
+  void operator()(const IndexType block, element_type& update) const {
+    const IndexType begin = block * simd_host_block_size;
+    update += kernels::dot(
+        m_first1 + begin, m_first2 + begin,
+        Kokkos::min<IndexType>(simd_host_block_size, m_num_elements - begin));
+  }
+};
+
 //------------------------------
 //
 // impl functions
@@ -204,14 +222,38 @@ ValueType transform_reduce_default_functors_exespace_impl(
   Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
   Impl::expect_valid_range(first1, last1);
 
-  // aliases
-  using transformer_type =
-      Impl::StdTranformReduceDefaultBinaryTransformFunctor<ValueType>;
-  using joiner_type = Impl::StdTranformReduceDefaultJoinFunctor<ValueType>;
+  if constexpr (is_simd_host_range_supporting<simd_multiplies_t,
+                                              ExecutionSpace, ValueType,
+                                              IteratorType1, IteratorType2>()) {
+    if (first1 == last1) {
+      // init is returned, unmodified
+      return init_reduction_value;
+    }
 
-  return transform_reduce_custom_functors_exespace_impl(
-      label, ex, first1, last1, first2, std::move(init_reduction_value),
-      joiner_type(), transformer_type());
+    using index_type        = typename IteratorType1::difference_type;
+    using simd_functor_type = StdTransformReduceDefaultSimdHostFunctor<
+        simd_host_t<ExecutionSpace, ValueType>, index_type>;
+
+    // run
+    ValueType result        = 0;
+    const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+    ::Kokkos::parallel_reduce(
+        label,
+        RangePolicy<ExecutionSpace>(ex, 0, simd_host_num_blocks(num_elements)),
+        simd_functor_type{&*first1, &*first2, num_elements}, result);
+
+    // fence not needed since reducing into scalar
+    return result + init_reduction_value;
+  } else {
+    // aliases
+    using transformer_type =
+        Impl::StdTranformReduceDefaultBinaryTransformFunctor<ValueType>;
+    using joiner_type = Impl::StdTranformReduceDefaultJoinFunctor<ValueType>;
+
+    return transform_reduce_custom_functors_exespace_impl(
+        label, ex, first1, last1, first2, std::move(init_reduction_value),
+        joiner_type(), transformer_type());
+  }
 }
 
 //
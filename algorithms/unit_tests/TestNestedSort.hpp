@@ -202,7 +202,8 @@ ValueViewType uniformRandomViewFill(size_t totalLength,
 
 template <class ExecutionSpace, typename KeyType>
 void test_nested_sort_impl(unsigned narray, unsigned n, bool useTeams,
-                           bool customCompare, KeyType minKey, KeyType maxKey) {
+                           bool customCompare, KeyType minKey, KeyType maxKey,
+                           int teamSize = 0) {
   using KeyViewType    = Kokkos::View<KeyType*, ExecutionSpace>;
   using OffsetViewType = Kokkos::View<unsigned*, ExecutionSpace>;
   using TeamPol        = Kokkos::TeamPolicy<ExecutionSpace>;
@@ -229,7 +230,8 @@ void test_nested_sort_impl(unsigned narray, unsigned n, bool useTeams,
   }
   if (useTeams) {
     int vectorLen = std::min<int>(4, TeamPol::vector_length_max());
-    TeamPol policy(narray, Kokkos::AUTO(), vectorLen);
+    TeamPol policy = teamSize > 0 ? TeamPol(narray, teamSize, vectorLen)
+                                  : TeamPol(narray, Kokkos::AUTO(), vectorLen);
     Kokkos::parallel_for(
         policy, TeamSortFunctor<ExecutionSpace, KeyViewType, OffsetViewType>(
                     keys, offsets, customCompare));
@@ -256,7 +258,7 @@ template <class ExecutionSpace, typename KeyType, typename ValueType>
 void test_nested_sort_by_key_impl(unsigned narray, unsigned n, bool useTeams,
                                   bool customCompare, KeyType minKey,
                                   KeyType maxKey, ValueType minVal,
-                                  ValueType maxVal) {
+                                  ValueType maxVal, int teamSize = 0) {
   using KeyViewType    = Kokkos::View<KeyType*, ExecutionSpace>;
   using ValueViewType  = Kokkos::View<ValueType*, ExecutionSpace>;
   using OffsetViewType = Kokkos::View<unsigned*, ExecutionSpace>;
@@ -301,7 +303,8 @@ void test_nested_sort_by_key_impl(unsigned narray, unsigned n, bool useTeams,
   }
   if (useTeams) {
     int vectorLen = std::min<int>(4, TeamPol::vector_length_max());
-    TeamPol policy(narray, Kokkos::AUTO(), vectorLen);
+    TeamPol policy = teamSize > 0 ? TeamPol(narray, teamSize, vectorLen)
+                                  : TeamPol(narray, Kokkos::AUTO(), vectorLen);
     Kokkos::parallel_for(
         policy, TeamSortByKeyFunctor<ExecutionSpace, KeyViewType, ValueViewType,
                                      OffsetViewType>(keys, values, offsets,
@@ -418,5 +421,30 @@ TEST(TEST_CATEGORY, NestedSortByKey) {
       11, CHAR_MIN, CHAR_MAX, 2.718, 3.14);
 }
 
+TEST(TEST_CATEGORY, NestedSortLongArrays) {
+  // FIXME_OPENMPTARGET - causes runtime failure with CrayClang compiler
+#if defined(KOKKOS_COMPILER_CRAY_LLVM) && defined(KOKKOS_ENABLE_OPENMPTARGET)
+  GTEST_SKIP() << "known to fail with OpenMPTarget+Cray LLVM";
+#endif
+
+  using ExecutionSpace = TEST_EXECSPACE;
+
+  // Arrays much longer than the team size, so that the blocks sorted by
+  // individual team members go through several merge levels. The narrow key
+  // range makes sure that partitioning sees many duplicates.
+  int const teamSize = std::min(4, ExecutionSpace().concurrency());
+  for (bool useTeams : {true, false}) {
+    for (bool customCompare : {false, true}) {
+      NestedSortImpl::test_nested_sort_impl<ExecutionSpace, int>(
+          7, 5000, useTeams, customCompare, -50, 50, teamSize);
+      NestedSortImpl::test_nested_sort_impl<ExecutionSpace, double>(
+          3, 20000, useTeams, customCompare, -1e6, 1e6, teamSize);
+      NestedSortImpl::test_nested_sort_by_key_impl<ExecutionSpace, unsigned,
+                                                   int>(
+          5, 3000, useTeams, customCompare, 0U, 1000U, -1000, 1000, teamSize);
+    }
+  }
+}
+
 }  // namespace Test
 #endif
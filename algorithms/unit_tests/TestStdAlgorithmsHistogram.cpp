@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace Histogram {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct BinOfValue {
+  int m_num_bins;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const ValueType& value) const {
+    return static_cast<int>(value) % m_num_bins;
+  }
+};
+
+template <class ViewType>
+auto fill_view_randomly(ViewType view, int max_value) {
+  using value_type = typename ViewType::value_type;
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::mt19937 gen(23);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<value_type> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i]    = static_cast<value_type>(dist(gen));
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return values;
+}
+
+template <class Tag, class ValueType, class CountType>
+void test_histogram(std::size_t ext, int num_bins) {
+  auto view         = create_view<ValueType>(Tag{}, ext, "histogram");
+  const auto values = fill_view_randomly(view, 100000);
+  const BinOfValue<ValueType> bin_op{num_bins};
+
+  std::vector<CountType> expected(num_bins, 0);
+  for (const auto& value : values) {
+    ++expected[bin_op(value)];
+  }
+
+  // counts can also be strided
+  auto counts = create_view<CountType>(Tag{}, num_bins, "counts");
+  for (int api : {0, 1, 2, 3}) {
+    // the result does not depend on the previous content of counts
+    Kokkos::deep_copy(counts, CountType(7));
+    switch (api) {
+      case 0:
+        KE::histogram(exespace(), KE::cbegin(view), KE::cend(view), counts,
+                      bin_op);
+        break;
+      case 1:
+        KE::histogram("label", exespace(), KE::cbegin(view), KE::cend(view),
+                      counts, bin_op);
+        break;
+      case 2: KE::histogram(exespace(), view, counts, bin_op); break;
+      case 3: KE::histogram("label", exespace(), view, counts, bin_op); break;
+    }
+
+    auto counts_h = create_host_space_copy(counts);
+    for (int b = 0; b < num_bins; ++b) {
+      ASSERT_EQ(counts_h(b), expected[b]) << "at bin " << b;
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 9, 153, 1024, 51130}) {
+    // the largest bin counts exceed the budget of private bins
+    for (int num_bins : {1, 3, 64, 1000, 20000}) {
+      test_histogram<Tag, ValueType, int>(ext, num_bins);
+      test_histogram<Tag, ValueType, std::size_t>(ext, num_bins);
+    }
+  }
+}
+
+TEST(std_algorithms_numerics_ops_test, histogram) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, unsigned>();
+}
+
+}  // namespace Histogram
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,171 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace LowerUpperBound {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct GreaterThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+template <class ViewType, class ValueType>
+void copy_to_view(const std::vector<ValueType>& values, ViewType view) {
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+}
+
+template <bool IsLowerBound, class... Args>
+auto kokkos_bound(Args&&... args) {
+  if constexpr (IsLowerBound) {
+    return KE::lower_bound(std::forward<Args>(args)...);
+  } else {
+    return KE::upper_bound(std::forward<Args>(args)...);
+  }
+}
+
+template <bool IsLowerBound, class Tag, class ValueType, class Comparator>
+void test_bound(std::size_t ext, std::size_t num_values, int max_value,
+                Comparator comp) {
+  std::mt19937 gen(13);
+  std::uniform_int_distribution<int> dist(-1, max_value + 1);
+  std::vector<ValueType> sorted(ext);
+  std::vector<ValueType> values(num_values);
+  for (auto& v : sorted) v = static_cast<ValueType>(dist(gen));
+  for (auto& v : values) v = static_cast<ValueType>(dist(gen));
+  std::sort(sorted.begin(), sorted.end(), comp);
+
+  auto view        = create_view<ValueType>(Tag{}, ext, "bound_view");
+  auto view_values = create_view<ValueType>(Tag{}, num_values, "bound_values");
+  copy_to_view(sorted, view);
+  copy_to_view(values, view_values);
+
+  for (int api : {0, 1, 2, 3}) {
+    auto view_dest = create_view<std::ptrdiff_t>(Tag{}, num_values, "dest");
+    auto result    = KE::begin(view_dest);
+    switch (api) {
+      case 0:
+        result = kokkos_bound<IsLowerBound>(
+            exespace(), KE::cbegin(view), KE::cend(view),
+            KE::cbegin(view_values), KE::cend(view_values),
+            KE::begin(view_dest), comp);
+        break;
+      case 1:
+        result = kokkos_bound<IsLowerBound>(
+            "label", exespace(), KE::cbegin(view), KE::cend(view),
+            KE::cbegin(view_values), KE::cend(view_values),
+            KE::begin(view_dest), comp);
+        break;
+      case 2:
+        result = kokkos_bound<IsLowerBound>(exespace(), view, view_values,
+                                            view_dest, comp);
+        break;
+      case 3:
+        result = kokkos_bound<IsLowerBound>("label", exespace(), view,
+                                            view_values, view_dest, comp);
+        break;
+    }
+    ASSERT_EQ(result, KE::end(view_dest));
+
+    auto view_dest_h = create_host_space_copy(view_dest);
+    for (std::size_t i = 0; i < num_values; ++i) {
+      const auto expected =
+          IsLowerBound
+              ? std::lower_bound(sorted.begin(), sorted.end(), values[i], comp)
+              : std::upper_bound(sorted.begin(), sorted.end(), values[i],
+                                 comp);
+      ASSERT_EQ(view_dest_h(i), expected - sorted.begin())
+          << "for value " << values[i];
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 13, 1024, 4099}) {
+    for (std::size_t num_values : {0, 1, 77, 2000}) {
+      for (int max_value : {3, 100000}) {
+        test_bound<true, Tag, ValueType>(ext, num_values, max_value,
+                                         CustomLessThanComparator<ValueType>());
+        test_bound<true, Tag, ValueType>(ext, num_values, max_value,
+                                         GreaterThan<ValueType>());
+        test_bound<false, Tag, ValueType>(
+            ext, num_values, max_value, CustomLessThanComparator<ValueType>());
+        test_bound<false, Tag, ValueType>(ext, num_values, max_value,
+                                          GreaterThan<ValueType>());
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_binary_search_ops, lower_upper_bound) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+}
+
+TEST(std_algorithms_binary_search_ops, default_comparator) {
+  using view_t = Kokkos::View<int*, exespace>;
+  view_t view("view", 5);
+  view_t view_values("view_values", 3);
+  Kokkos::View<std::ptrdiff_t*, exespace> view_dest("view_dest", 3);
+  auto view_h        = create_mirror_view(Kokkos::HostSpace(), view);
+  auto view_values_h = create_mirror_view(Kokkos::HostSpace(), view_values);
+
+  // {1, 2, 2, 2, 5}
+  view_h(0)        = 1;
+  view_h(1)        = 2;
+  view_h(2)        = 2;
+  view_h(3)        = 2;
+  view_h(4)        = 5;
+  view_values_h(0) = 0;
+  view_values_h(1) = 2;
+  view_values_h(2) = 6;
+  Kokkos::deep_copy(view, view_h);
+  Kokkos::deep_copy(view_values, view_values_h);
+
+  KE::lower_bound(exespace(), view, view_values, view_dest);
+  auto view_dest_h = create_host_space_copy(view_dest);
+  ASSERT_EQ(view_dest_h(0), 0);
+  ASSERT_EQ(view_dest_h(1), 1);
+  ASSERT_EQ(view_dest_h(2), 5);
+
+  KE::upper_bound(exespace(), view, view_values, view_dest);
+  view_dest_h = create_host_space_copy(view_dest);
+  ASSERT_EQ(view_dest_h(0), 0);
+  ASSERT_EQ(view_dest_h(1), 4);
+  ASSERT_EQ(view_dest_h(2), 5);
+}
+
+}  // namespace LowerUpperBound
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace Merge {
+
+namespace KE = Kokkos::Experimental;
+
+// compares the tens only, so that merging is observably stable
+template <class ValueType>
+struct CompareTens {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a / 10 < b / 10;
+  }
+};
+
+template <class ValueType, class Comparator>
+std::vector<ValueType> make_sorted_values(std::size_t ext, int max_value,
+                                          unsigned seed, Comparator comp) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<ValueType> values(ext);
+  for (auto& value : values) {
+    value = static_cast<ValueType>(dist(gen));
+  }
+  std::stable_sort(values.begin(), values.end(), comp);
+  return values;
+}
+
+template <class ViewType, class ValueType>
+void copy_to_view(const std::vector<ValueType>& values, ViewType view) {
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+}
+
+template <class ViewType, class ValueType>
+void verify_data(ViewType view, const std::vector<ValueType>& expected) {
+  auto view_h = create_host_space_copy(view);
+  ASSERT_EQ(view_h.extent(0), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(view_h(i), expected[i]) << "at position " << i;
+  }
+}
+
+template <class Tag, class ValueType, class Comparator>
+void test_merge(std::size_t ext1, std::size_t ext2, int max_value,
+                Comparator comp) {
+  const auto values1 = make_sorted_values<ValueType>(ext1, max_value, 3, comp);
+  const auto values2 = make_sorted_values<ValueType>(ext2, max_value, 5, comp);
+  std::vector<ValueType> expected(ext1 + ext2);
+  std::merge(values1.begin(), values1.end(), values2.begin(), values2.end(),
+             expected.begin(), comp);
+
+  auto view1 = create_view<ValueType>(Tag{}, ext1, "merge_view1");
+  auto view2 = create_view<ValueType>(Tag{}, ext2, "merge_view2");
+  copy_to_view(values1, view1);
+  copy_to_view(values2, view2);
+
+  for (int api : {0, 1, 2, 3}) {
+    auto view_dest = create_view<ValueType>(Tag{}, ext1 + ext2, "merge_dest");
+    auto result    = KE::begin(view_dest);
+    switch (api) {
+      case 0:
+        result = KE::merge(exespace(), KE::cbegin(view1), KE::cend(view1),
+                           KE::cbegin(view2), KE::cend(view2),
+                           KE::begin(view_dest), comp);
+        break;
+      case 1:
+        result = KE::merge("label", exespace(), KE::cbegin(view1),
+                           KE::cend(view1), KE::cbegin(view2),
+                           KE::cend(view2), KE::begin(view_dest), comp);
+        break;
+      case 2:
+        result = KE::merge(exespace(), view1, view2, view_dest, comp);
+        break;
+      case 3:
+        result = KE::merge("label", exespace(), view1, view2, view_dest, comp);
+        break;
+    }
+    ASSERT_EQ(result - KE::begin(view_dest), std::ptrdiff_t(ext1 + ext2));
+    verify_data(view_dest, expected);
+  }
+}
+
+template <class Tag, class ValueType, class Comparator>
+void test_inplace_merge(std::size_t ext1, std::size_t ext2, int max_value,
+                        Comparator comp) {
+  auto values        = make_sorted_values<ValueType>(ext1, max_value, 3, comp);
+  const auto values2 = make_sorted_values<ValueType>(ext2, max_value, 5, comp);
+  values.insert(values.end(), values2.begin(), values2.end());
+  auto expected = values;
+  std::inplace_merge(expected.begin(), expected.begin() + ext1,
+                     expected.end(), comp);
+
+  auto view = create_view<ValueType>(Tag{}, ext1 + ext2, "inplace_merge");
+  for (int api : {0, 1, 2, 3}) {
+    copy_to_view(values, view);
+    switch (api) {
+      case 0:
+        KE::inplace_merge(exespace(), KE::begin(view), KE::begin(view) + ext1,
+                          KE::end(view), comp);
+        break;
+      case 1:
+        KE::inplace_merge("label", exespace(), KE::begin(view),
+                          KE::begin(view) + ext1, KE::end(view), comp);
+        break;
+      case 2: KE::inplace_merge(exespace(), view, ext1, comp); break;
+      case 3: KE::inplace_merge("label", exespace(), view, ext1, comp); break;
+    }
+    verify_data(view, expected);
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  // sizes around the merge path chunks, with few or many duplicates
+  const std::vector<std::pair<std::size_t, std::size_t>> extents = {
+      {0, 0},   {0, 5},    {7, 0},     {1, 1},      {13, 9},
+      {255, 1}, {256, 256}, {300, 1000}, {4093, 2111}};
+  for (const auto& ext : extents) {
+    for (int max_value : {5, 100000}) {
+      test_merge<Tag, ValueType>(ext.first, ext.second, max_value,
+                                 CustomLessThanComparator<ValueType>());
+      test_merge<Tag, ValueType>(ext.first, ext.second, max_value,
+                                 CompareTens<ValueType>());
+      test_inplace_merge<Tag, ValueType>(ext.first, ext.second, max_value,
+                                         CompareTens<ValueType>());
+    }
+  }
+}
+
+TEST(std_algorithms_merge_ops, merge) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+}
+
+TEST(std_algorithms_merge_ops, merge_default_comparator) {
+  using view_t = Kokkos::View<double*, exespace>;
+  view_t view1("view1", 3);
+  view_t view2("view2", 2);
+  view_t view_dest("view_dest", 5);
+  auto view1_h = create_mirror_view(Kokkos::HostSpace(), view1);
+  auto view2_h = create_mirror_view(Kokkos::HostSpace(), view2);
+
+  view1_h(0) = 1.;
+  view1_h(1) = 3.;
+  view1_h(2) = 5.;
+  view2_h(0) = 2.;
+  view2_h(1) = 4.;
+  Kokkos::deep_copy(view1, view1_h);
+  Kokkos::deep_copy(view2, view2_h);
+
+  KE::merge(exespace(), view1, view2, view_dest);
+  verify_data(view_dest, std::vector<double>{1., 2., 3., 4., 5.});
+
+  view_t view("view", 5);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+  view_h(0)   = 1.;
+  view_h(1)   = 3.;
+  view_h(2)   = 5.;
+  view_h(3)   = 2.;
+  view_h(4)   = 4.;
+  Kokkos::deep_copy(view, view_h);
+  KE::inplace_merge(exespace(), view, 3);
+  verify_data(view, std::vector<double>{1., 2., 3., 4., 5.});
+}
+
+}  // namespace Merge
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,189 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace NthElement {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct GreaterThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+template <class ViewType>
+auto fill_view_randomly(ViewType view, int max_value) {
+  using value_type = typename ViewType::value_type;
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<value_type> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i]    = static_cast<value_type>(dist(gen));
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return values;
+}
+
+template <class ViewType>
+auto copy_to_vector(ViewType view) {
+  auto view_h = create_host_space_copy(view);
+  std::vector<typename ViewType::value_type> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = view_h(i);
+  }
+  return values;
+}
+
+template <class Tag, class ValueType, class Comparator>
+void test_nth_element(std::size_t ext, std::size_t nth, int max_value,
+                      Comparator comp) {
+  auto view = create_view<ValueType>(Tag{}, ext, "nth_element");
+
+  for (int api : {0, 1, 2, 3}) {
+    auto values = fill_view_randomly(view, max_value);
+    switch (api) {
+      case 0:
+        KE::nth_element(exespace(), KE::begin(view), KE::begin(view) + nth,
+                        KE::end(view), comp);
+        break;
+      case 1:
+        KE::nth_element("label", exespace(), KE::begin(view),
+                        KE::begin(view) + nth, KE::end(view), comp);
+        break;
+      case 2: KE::nth_element(exespace(), view, nth, comp); break;
+      case 3: KE::nth_element("label", exespace(), view, nth, comp); break;
+    }
+
+    const auto result = copy_to_vector(view);
+    ASSERT_TRUE(
+        std::is_permutation(result.begin(), result.end(), values.begin()));
+    if (nth == ext) {
+      continue;
+    }
+    std::nth_element(values.begin(), values.begin() + nth, values.end(), comp);
+    ASSERT_EQ(result[nth], values[nth]);
+    for (std::size_t i = 0; i < nth; ++i) {
+      ASSERT_FALSE(comp(result[nth], result[i])) << "at position " << i;
+    }
+    for (std::size_t i = nth + 1; i < ext; ++i) {
+      ASSERT_FALSE(comp(result[i], result[nth])) << "at position " << i;
+    }
+  }
+}
+
+template <class Tag, class ValueType, class Comparator>
+void test_partial_sort(std::size_t ext, std::size_t middle, int max_value,
+                       Comparator comp) {
+  auto view = create_view<ValueType>(Tag{}, ext, "partial_sort");
+
+  for (int api : {0, 1, 2, 3}) {
+    auto values = fill_view_randomly(view, max_value);
+    switch (api) {
+      case 0:
+        KE::partial_sort(exespace(), KE::begin(view), KE::begin(view) + middle,
+                         KE::end(view), comp);
+        break;
+      case 1:
+        KE::partial_sort("label", exespace(), KE::begin(view),
+                         KE::begin(view) + middle, KE::end(view), comp);
+        break;
+      case 2: KE::partial_sort(exespace(), view, middle, comp); break;
+      case 3: KE::partial_sort("label", exespace(), view, middle, comp); break;
+    }
+
+    const auto result = copy_to_vector(view);
+    ASSERT_TRUE(
+        std::is_permutation(result.begin(), result.end(), values.begin()));
+    std::partial_sort(values.begin(), values.begin() + middle, values.end(),
+                      comp);
+    for (std::size_t i = 0; i < middle; ++i) {
+      ASSERT_EQ(result[i], values[i]) << "at position " << i;
+    }
+    for (std::size_t i = middle; i < ext && middle > 0; ++i) {
+      ASSERT_FALSE(comp(result[i], result[middle - 1])) << "at position " << i;
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 31, 33, 517, 4099}) {
+    // first, last, and a few positions in between
+    for (std::size_t pos : {std::size_t(0), ext / 3, ext / 2, ext}) {
+      if (pos > ext) continue;
+      for (int max_value : {0, 8, 100000}) {
+        if (pos < ext) {
+          test_nth_element<Tag, ValueType>(
+              ext, pos, max_value, CustomLessThanComparator<ValueType>());
+          test_nth_element<Tag, ValueType>(ext, pos, max_value,
+                                           GreaterThan<ValueType>());
+        }
+        test_partial_sort<Tag, ValueType>(
+            ext, pos, max_value, CustomLessThanComparator<ValueType>());
+        test_partial_sort<Tag, ValueType>(ext, pos, max_value,
+                                          GreaterThan<ValueType>());
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_sorting_ops, nth_element_and_partial_sort) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+TEST(std_algorithms_sorting_ops, nth_element_default_comparator) {
+  using view_t = Kokkos::View<int*, exespace>;
+  view_t view("view", 7);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+  view_h(0)   = 5;
+  view_h(1)   = 1;
+  view_h(2)   = 6;
+  view_h(3)   = 3;
+  view_h(4)   = 0;
+  view_h(5)   = 4;
+  view_h(6)   = 2;
+  Kokkos::deep_copy(view, view_h);
+
+  KE::nth_element(exespace(), view, 3);
+  Kokkos::deep_copy(view_h, view);
+  ASSERT_EQ(view_h(3), 3);
+
+  KE::partial_sort(exespace(), view, 4);
+  Kokkos::deep_copy(view_h, view);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(view_h(i), i);
+  }
+}
+
+}  // namespace NthElement
+}  // namespace stdalgos
+}  // namespace Test
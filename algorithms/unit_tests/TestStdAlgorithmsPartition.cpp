@@ -0,0 +1,147 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace Partition {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct IsBelowThreshold {
+  ValueType m_threshold;
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& value) const { return value < m_threshold; }
+};
+
+template <class ViewType>
+auto fill_view_randomly(ViewType view, int max_value) {
+  using value_type = typename ViewType::value_type;
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<value_type> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i]    = static_cast<value_type>(dist(gen));
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return values;
+}
+
+template <class Tag, class ValueType>
+void test_stable_partition(std::size_t ext, int max_value) {
+  const IsBelowThreshold<ValueType> pred{static_cast<ValueType>(max_value / 3)};
+  auto view = create_view<ValueType>(Tag{}, ext, "stable_partition");
+
+  for (int api : {0, 1, 2, 3}) {
+    auto expected = fill_view_randomly(view, max_value);
+    const auto expected_count =
+        std::stable_partition(expected.begin(), expected.end(), pred) -
+        expected.begin();
+
+    auto result = KE::begin(view);
+    switch (api) {
+      case 0:
+        result = KE::stable_partition(exespace(), KE::begin(view),
+                                      KE::end(view), pred);
+        break;
+      case 1:
+        result = KE::stable_partition("label", exespace(), KE::begin(view),
+                                      KE::end(view), pred);
+        break;
+      case 2: result = KE::stable_partition(exespace(), view, pred); break;
+      case 3:
+        result = KE::stable_partition("label", exespace(), view, pred);
+        break;
+    }
+    ASSERT_EQ(result - KE::begin(view), expected_count);
+
+    auto view_h = create_host_space_copy(view);
+    for (std::size_t i = 0; i < ext; ++i) {
+      ASSERT_EQ(view_h(i), expected[i]) << "at position " << i;
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void test_partition(std::size_t ext, int max_value) {
+  const IsBelowThreshold<ValueType> pred{static_cast<ValueType>(max_value / 3)};
+  auto view = create_view<ValueType>(Tag{}, ext, "partition");
+
+  for (int api : {0, 1, 2, 3}) {
+    auto values = fill_view_randomly(view, max_value);
+    const auto expected_count =
+        std::count_if(values.begin(), values.end(), pred);
+
+    auto result = KE::begin(view);
+    switch (api) {
+      case 0:
+        result =
+            KE::partition(exespace(), KE::begin(view), KE::end(view), pred);
+        break;
+      case 1:
+        result = KE::partition("label", exespace(), KE::begin(view),
+                               KE::end(view), pred);
+        break;
+      case 2: result = KE::partition(exespace(), view, pred); break;
+      case 3: result = KE::partition("label", exespace(), view, pred); break;
+    }
+    ASSERT_EQ(result - KE::begin(view), expected_count);
+
+    // partition is not required to be stable: check that the range is
+    // partitioned and that it is a permutation of the input
+    auto view_h = create_host_space_copy(view);
+    std::vector<ValueType> partitioned(ext);
+    for (std::size_t i = 0; i < ext; ++i) {
+      partitioned[i] = view_h(i);
+    }
+    ASSERT_TRUE(std::is_partitioned(partitioned.begin(), partitioned.end(),
+                                    pred));
+    ASSERT_TRUE(
+        std::is_permutation(partitioned.begin(), partitioned.end(),
+                            values.begin()));
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 9, 153, 1024, 5113}) {
+    for (int max_value : {1, 30, 100000}) {
+      test_stable_partition<Tag, ValueType>(ext, max_value);
+      test_partition<Tag, ValueType>(ext, max_value);
+    }
+  }
+}
+
+TEST(std_algorithms_partition_ops, partition) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+}  // namespace Partition
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,378 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace ScanByKey {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct SameParity {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return (a % 2) == (b % 2);
+  }
+};
+
+template <class ValueType>
+struct MaxOp {
+  KOKKOS_INLINE_FUNCTION
+  ValueType operator()(const ValueType& a, const ValueType& b) const {
+    return a < b ? b : a;
+  }
+};
+
+template <class ViewType>
+auto fill_view_randomly(ViewType view, int max_value, unsigned seed) {
+  using value_type = typename ViewType::value_type;
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<value_type> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i]    = static_cast<value_type>(dist(gen));
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+  return values;
+}
+
+template <class ValueType, class PredType, class OpType>
+auto std_scan_by_key(const std::vector<int>& keys,
+                     const std::vector<ValueType>& values, bool inclusive,
+                     ValueType init, PredType pred, OpType op) {
+  std::vector<ValueType> result(values.size());
+  ValueType update{};
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const bool head = i == 0 || !pred(keys[i - 1], keys[i]);
+    if (inclusive) {
+      update    = head ? values[i] : op(update, values[i]);
+      result[i] = update;
+    } else {
+      update    = head ? init : update;
+      result[i] = update;
+      update    = op(update, values[i]);
+    }
+  }
+  return result;
+}
+
+template <class Tag, class ValueType, class PredType, class OpType>
+void test_scan_by_key(std::size_t ext, int max_key, PredType pred, OpType op,
+                      int variant) {
+  auto keys   = create_view<int>(DynamicTag{}, ext, "keys");
+  auto values = create_view<ValueType>(Tag{}, ext, "values");
+  auto dest   = create_view<ValueType>(Tag{}, ext, "dest");
+  const auto keys_v   = fill_view_randomly(keys, max_key, 13);
+  const auto values_v = fill_view_randomly(values, 100, 29);
+  const ValueType init{3};
+
+  for (bool inclusive : {true, false}) {
+    for (int api : {0, 1, 2, 3}) {
+      auto it = KE::begin(dest);
+      // variant 0: defaults, 1: custom predicate, 2: predicate and op
+      if (inclusive && variant == 0) {
+        switch (api) {
+          case 0:
+            it = KE::inclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest));
+            break;
+          case 1:
+            it = KE::inclusive_scan_by_key("label", exespace(),
+                                           KE::cbegin(keys), KE::cend(keys),
+                                           KE::cbegin(values), KE::begin(dest));
+            break;
+          case 2:
+            it = KE::inclusive_scan_by_key(exespace(), keys, values, dest);
+            break;
+          case 3:
+            it = KE::inclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest);
+            break;
+        }
+      } else if (inclusive && variant == 1) {
+        switch (api) {
+          case 0:
+            it = KE::inclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest), pred);
+            break;
+          case 1:
+            it = KE::inclusive_scan_by_key(
+                "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+                KE::cbegin(values), KE::begin(dest), pred);
+            break;
+          case 2:
+            it = KE::inclusive_scan_by_key(exespace(), keys, values, dest,
+                                           pred);
+            break;
+          case 3:
+            it = KE::inclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest, pred);
+            break;
+        }
+      } else if (inclusive) {
+        switch (api) {
+          case 0:
+            it = KE::inclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest), pred, op);
+            break;
+          case 1:
+            it = KE::inclusive_scan_by_key(
+                "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+                KE::cbegin(values), KE::begin(dest), pred, op);
+            break;
+          case 2:
+            it = KE::inclusive_scan_by_key(exespace(), keys, values, dest,
+                                           pred, op);
+            break;
+          case 3:
+            it = KE::inclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest, pred, op);
+            break;
+        }
+      } else if (variant == 0) {
+        switch (api) {
+          case 0:
+            it = KE::exclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest), init);
+            break;
+          case 1:
+            it = KE::exclusive_scan_by_key(
+                "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+                KE::cbegin(values), KE::begin(dest), init);
+            break;
+          case 2:
+            it = KE::exclusive_scan_by_key(exespace(), keys, values, dest,
+                                           init);
+            break;
+          case 3:
+            it = KE::exclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest, init);
+            break;
+        }
+      } else if (variant == 1) {
+        switch (api) {
+          case 0:
+            it = KE::exclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest), init, pred);
+            break;
+          case 1:
+            it = KE::exclusive_scan_by_key(
+                "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+                KE::cbegin(values), KE::begin(dest), init, pred);
+            break;
+          case 2:
+            it = KE::exclusive_scan_by_key(exespace(), keys, values, dest,
+                                           init, pred);
+            break;
+          case 3:
+            it = KE::exclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest, init, pred);
+            break;
+        }
+      } else {
+        switch (api) {
+          case 0:
+            it = KE::exclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                           KE::cend(keys), KE::cbegin(values),
+                                           KE::begin(dest), init, pred, op);
+            break;
+          case 1:
+            it = KE::exclusive_scan_by_key(
+                "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+                KE::cbegin(values), KE::begin(dest), init, pred, op);
+            break;
+          case 2:
+            it = KE::exclusive_scan_by_key(exespace(), keys, values, dest,
+                                           init, pred, op);
+            break;
+          case 3:
+            it = KE::exclusive_scan_by_key("label", exespace(), keys, values,
+                                           dest, init, pred, op);
+            break;
+        }
+      }
+      ASSERT_EQ(it, KE::end(dest));
+
+      const auto expected =
+          variant == 0
+              ? std_scan_by_key(keys_v, values_v, inclusive, init,
+                                std::equal_to<int>(), std::plus<ValueType>())
+          : variant == 1 ? std_scan_by_key(keys_v, values_v, inclusive, init,
+                                           pred, std::plus<ValueType>())
+                         : std_scan_by_key(keys_v, values_v, inclusive, init,
+                                           pred, op);
+      auto dest_h = create_host_space_copy(dest);
+      for (std::size_t i = 0; i < ext; ++i) {
+        ASSERT_EQ(dest_h(i), expected[i]) << "at position " << i;
+      }
+    }
+  }
+}
+
+template <class Tag, class ValueType, class PredType, class OpType>
+void test_reduce_by_key(std::size_t ext, int max_key, PredType pred, OpType op,
+                        int variant) {
+  auto keys        = create_view<int>(DynamicTag{}, ext, "keys");
+  auto values      = create_view<ValueType>(Tag{}, ext, "values");
+  auto keys_dest   = create_view<int>(DynamicTag{}, ext, "keys_dest");
+  auto values_dest = create_view<ValueType>(Tag{}, ext, "values_dest");
+  const auto keys_v   = fill_view_randomly(keys, max_key, 13);
+  const auto values_v = fill_view_randomly(values, 100, 29);
+
+  // expected result
+  std::vector<int> expected_keys;
+  std::vector<ValueType> expected_values;
+  for (std::size_t i = 0; i < ext; ++i) {
+    const bool head =
+        i == 0 || !(variant == 0 ? keys_v[i - 1] == keys_v[i]
+                                 : pred(keys_v[i - 1], keys_v[i]));
+    if (head) {
+      expected_keys.push_back(keys_v[i]);
+      expected_values.push_back(values_v[i]);
+    } else {
+      expected_values.back() = variant == 2
+                                   ? op(expected_values.back(), values_v[i])
+                                   : expected_values.back() + values_v[i];
+    }
+  }
+
+  for (int api : {0, 1, 2, 3}) {
+    Kokkos::pair<decltype(KE::begin(keys_dest)),
+                 decltype(KE::begin(values_dest))>
+        result;
+    if (variant == 0) {
+      switch (api) {
+        case 0:
+          result = KE::reduce_by_key(exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest));
+          break;
+        case 1:
+          result = KE::reduce_by_key("label", exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest));
+          break;
+        case 2:
+          result = KE::reduce_by_key(exespace(), keys, values, keys_dest,
+                                     values_dest);
+          break;
+        case 3:
+          result = KE::reduce_by_key("label", exespace(), keys, values,
+                                     keys_dest, values_dest);
+          break;
+      }
+    } else if (variant == 1) {
+      switch (api) {
+        case 0:
+          result = KE::reduce_by_key(exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest), pred);
+          break;
+        case 1:
+          result = KE::reduce_by_key("label", exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest), pred);
+          break;
+        case 2:
+          result = KE::reduce_by_key(exespace(), keys, values, keys_dest,
+                                     values_dest, pred);
+          break;
+        case 3:
+          result = KE::reduce_by_key("label", exespace(), keys, values,
+                                     keys_dest, values_dest, pred);
+          break;
+      }
+    } else {
+      switch (api) {
+        case 0:
+          result = KE::reduce_by_key(exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest), pred, op);
+          break;
+        case 1:
+          result = KE::reduce_by_key("label", exespace(), KE::cbegin(keys),
+                                     KE::cend(keys), KE::cbegin(values),
+                                     KE::begin(keys_dest),
+                                     KE::begin(values_dest), pred, op);
+          break;
+        case 2:
+          result = KE::reduce_by_key(exespace(), keys, values, keys_dest,
+                                     values_dest, pred, op);
+          break;
+        case 3:
+          result = KE::reduce_by_key("label", exespace(), keys, values,
+                                     keys_dest, values_dest, pred, op);
+          break;
+      }
+    }
+
+    const std::size_t num_segments = expected_keys.size();
+    ASSERT_EQ(std::size_t(result.first - KE::begin(keys_dest)), num_segments);
+    ASSERT_EQ(std::size_t(result.second - KE::begin(values_dest)),
+              num_segments);
+    auto keys_dest_h   = create_host_space_copy(keys_dest);
+    auto values_dest_h = create_host_space_copy(values_dest);
+    for (std::size_t i = 0; i < num_segments; ++i) {
+      ASSERT_EQ(keys_dest_h(i), expected_keys[i]) << "at position " << i;
+      ASSERT_EQ(values_dest_h(i), expected_values[i]) << "at position " << i;
+    }
+  }
+}
+
+template <class Tag, class ValueType>
+void run_all_scenarios() {
+  for (std::size_t ext : {0, 1, 2, 9, 153, 1024, 5113}) {
+    // max_key = 0 gives a single segment, larger values shorter segments
+    for (int max_key : {0, 1, 5, 1000}) {
+      for (int variant : {0, 1, 2}) {
+        test_scan_by_key<Tag, ValueType>(ext, max_key, SameParity<int>(),
+                                         MaxOp<ValueType>(), variant);
+        test_reduce_by_key<Tag, ValueType>(ext, max_key, SameParity<int>(),
+                                           MaxOp<ValueType>(), variant);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_numerics_ops_test, scan_and_reduce_by_key) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedThreeTag, int>();
+  run_all_scenarios<DynamicTag, double>();
+}
+
+}  // namespace ScanByKey
+}  // namespace stdalgos
+}  // namespace Test
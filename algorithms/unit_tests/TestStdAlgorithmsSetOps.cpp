@@ -0,0 +1,208 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace SetOps {
+
+namespace KE = Kokkos::Experimental;
+
+// compares the tens only, so that it is observable which range the
+// equivalent elements are taken from
+template <class ValueType>
+struct CompareTens {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a / 10 < b / 10;
+  }
+};
+
+enum class SetOp { Union, Intersection, Difference };
+
+template <class ValueType, class Comparator>
+std::vector<ValueType> make_sorted_values(std::size_t ext, int max_value,
+                                          unsigned seed, Comparator comp) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_value);
+  std::vector<ValueType> values(ext);
+  for (auto& value : values) {
+    value = static_cast<ValueType>(dist(gen));
+  }
+  std::stable_sort(values.begin(), values.end(), comp);
+  return values;
+}
+
+template <class ViewType, class ValueType>
+void copy_to_view(const std::vector<ValueType>& values, ViewType view) {
+  auto view_dc   = create_deep_copyable_compatible_view_with_same_extent(view);
+  auto view_dc_h = create_mirror_view(Kokkos::HostSpace(), view_dc);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    view_dc_h(i) = values[i];
+  }
+  Kokkos::deep_copy(view_dc, view_dc_h);
+  CopyFunctor<decltype(view_dc), ViewType> F1(view_dc, view);
+  Kokkos::parallel_for("copy", view.extent(0), F1);
+}
+
+template <SetOp Op, class InputIt, class OutputIt, class Comparator>
+OutputIt std_set_op(InputIt first1, InputIt last1, InputIt first2,
+                    InputIt last2, OutputIt d_first, Comparator comp) {
+  switch (Op) {
+    case SetOp::Union:
+      return std::set_union(first1, last1, first2, last2, d_first, comp);
+    case SetOp::Intersection:
+      return std::set_intersection(first1, last1, first2, last2, d_first,
+                                   comp);
+    case SetOp::Difference:
+      return std::set_difference(first1, last1, first2, last2, d_first, comp);
+  }
+  return d_first;
+}
+
+template <SetOp Op, class... Args>
+auto kokkos_set_op(Args&&... args) {
+  if constexpr (Op == SetOp::Union) {
+    return KE::set_union(std::forward<Args>(args)...);
+  } else if constexpr (Op == SetOp::Intersection) {
+    return KE::set_intersection(std::forward<Args>(args)...);
+  } else {
+    return KE::set_difference(std::forward<Args>(args)...);
+  }
+}
+
+template <SetOp Op, class Tag, class ValueType, class Comparator>
+void run_single_scenario(std::size_t ext1, std::size_t ext2, int max_value,
+                         Comparator comp) {
+  const auto values1 = make_sorted_values<ValueType>(ext1, max_value, 3, comp);
+  const auto values2 = make_sorted_values<ValueType>(ext2, max_value, 5, comp);
+  std::vector<ValueType> expected(ext1 + ext2);
+  const std::size_t expected_count =
+      std_set_op<Op>(values1.begin(), values1.end(), values2.begin(),
+                     values2.end(), expected.begin(), comp) -
+      expected.begin();
+
+  auto view1 = create_view<ValueType>(Tag{}, ext1, "set_op_view1");
+  auto view2 = create_view<ValueType>(Tag{}, ext2, "set_op_view2");
+  copy_to_view(values1, view1);
+  copy_to_view(values2, view2);
+
+  for (int api : {0, 1, 2, 3}) {
+    auto view_dest = create_view<ValueType>(Tag{}, ext1 + ext2, "set_op_dest");
+    auto result    = KE::begin(view_dest);
+    switch (api) {
+      case 0:
+        result = kokkos_set_op<Op>(exespace(), KE::cbegin(view1),
+                                   KE::cend(view1), KE::cbegin(view2),
+                                   KE::cend(view2), KE::begin(view_dest), comp);
+        break;
+      case 1:
+        result = kokkos_set_op<Op>("label", exespace(), KE::cbegin(view1),
+                                   KE::cend(view1), KE::cbegin(view2),
+                                   KE::cend(view2), KE::begin(view_dest), comp);
+        break;
+      case 2:
+        result =
+            kokkos_set_op<Op>(exespace(), view1, view2, view_dest, comp);
+        break;
+      case 3:
+        result = kokkos_set_op<Op>("label", exespace(), view1, view2,
+                                   view_dest, comp);
+        break;
+    }
+    ASSERT_EQ(std::size_t(result - KE::begin(view_dest)), expected_count);
+
+    auto view_dest_h = create_host_space_copy(view_dest);
+    for (std::size_t i = 0; i < expected_count; ++i) {
+      ASSERT_EQ(view_dest_h(i), expected[i]) << "at position " << i;
+    }
+  }
+}
+
+template <SetOp Op, class Tag, class ValueType>
+void run_all_scenarios() {
+  // sizes around the merge path chunks, with few or many duplicates
+  const std::vector<std::pair<std::size_t, std::size_t>> extents = {
+      {0, 0},   {0, 5},    {7, 0},     {1, 1},      {13, 9},
+      {255, 1}, {256, 256}, {300, 1000}, {4093, 2111}};
+  for (const auto& ext : extents) {
+    for (int max_value : {5, 1000, 100000}) {
+      run_single_scenario<Op, Tag, ValueType>(
+          ext.first, ext.second, max_value,
+          CustomLessThanComparator<ValueType>());
+      run_single_scenario<Op, Tag, ValueType>(ext.first, ext.second,
+                                              max_value,
+                                              CompareTens<ValueType>());
+    }
+  }
+}
+
+TEST(std_algorithms_set_ops, set_union) {
+  run_all_scenarios<SetOp::Union, DynamicTag, int>();
+  run_all_scenarios<SetOp::Union, StridedThreeTag, int>();
+}
+
+TEST(std_algorithms_set_ops, set_intersection) {
+  run_all_scenarios<SetOp::Intersection, DynamicTag, int>();
+  run_all_scenarios<SetOp::Intersection, StridedThreeTag, int>();
+}
+
+TEST(std_algorithms_set_ops, set_difference) {
+  run_all_scenarios<SetOp::Difference, DynamicTag, int>();
+  run_all_scenarios<SetOp::Difference, StridedThreeTag, int>();
+}
+
+TEST(std_algorithms_set_ops, default_comparator) {
+  using view_t = Kokkos::View<int*, exespace>;
+  view_t view1("view1", 5);
+  view_t view2("view2", 4);
+  view_t view_dest("view_dest", 9);
+  auto view1_h = create_mirror_view(Kokkos::HostSpace(), view1);
+  auto view2_h = create_mirror_view(Kokkos::HostSpace(), view2);
+
+  // {1, 2, 2, 4, 7} and {2, 4, 4, 8}
+  view1_h(0) = 1;
+  view1_h(1) = 2;
+  view1_h(2) = 2;
+  view1_h(3) = 4;
+  view1_h(4) = 7;
+  view2_h(0) = 2;
+  view2_h(1) = 4;
+  view2_h(2) = 4;
+  view2_h(3) = 8;
+  Kokkos::deep_copy(view1, view1_h);
+  Kokkos::deep_copy(view2, view2_h);
+
+  auto check = [&](auto result, std::vector<int> expected) {
+    ASSERT_EQ(std::size_t(result - KE::begin(view_dest)), expected.size());
+    auto view_dest_h = create_host_space_copy(view_dest);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(view_dest_h(i), expected[i]);
+    }
+  };
+  check(KE::set_union(exespace(), view1, view2, view_dest),
+        {1, 2, 2, 4, 4, 7, 8});
+  check(KE::set_intersection(exespace(), view1, view2, view_dest), {2, 4});
+  check(KE::set_difference(exespace(), view1, view2, view_dest), {1, 2, 7});
+}
+
+}  // namespace SetOps
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,223 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+// The simd fast paths only kick in on host execution spaces, compare them
+// with the std algorithms across block and simd tail boundaries.
+
+namespace Test {
+namespace stdalgos {
+namespace SimdHostFastPath {
+
+namespace KE = Kokkos::Experimental;
+
+using host_exespace = Kokkos::DefaultHostExecutionSpace;
+
+template <class ValueType, class Layout>
+using host_view_t = Kokkos::View<ValueType*, Layout, host_exespace>;
+
+// the fast paths need a native simd ABI, the tests below pass either way
+constexpr bool has_native_abi =
+    !std::is_same_v<KE::simd_abi::ForSpace<host_exespace>,
+                    KE::simd_abi::scalar>;
+
+static_assert(
+    KE::Impl::is_simd_host_range_v<
+        host_exespace, int,
+        KE::Impl::RandomAccessIterator<host_view_t<int, Kokkos::LayoutLeft>>> ==
+    has_native_abi);
+static_assert(!KE::Impl::is_simd_host_range_v<
+              host_exespace, int,
+              KE::Impl::RandomAccessIterator<
+                  host_view_t<int, Kokkos::LayoutStride>>>);
+
+// Small integer values, so that ties are frequent and the sums are exact
+// in floating point whatever the order of summation
+template <class ViewType>
+void fill(ViewType view, int seed) {
+  for (std::size_t i = 0; i < view.extent(0); ++i) {
+    view(i) = static_cast<typename ViewType::value_type>((i * 7 + seed) % 13);
+  }
+}
+
+template <class ValueType, class Layout>
+void test_reductions(std::size_t n) {
+  host_view_t<ValueType, Layout> a("a", n);
+  host_view_t<ValueType, Layout> b("b", n);
+  fill(a, 3);
+  fill(b, 5);
+  host_view_t<const ValueType, Layout> ca = a;
+
+  auto const first = KE::cbegin(a);
+  auto const last  = KE::cend(a);
+
+  ASSERT_EQ(KE::reduce(host_exespace(), ca),
+            std::accumulate(first, last, ValueType(0)));
+  ASSERT_EQ(KE::reduce(host_exespace(), a, ValueType(2)),
+            std::accumulate(first, last, ValueType(2)));
+  ASSERT_EQ(KE::transform_reduce(host_exespace(), ca, b, ValueType(1)),
+            std::inner_product(first, last, KE::cbegin(b), ValueType(1)));
+
+  for (ValueType value : {ValueType(0), ValueType(12), ValueType(13)}) {
+    ASSERT_EQ(KE::count(host_exespace(), ca, value),
+              std::count(first, last, value));
+  }
+}
+
+template <class ValueType, class Layout>
+void test_searches(std::size_t n) {
+  host_view_t<ValueType, Layout> a("a", n);
+  host_view_t<ValueType, Layout> b("b", n);
+  fill(a, 3);
+  Kokkos::deep_copy(b, a);
+  host_view_t<const ValueType, Layout> ca = a;
+
+  auto const first = KE::cbegin(a);
+  auto const last  = KE::cend(a);
+
+  for (ValueType value : {ValueType(0), ValueType(12), ValueType(13)}) {
+    ASSERT_EQ(KE::find(host_exespace(), ca, value) - first,
+              std::find(first, last, value) - first);
+  }
+
+  ASSERT_TRUE(KE::equal(host_exespace(), ca, b));
+  ASSERT_EQ(KE::mismatch(host_exespace(), ca, b).first - first,
+            std::ptrdiff_t(n));
+
+  // positions in the first block, in the simd tail of a block and in a
+  // later block, the first one wins when several differ
+  for (std::size_t pos : {std::size_t(0), n / 2, n - 1}) {
+    if (pos >= n) continue;
+    b(pos)   = ValueType(42);
+    b(n - 1) = ValueType(43);
+    ASSERT_FALSE(KE::equal(host_exespace(), ca, b));
+    ASSERT_EQ(KE::mismatch(host_exespace(), ca, b).first - first,
+              std::ptrdiff_t(pos));
+    ASSERT_EQ(KE::find(host_exespace(), b, ValueType(42)) - KE::begin(b),
+              std::ptrdiff_t(pos < n - 1 ? pos : n));
+    Kokkos::deep_copy(b, a);
+  }
+}
+
+template <class ValueType, class Layout>
+void test_min_max(std::size_t n) {
+  host_view_t<ValueType, Layout> a("a", n);
+  fill(a, 3);
+  host_view_t<const ValueType, Layout> ca = a;
+
+  auto const first = KE::cbegin(a);
+  auto const last  = KE::cend(a);
+
+  // every value repeats, so the positions check the tie breaking
+  ASSERT_EQ(KE::min_element(host_exespace(), ca) - first,
+            std::min_element(first, last) - first);
+  ASSERT_EQ(KE::max_element(host_exespace(), ca) - first,
+            std::max_element(first, last) - first);
+  auto const result   = KE::minmax_element(host_exespace(), ca);
+  auto const expected = std::minmax_element(first, last);
+  ASSERT_EQ(result.first - first, expected.first - first);
+  ASSERT_EQ(result.second - first, expected.second - first);
+
+  // a unique extremum in the last block
+  if (n > 0) {
+    a(n - 1) = ValueType(100);
+    ASSERT_EQ(KE::max_element(host_exespace(), ca) - first,
+              std::ptrdiff_t(n - 1));
+    ASSERT_EQ(KE::minmax_element(host_exespace(), ca).second - first,
+              std::ptrdiff_t(n - 1));
+  }
+}
+
+template <class ValueType, class Layout>
+void run_all(std::size_t n) {
+  test_reductions<ValueType, Layout>(n);
+  test_searches<ValueType, Layout>(n);
+  test_min_max<ValueType, Layout>(n);
+}
+
+template <class ValueType>
+void run_all_sizes() {
+  for (std::size_t n : {0, 1, 3, 7, 33, 2047, 2048, 2049, 10001}) {
+    run_all<ValueType, Kokkos::LayoutLeft>(n);
+    run_all<ValueType, Kokkos::LayoutRight>(n);
+  }
+}
+
+TEST(std_algorithms_simd_host_fast_path, test) {
+  run_all_sizes<int>();
+  run_all_sizes<std::int64_t>();
+  run_all_sizes<std::uint32_t>();
+  run_all_sizes<float>();
+  run_all_sizes<double>();
+}
+
+TEST(std_algorithms_simd_host_fast_path, nan) {
+  constexpr std::size_t n = 5000;
+  host_view_t<double, Kokkos::LayoutRight> a("a", n);
+  fill(a, 3);
+  a(3000) = std::numeric_limits<double>::quiet_NaN();
+
+  ASSERT_FALSE(KE::equal(host_exespace(), a, a));
+  ASSERT_EQ(KE::mismatch(host_exespace(), a, a).first - KE::begin(a), 3000);
+  ASSERT_EQ(KE::count(host_exespace(), a, a(3000)), 0);
+  ASSERT_EQ(KE::find(host_exespace(), a, a(3000)), KE::end(a));
+  ASSERT_TRUE(std::isnan(KE::reduce(host_exespace(), a)));
+}
+
+// NaNs never become an extremum, a range of NaNs only gives the positions of
+// the std algorithms
+TEST(std_algorithms_simd_host_fast_path, min_max_nan) {
+  constexpr std::size_t n = 3 * 2048 + 5;
+  constexpr double nan    = std::numeric_limits<double>::quiet_NaN();
+  host_view_t<double, Kokkos::LayoutRight> a("a", n);
+  fill(a, 3);
+  host_view_t<const double, Kokkos::LayoutRight> ca = a;
+  auto const first = KE::cbegin(a);
+  auto const last  = KE::cend(a);
+
+  // NaNs in every block, the second block only holds NaNs
+  for (std::size_t i = 5; i < n; i += 97) a(i) = nan;
+  for (std::size_t i = 2048; i < 2 * 2048; ++i) a(i) = nan;
+  a(1000) = -1.;
+  a(100)  = 20.;
+  ASSERT_EQ(KE::min_element(host_exespace(), ca) - first, 1000);
+  ASSERT_EQ(KE::max_element(host_exespace(), ca) - first, 100);
+  // the element-wise reducers let NaNs tie with the last maximum
+  if constexpr (has_native_abi) {
+    auto const result = KE::minmax_element(host_exespace(), ca);
+    ASSERT_EQ(result.first - first, 1000);
+    ASSERT_EQ(result.second - first, 100);
+  }
+
+  Kokkos::deep_copy(a, nan);
+  ASSERT_EQ(KE::min_element(host_exespace(), ca) - first,
+            std::min_element(first, last) - first);
+  ASSERT_EQ(KE::max_element(host_exespace(), ca) - first,
+            std::max_element(first, last) - first);
+  auto const result   = KE::minmax_element(host_exespace(), ca);
+  auto const expected = std::minmax_element(first, last);
+  ASSERT_EQ(result.first - first, expected.first - first);
+  ASSERT_EQ(result.second - first, expected.second - first);
+}
+
+}  // namespace SimdHostFastPath
+}  // namespace stdalgos
+}  // namespace Test
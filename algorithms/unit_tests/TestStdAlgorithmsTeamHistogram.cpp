@@ -0,0 +1,129 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamHistogram {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct BinOfValue {
+  int m_num_bins;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const ValueType& value) const {
+    return static_cast<int>(value) % m_num_bins;
+  }
+};
+
+template <class SourceViewType, class CountsViewType>
+struct TestFunctorA {
+  SourceViewType m_sourceView;
+  CountsViewType m_countsView;
+  int m_apiPick;
+
+  TestFunctorA(const SourceViewType sourceView, const CountsViewType countsView,
+               int apiPick)
+      : m_sourceView(sourceView),
+        m_countsView(countsView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView = Kokkos::subview(m_sourceView, myRowIndex, Kokkos::ALL());
+    auto myRowCounts =
+        Kokkos::subview(m_countsView, myRowIndex, Kokkos::ALL());
+    using value_type = typename SourceViewType::value_type;
+    const BinOfValue<value_type> binOp{int(m_countsView.extent(1))};
+
+    if (m_apiPick == 0) {
+      KE::histogram(member, KE::cbegin(myRowView), KE::cend(myRowView),
+                    myRowCounts, binOp);
+    } else if (m_apiPick == 1) {
+      KE::histogram(member, myRowView, myRowCounts, binOp);
+    }
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, int numBins, int apiId) {
+  /* description:
+     use a rank-2 view and compute the histogram of each row,
+     using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [sourceView, sourceView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{0, 100000}, "sourceView", 3231);
+  Kokkos::View<int**> countsView("countsView", numTeams, numBins);
+  Kokkos::deep_copy(countsView, 7);
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // use CTAD for functor
+  TestFunctorA fnc(sourceView, countsView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // check
+  // -----------------------------------------------
+  auto countsView_h = create_host_space_copy(countsView);
+  const BinOfValue<ValueType> binOp{numBins};
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    std::vector<int> expected(numBins, 0);
+    for (std::size_t j = 0; j < numCols; ++j) {
+      ++expected[binOp(sourceView_h(i, j))];
+    }
+    for (int b = 0; b < numBins; ++b) {
+      ASSERT_EQ(countsView_h(i, b), expected[b]);
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 5113}) {
+      for (int numBins : {1, 5, 300}) {
+        for (int apiId : {0, 1}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, numBins, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_histogram_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamHistogram
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamLowerUpperBound {
+
+namespace KE = Kokkos::Experimental;
+
+template <class SourceViewType, class ValuesViewType, class DestViewType,
+          class DistancesViewType, class IntraTeamSentinelView>
+struct TestFunctorA {
+  SourceViewType m_sourceView;
+  ValuesViewType m_valuesView;
+  DestViewType m_destView;
+  DistancesViewType m_distancesView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const SourceViewType sourceView, const ValuesViewType valuesView,
+               const DestViewType destView,
+               const DistancesViewType distancesView,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_sourceView(sourceView),
+        m_valuesView(valuesView),
+        m_destView(destView),
+        m_distancesView(distancesView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView = Kokkos::subview(m_sourceView, myRowIndex, Kokkos::ALL());
+    auto myRowViewValues =
+        Kokkos::subview(m_valuesView, myRowIndex, Kokkos::ALL());
+    auto myRowViewDest = Kokkos::subview(m_destView, myRowIndex, Kokkos::ALL());
+    using value_type   = typename SourceViewType::value_type;
+    ptrdiff_t resultDist = 0;
+
+    if (m_apiPick == 0) {
+      auto it    = KE::lower_bound(member, KE::cbegin(myRowView),
+                                   KE::cend(myRowView),
+                                   KE::cbegin(myRowViewValues),
+                                   KE::cend(myRowViewValues),
+                                   KE::begin(myRowViewDest));
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 1) {
+      auto it    = KE::lower_bound(member, myRowView, myRowViewValues,
+                                   myRowViewDest,
+                                   CustomLessThanComparator<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 2) {
+      auto it    = KE::upper_bound(member, KE::cbegin(myRowView),
+                                   KE::cend(myRowView),
+                                   KE::cbegin(myRowViewValues),
+                                   KE::cend(myRowViewValues),
+                                   KE::begin(myRowViewDest),
+                                   CustomLessThanComparator<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 3) {
+      auto it =
+          KE::upper_bound(member, myRowView, myRowViewValues, myRowViewDest);
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distancesView(myRowIndex) = resultDist;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distancesView
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, resultDist, m_distancesView(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, std::size_t numValues,
+            int apiId) {
+  /* description:
+     use a rank-2 view with sorted rows and search, within each row, the
+     position of the values from the same row of another rank-2 view.
+     Use one team per row.
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto sourceView =
+      create_view<ValueType>(LayoutTag{}, numTeams, numCols, "sourceView");
+  auto sourceView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(sourceView);
+  auto sourceView_h = create_mirror_view(Kokkos::HostSpace(), sourceView_dc);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> pool(
+      452349);
+  Kokkos::fill_random(sourceView_h, pool, ValueType{5}, ValueType{545});
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow = Kokkos::subview(sourceView_h, i, Kokkos::ALL());
+    std::sort(KE::begin(myRow), KE::end(myRow));
+  }
+  Kokkos::deep_copy(sourceView_dc, sourceView_h);
+  CopyFunctorRank2 F1(sourceView_dc, sourceView);
+  Kokkos::parallel_for("copy", sourceView.extent(0) * sourceView.extent(1),
+                       F1);
+
+  auto [valuesView, valuesView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numValues,
+      Kokkos::pair<ValueType, ValueType>{0, 550}, "valuesView");
+  auto destView = create_view<std::ptrdiff_t>(LayoutTag{}, numTeams, numValues,
+                                              "destView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // each team stores the distance of the returned iterator from the
+  // beginning of the interval that team operates on and then we check
+  // that these distances match the expectation
+  Kokkos::View<std::size_t*> distancesView("distancesView", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(sourceView, valuesView, destView, distancesView,
+                   intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run std algo and check
+  // -----------------------------------------------
+  auto distancesView_h         = create_host_space_copy(distancesView);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  auto destViewAfterOp_h       = create_host_space_copy(destView);
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow = Kokkos::subview(sourceView_h, i, Kokkos::ALL());
+    ASSERT_EQ(numValues, distancesView_h(i));
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+
+    for (std::size_t j = 0; j < numValues; ++j) {
+      const auto stdIt =
+          apiId <= 1
+              ? std::lower_bound(KE::cbegin(myRow), KE::cend(myRow),
+                                 valuesView_h(i, j))
+              : std::upper_bound(KE::cbegin(myRow), KE::cend(myRow),
+                                 valuesView_h(i, j));
+      ASSERT_EQ(KE::distance(KE::cbegin(myRow), stdIt),
+                destViewAfterOp_h(i, j));
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444}) {
+      for (const auto& numValues : {0, 1, 51, 1153}) {
+        for (int apiId : {0, 1, 2, 3}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, numValues, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_lower_upper_bound_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamLowerUpperBound
+}  // namespace stdalgos
+}  // namespace Test
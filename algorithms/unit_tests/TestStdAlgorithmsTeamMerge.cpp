@@ -0,0 +1,230 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamMerge {
+
+namespace KE = Kokkos::Experimental;
+
+// compares the tens only, so that merging is observably stable
+template <class ValueType>
+struct CompareTens {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a / 10 < b / 10;
+  }
+};
+
+// creates a rank-2 view whose rows are made of the sorted ranges
+// [0, middle) and [middle, numCols), together with its host clone
+template <class LayoutTag, class ValueType>
+auto create_view_with_sorted_row_ranges(LayoutTag, std::size_t numRows,
+                                        std::size_t numCols, std::size_t middle,
+                                        const std::string& label,
+                                        std::size_t seed) {
+  auto dataView = create_view<ValueType>(LayoutTag{}, numRows, numCols, label);
+  auto dataView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(dataView);
+  auto dataView_dc_h = create_mirror_view(Kokkos::HostSpace(), dataView_dc);
+
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> pool(seed);
+  Kokkos::fill_random(dataView_dc_h, pool, ValueType{0}, ValueType{500});
+  for (std::size_t i = 0; i < numRows; ++i) {
+    auto myRow = Kokkos::subview(dataView_dc_h, i, Kokkos::ALL());
+    std::sort(KE::begin(myRow), KE::begin(myRow) + middle,
+              CompareTens<ValueType>());
+    std::sort(KE::begin(myRow) + middle, KE::end(myRow),
+              CompareTens<ValueType>());
+  }
+
+  Kokkos::deep_copy(dataView_dc, dataView_dc_h);
+  CopyFunctorRank2 F1(dataView_dc, dataView);
+  Kokkos::parallel_for("copy", dataView.extent(0) * dataView.extent(1), F1);
+
+  return std::make_pair(dataView, dataView_dc_h);
+}
+
+template <class SourceView1Type, class SourceView2Type, class DestViewType,
+          class DistancesViewType, class IntraTeamSentinelView>
+struct TestFunctorA {
+  SourceView1Type m_sourceView1;
+  SourceView2Type m_sourceView2;
+  DestViewType m_destView;
+  DistancesViewType m_distancesView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const SourceView1Type sourceView1,
+               const SourceView2Type sourceView2, const DestViewType destView,
+               const DistancesViewType distancesView,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_sourceView1(sourceView1),
+        m_sourceView2(sourceView2),
+        m_destView(destView),
+        m_distancesView(distancesView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView1 = Kokkos::subview(m_sourceView1, myRowIndex, Kokkos::ALL());
+    auto myRowView2 = Kokkos::subview(m_sourceView2, myRowIndex, Kokkos::ALL());
+    auto myRowViewDest =
+        Kokkos::subview(m_destView, myRowIndex, Kokkos::ALL());
+    using value_type = typename SourceView1Type::value_type;
+    ptrdiff_t resultDist = 0;
+
+    if (m_apiPick == 0) {
+      auto it = KE::merge(member, KE::cbegin(myRowView1), KE::cend(myRowView1),
+                          KE::cbegin(myRowView2), KE::cend(myRowView2),
+                          KE::begin(myRowViewDest), CompareTens<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 1) {
+      auto it = KE::merge(member, myRowView1, myRowView2, myRowViewDest,
+                          CompareTens<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 2) {
+      // in place: the first range is the row of the destination
+      KE::inplace_merge(member, KE::begin(myRowViewDest),
+                        KE::begin(myRowViewDest) + myRowView1.extent(0),
+                        KE::end(myRowViewDest), CompareTens<value_type>());
+      resultDist = myRowViewDest.extent(0);
+    } else if (m_apiPick == 3) {
+      KE::inplace_merge(member, myRowViewDest, myRowView1.extent(0),
+                        CompareTens<value_type>());
+      resultDist = myRowViewDest.extent(0);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distancesView(myRowIndex) = resultDist;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distancesView
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, resultDist, m_distancesView(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols1, std::size_t numCols2,
+            int apiId) {
+  /* description:
+     use rank-2 views with sorted rows and run a team-level merge, or
+     a team-level inplace_merge on the concatenation of the rows,
+     using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [sourceView1, sourceView1_h] =
+      create_view_with_sorted_row_ranges<LayoutTag, ValueType>(
+          LayoutTag{}, numTeams, numCols1, numCols1, "sourceView1", 3231);
+  auto [sourceView2, sourceView2_h] =
+      create_view_with_sorted_row_ranges<LayoutTag, ValueType>(
+          LayoutTag{}, numTeams, numCols2, numCols2, "sourceView2", 8751);
+  auto [destView, destView_h] =
+      create_view_with_sorted_row_ranges<LayoutTag, ValueType>(
+          LayoutTag{}, numTeams, numCols1 + numCols2, numCols1, "destView",
+          5137);
+  auto cloneOfDestViewBeforeOp_h = create_host_space_copy(destView);
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // each team stores the distance of the returned iterator from the
+  // beginning of the interval that team operates on and then we check
+  // that these distances match the expectation
+  Kokkos::View<std::size_t*> distancesView("distancesView", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(sourceView1, sourceView2, destView, distancesView,
+                   intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run std algo and check
+  // -----------------------------------------------
+  auto distancesView_h         = create_host_space_copy(distancesView);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  auto destViewAfterOp_h       = create_host_space_copy(destView);
+  Kokkos::View<ValueType**, Kokkos::HostSpace> stdDestView(
+      "stdDestView", numTeams, numCols1 + numCols2);
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow1       = Kokkos::subview(sourceView1_h, i, Kokkos::ALL());
+    auto myRow2       = Kokkos::subview(sourceView2_h, i, Kokkos::ALL());
+    auto myRowStdDest = Kokkos::subview(stdDestView, i, Kokkos::ALL());
+    auto myRowDest =
+        Kokkos::subview(cloneOfDestViewBeforeOp_h, i, Kokkos::ALL());
+
+    if (apiId <= 1) {
+      std::merge(KE::cbegin(myRow1), KE::cend(myRow1), KE::cbegin(myRow2),
+                 KE::cend(myRow2), KE::begin(myRowStdDest),
+                 CompareTens<ValueType>());
+    } else {
+      std::copy(KE::cbegin(myRowDest), KE::cend(myRowDest),
+                KE::begin(myRowStdDest));
+      std::inplace_merge(KE::begin(myRowStdDest),
+                         KE::begin(myRowStdDest) + numCols1,
+                         KE::end(myRowStdDest), CompareTens<ValueType>());
+    }
+    ASSERT_EQ(numCols1 + numCols2, distancesView_h(i));
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+
+  expect_equal_host_views(stdDestView, destViewAfterOp_h);
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {std::make_pair(0, 0), std::make_pair(0, 3),
+                                std::make_pair(5, 0), std::make_pair(1, 1),
+                                std::make_pair(13, 101),
+                                std::make_pair(517, 400),
+                                std::make_pair(1444, 1111)}) {
+      for (int apiId : {0, 1, 2, 3}) {
+        test_A<LayoutTag, ValueType>(numTeams, numCols.first, numCols.second,
+                                     apiId);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_merge_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamMerge
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamNthElement {
+
+namespace KE = Kokkos::Experimental;
+
+// sorts copies of both rows, std::is_permutation is quadratic
+template <class RowType1, class RowType2>
+bool is_permutation_of(RowType1 row1, RowType2 row2) {
+  std::vector<typename RowType1::value_type> values1(KE::cbegin(row1),
+                                                     KE::cend(row1));
+  std::vector<typename RowType2::value_type> values2(KE::cbegin(row2),
+                                                     KE::cend(row2));
+  std::sort(values1.begin(), values1.end());
+  std::sort(values2.begin(), values2.end());
+  return values1 == values2;
+}
+
+template <class ViewType>
+struct TestFunctorA {
+  ViewType m_view;
+  std::size_t m_position;
+  int m_apiPick;
+
+  TestFunctorA(const ViewType view, std::size_t position, int apiPick)
+      : m_view(view), m_position(position), m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView        = Kokkos::subview(m_view, myRowIndex, Kokkos::ALL());
+    using value_type      = typename ViewType::value_type;
+
+    if (m_apiPick == 0) {
+      KE::nth_element(member, KE::begin(myRowView),
+                      KE::begin(myRowView) + m_position, KE::end(myRowView));
+    } else if (m_apiPick == 1) {
+      KE::nth_element(member, myRowView, m_position,
+                      CustomLessThanComparator<value_type>());
+    } else if (m_apiPick == 2) {
+      KE::partial_sort(member, KE::begin(myRowView),
+                       KE::begin(myRowView) + m_position, KE::end(myRowView),
+                       CustomLessThanComparator<value_type>());
+    } else if (m_apiPick == 3) {
+      KE::partial_sort(member, myRowView, m_position);
+    }
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, std::size_t position,
+            int apiId) {
+  /* description:
+     use a rank-2 view randomly filled with values and run a team-level
+     nth_element or partial_sort, using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [dataView, cloneOfDataViewBeforeOp_h] =
+      create_random_view_and_host_clone(
+          LayoutTag{}, numTeams, numCols,
+          Kokkos::pair<ValueType, ValueType>{5, 523}, "dataView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // use CTAD for functor
+  TestFunctorA fnc(dataView, position, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run std algo and check
+  // -----------------------------------------------
+  auto dataViewAfterOp_h = create_host_space_copy(dataView);
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow = Kokkos::subview(cloneOfDataViewBeforeOp_h, i, Kokkos::ALL());
+    auto myRowAfterOp = Kokkos::subview(dataViewAfterOp_h, i, Kokkos::ALL());
+    ASSERT_TRUE(is_permutation_of(myRowAfterOp, myRow));
+
+    if (apiId <= 1) {
+      if (position == numCols) {
+        continue;
+      }
+      std::nth_element(KE::begin(myRow), KE::begin(myRow) + position,
+                       KE::end(myRow));
+      ASSERT_EQ(myRow(position), myRowAfterOp(position));
+      for (std::size_t j = 0; j < position; ++j) {
+        ASSERT_FALSE(myRowAfterOp(position) < myRowAfterOp(j));
+      }
+      for (std::size_t j = position + 1; j < numCols; ++j) {
+        ASSERT_FALSE(myRowAfterOp(j) < myRowAfterOp(position));
+      }
+    } else {
+      std::partial_sort(KE::begin(myRow), KE::begin(myRow) + position,
+                        KE::end(myRow));
+      for (std::size_t j = 0; j < position; ++j) {
+        ASSERT_EQ(myRow(j), myRowAfterOp(j));
+      }
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 2155}) {
+      for (std::size_t position : {std::size_t(0), std::size_t(numCols / 3),
+                                   std::size_t(numCols)}) {
+        for (int apiId : {0, 1, 2, 3}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, position, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_nth_element_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamNthElement
+}  // namespace stdalgos
+}  // namespace Test
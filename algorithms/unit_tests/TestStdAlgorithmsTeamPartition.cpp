@@ -0,0 +1,194 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamPartition {
+
+namespace KE = Kokkos::Experimental;
+
+// sorts copies of both rows, std::is_permutation is quadratic
+template <class RowType1, class RowType2>
+bool is_permutation_of(RowType1 row1, RowType2 row2) {
+  std::vector<typename RowType1::value_type> values1(KE::cbegin(row1),
+                                                     KE::cend(row1));
+  std::vector<typename RowType2::value_type> values2(KE::cbegin(row2),
+                                                     KE::cend(row2));
+  std::sort(values1.begin(), values1.end());
+  std::sort(values2.begin(), values2.end());
+  return values1 == values2;
+}
+
+template <class ValueType>
+struct GreaterThanValueFunctor {
+  ValueType m_val;
+
+  KOKKOS_INLINE_FUNCTION
+  GreaterThanValueFunctor(ValueType val) : m_val(val) {}
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(ValueType val) const { return (val > m_val); }
+};
+
+template <class ViewType, class DistancesViewType, class IntraTeamSentinelView,
+          class ValueType>
+struct TestFunctorA {
+  ViewType m_view;
+  DistancesViewType m_distancesView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  ValueType m_threshold;
+  int m_apiPick;
+
+  TestFunctorA(const ViewType view, const DistancesViewType distancesView,
+               const IntraTeamSentinelView intraTeamSentinelView,
+               ValueType threshold, int apiPick)
+      : m_view(view),
+        m_distancesView(distancesView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_threshold(threshold),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView        = Kokkos::subview(m_view, myRowIndex, Kokkos::ALL());
+    ptrdiff_t resultDist  = 0;
+    GreaterThanValueFunctor predicate(m_threshold);
+
+    if (m_apiPick == 0) {
+      auto it =
+          KE::partition(member, KE::begin(myRowView), KE::end(myRowView),
+                        predicate);
+      resultDist = KE::distance(KE::begin(myRowView), it);
+    } else if (m_apiPick == 1) {
+      auto it    = KE::partition(member, myRowView, predicate);
+      resultDist = KE::distance(KE::begin(myRowView), it);
+    } else if (m_apiPick == 2) {
+      auto it    = KE::stable_partition(member, KE::begin(myRowView),
+                                        KE::end(myRowView), predicate);
+      resultDist = KE::distance(KE::begin(myRowView), it);
+    } else if (m_apiPick == 3) {
+      auto it    = KE::stable_partition(member, myRowView, predicate);
+      resultDist = KE::distance(KE::begin(myRowView), it);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distancesView(myRowIndex) = resultDist;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distancesView
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, resultDist, m_distancesView(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, int apiId) {
+  /* description:
+     use a rank-2 view randomly filled with values and run a team-level
+     partition or stable_partition, using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [dataView, cloneOfDataViewBeforeOp_h] =
+      create_random_view_and_host_clone(
+          LayoutTag{}, numTeams, numCols,
+          Kokkos::pair<ValueType, ValueType>{5, 523}, "dataView");
+  const ValueType threshold = 151;
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // each team stores the distance of the returned iterator from the
+  // beginning of the interval that team operates on and then we check
+  // that these distances match the expectation
+  Kokkos::View<std::size_t*> distancesView("distancesView", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(dataView, distancesView, intraTeamSentinelView, threshold,
+                   apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run std algo and check
+  // -----------------------------------------------
+  auto distancesView_h         = create_host_space_copy(distancesView);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  auto dataViewAfterOp_h       = create_host_space_copy(dataView);
+  GreaterThanValueFunctor<ValueType> predicate(threshold);
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow = Kokkos::subview(cloneOfDataViewBeforeOp_h, i, Kokkos::ALL());
+    auto myRowAfterOp = Kokkos::subview(dataViewAfterOp_h, i, Kokkos::ALL());
+
+    if (apiId <= 1) {
+      // partition is not stable: check that the row is partitioned and
+      // is a permutation of the original one
+      const std::size_t stdDistance =
+          std::count_if(KE::cbegin(myRow), KE::cend(myRow), predicate);
+      ASSERT_EQ(stdDistance, distancesView_h(i));
+      ASSERT_TRUE(std::is_partitioned(KE::cbegin(myRowAfterOp),
+                                      KE::cend(myRowAfterOp), predicate));
+      ASSERT_TRUE(is_permutation_of(myRowAfterOp, myRow));
+    } else {
+      auto it = std::stable_partition(KE::begin(myRow), KE::end(myRow),
+                                      predicate);
+      const std::size_t stdDistance = KE::distance(KE::begin(myRow), it);
+      ASSERT_EQ(stdDistance, distancesView_h(i));
+    }
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+  }
+
+  if (apiId > 1) {
+    expect_equal_host_views(cloneOfDataViewBeforeOp_h, dataViewAfterOp_h);
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 5113}) {
+      for (int apiId : {0, 1, 2, 3}) {
+        test_A<LayoutTag, ValueType>(numTeams, numCols, apiId);
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_partition_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamPartition
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,239 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamScanByKey {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct SameParity {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return (a % 2) == (b % 2);
+  }
+};
+
+template <class ValueType>
+struct MaxOp {
+  KOKKOS_INLINE_FUNCTION
+  ValueType operator()(const ValueType& a, const ValueType& b) const {
+    return a < b ? b : a;
+  }
+};
+
+template <class KeysViewType, class ValuesViewType, class DestViewType,
+          class KeysDestViewType, class DistancesViewType,
+          class IntraTeamSentinelView>
+struct TestFunctorA {
+  KeysViewType m_keysView;
+  ValuesViewType m_valuesView;
+  DestViewType m_destView;
+  KeysDestViewType m_keysDestView;
+  DistancesViewType m_distancesView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const KeysViewType keysView, const ValuesViewType valuesView,
+               const DestViewType destView,
+               const KeysDestViewType keysDestView,
+               const DistancesViewType distancesView,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_keysView(keysView),
+        m_valuesView(valuesView),
+        m_destView(destView),
+        m_keysDestView(keysDestView),
+        m_distancesView(distancesView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowKeys   = Kokkos::subview(m_keysView, myRowIndex, Kokkos::ALL());
+    auto myRowValues = Kokkos::subview(m_valuesView, myRowIndex, Kokkos::ALL());
+    auto myRowDest   = Kokkos::subview(m_destView, myRowIndex, Kokkos::ALL());
+    auto myRowKeysDest =
+        Kokkos::subview(m_keysDestView, myRowIndex, Kokkos::ALL());
+    using key_type   = typename KeysViewType::value_type;
+    using value_type = typename ValuesViewType::value_type;
+    ptrdiff_t resultDist = 0;
+
+    if (m_apiPick == 0) {
+      auto it    = KE::inclusive_scan_by_key(member, KE::cbegin(myRowKeys),
+                                             KE::cend(myRowKeys),
+                                             KE::cbegin(myRowValues),
+                                             KE::begin(myRowDest));
+      resultDist = KE::distance(KE::begin(myRowDest), it);
+    } else if (m_apiPick == 1) {
+      auto it    = KE::inclusive_scan_by_key(member, myRowKeys, myRowValues,
+                                             myRowDest, SameParity<key_type>(),
+                                             MaxOp<value_type>());
+      resultDist = KE::distance(KE::begin(myRowDest), it);
+    } else if (m_apiPick == 2) {
+      auto it = KE::exclusive_scan_by_key(
+          member, KE::cbegin(myRowKeys), KE::cend(myRowKeys),
+          KE::cbegin(myRowValues), KE::begin(myRowDest), value_type{3},
+          SameParity<key_type>());
+      resultDist = KE::distance(KE::begin(myRowDest), it);
+    } else if (m_apiPick == 3) {
+      auto it    = KE::exclusive_scan_by_key(member, myRowKeys, myRowValues,
+                                             myRowDest, value_type{3});
+      resultDist = KE::distance(KE::begin(myRowDest), it);
+    } else if (m_apiPick == 4) {
+      auto res   = KE::reduce_by_key(member, KE::cbegin(myRowKeys),
+                                     KE::cend(myRowKeys),
+                                     KE::cbegin(myRowValues),
+                                     KE::begin(myRowKeysDest),
+                                     KE::begin(myRowDest));
+      resultDist = KE::distance(KE::begin(myRowDest), res.second);
+    } else if (m_apiPick == 5) {
+      auto res   = KE::reduce_by_key(member, myRowKeys, myRowValues,
+                                     myRowKeysDest, myRowDest,
+                                     SameParity<key_type>(),
+                                     MaxOp<value_type>());
+      resultDist = KE::distance(KE::begin(myRowDest), res.second);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distancesView(myRowIndex) = resultDist;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distancesView
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, resultDist, m_distancesView(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols, int maxKey, int apiId) {
+  /* description:
+     use rank-2 views of keys and values and run a team-level
+     scan or reduction by key, using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [keysView, keysView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols, Kokkos::pair<int, int>{0, maxKey + 1},
+      "keysView", 3231);
+  auto [valuesView, valuesView_h] = create_random_view_and_host_clone(
+      LayoutTag{}, numTeams, numCols,
+      Kokkos::pair<ValueType, ValueType>{0, 100}, "valuesView", 8751);
+  auto destView =
+      create_view<ValueType>(LayoutTag{}, numTeams, numCols, "destView");
+  auto keysDestView =
+      create_view<int>(LayoutTag{}, numTeams, numCols, "keysDestView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // each team stores the distance of the returned iterator from the
+  // beginning of the interval that team operates on and then we check
+  // that these distances match the expectation
+  Kokkos::View<std::size_t*> distancesView("distancesView", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(keysView, valuesView, destView, keysDestView,
+                   distancesView, intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run reference and check
+  // -----------------------------------------------
+  auto distancesView_h         = create_host_space_copy(distancesView);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  auto destViewAfterOp_h       = create_host_space_copy(destView);
+  auto keysDestViewAfterOp_h   = create_host_space_copy(keysDestView);
+  const bool customOps         = apiId == 1 || apiId == 5;
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    std::vector<int> expectedKeys;
+    std::vector<ValueType> expectedValues;
+    ValueType update{};
+    for (std::size_t j = 0; j < numCols; ++j) {
+      const int prevKey     = j == 0 ? 0 : keysView_h(i, j - 1);
+      const int key         = keysView_h(i, j);
+      const ValueType value = valuesView_h(i, j);
+      const bool head =
+          j == 0 || (customOps || apiId == 2 ? (prevKey % 2) != (key % 2)
+                                             : prevKey != key);
+      if (apiId <= 1) {
+        update = head ? value
+                      : (customOps ? MaxOp<ValueType>()(update, value)
+                                   : update + value);
+        expectedValues.push_back(update);
+      } else if (apiId <= 3) {
+        update = head ? ValueType{3} : update;
+        expectedValues.push_back(update);
+        update = update + value;
+      } else if (head) {
+        expectedKeys.push_back(key);
+        expectedValues.push_back(value);
+      } else {
+        expectedValues.back() =
+            customOps ? MaxOp<ValueType>()(expectedValues.back(), value)
+                      : expectedValues.back() + value;
+      }
+    }
+
+    ASSERT_EQ(expectedValues.size(), distancesView_h(i));
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+    for (std::size_t j = 0; j < expectedValues.size(); ++j) {
+      ASSERT_EQ(destViewAfterOp_h(i, j), expectedValues[j]);
+    }
+    for (std::size_t j = 0; j < expectedKeys.size(); ++j) {
+      ASSERT_EQ(keysDestViewAfterOp_h(i, j), expectedKeys[j]);
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {0, 1, 2, 13, 101, 1444, 5113}) {
+      for (int maxKey : {0, 3, 1000}) {
+        for (int apiId : {0, 1, 2, 3, 4, 5}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols, maxKey, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_scan_by_key_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamScanByKey
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,231 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamSetOps {
+
+namespace KE = Kokkos::Experimental;
+
+// creates a rank-2 view with sorted rows, together with its host clone
+template <class LayoutTag, class ValueType>
+auto create_view_with_sorted_rows(LayoutTag, std::size_t numRows,
+                                  std::size_t numCols, ValueType maxValue,
+                                  const std::string& label, std::size_t seed) {
+  auto dataView = create_view<ValueType>(LayoutTag{}, numRows, numCols, label);
+  auto dataView_dc =
+      create_deep_copyable_compatible_view_with_same_extent(dataView);
+  auto dataView_dc_h = create_mirror_view(Kokkos::HostSpace(), dataView_dc);
+
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultHostExecutionSpace> pool(seed);
+  Kokkos::fill_random(dataView_dc_h, pool, ValueType{0}, maxValue);
+  for (std::size_t i = 0; i < numRows; ++i) {
+    auto myRow = Kokkos::subview(dataView_dc_h, i, Kokkos::ALL());
+    std::sort(KE::begin(myRow), KE::end(myRow));
+  }
+
+  Kokkos::deep_copy(dataView_dc, dataView_dc_h);
+  CopyFunctorRank2 F1(dataView_dc, dataView);
+  Kokkos::parallel_for("copy", dataView.extent(0) * dataView.extent(1), F1);
+
+  return std::make_pair(dataView, dataView_dc_h);
+}
+
+template <class SourceView1Type, class SourceView2Type, class DestViewType,
+          class DistancesViewType, class IntraTeamSentinelView>
+struct TestFunctorA {
+  SourceView1Type m_sourceView1;
+  SourceView2Type m_sourceView2;
+  DestViewType m_destView;
+  DistancesViewType m_distancesView;
+  IntraTeamSentinelView m_intraTeamSentinelView;
+  int m_apiPick;
+
+  TestFunctorA(const SourceView1Type sourceView1,
+               const SourceView2Type sourceView2, const DestViewType destView,
+               const DistancesViewType distancesView,
+               const IntraTeamSentinelView intraTeamSentinelView, int apiPick)
+      : m_sourceView1(sourceView1),
+        m_sourceView2(sourceView2),
+        m_destView(destView),
+        m_distancesView(distancesView),
+        m_intraTeamSentinelView(intraTeamSentinelView),
+        m_apiPick(apiPick) {}
+
+  template <class MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType& member) const {
+    const auto myRowIndex = member.league_rank();
+    auto myRowView1 = Kokkos::subview(m_sourceView1, myRowIndex, Kokkos::ALL());
+    auto myRowView2 = Kokkos::subview(m_sourceView2, myRowIndex, Kokkos::ALL());
+    auto myRowViewDest =
+        Kokkos::subview(m_destView, myRowIndex, Kokkos::ALL());
+    using value_type = typename SourceView1Type::value_type;
+    ptrdiff_t resultDist = 0;
+
+    if (m_apiPick == 0) {
+      auto it    = KE::set_union(member, KE::cbegin(myRowView1),
+                                 KE::cend(myRowView1), KE::cbegin(myRowView2),
+                                 KE::cend(myRowView2),
+                                 KE::begin(myRowViewDest));
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 1) {
+      auto it    = KE::set_union(member, myRowView1, myRowView2, myRowViewDest,
+                                 CustomLessThanComparator<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 2) {
+      auto it = KE::set_intersection(
+          member, KE::cbegin(myRowView1), KE::cend(myRowView1),
+          KE::cbegin(myRowView2), KE::cend(myRowView2),
+          KE::begin(myRowViewDest), CustomLessThanComparator<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 3) {
+      auto it =
+          KE::set_intersection(member, myRowView1, myRowView2, myRowViewDest);
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 4) {
+      auto it    = KE::set_difference(member, KE::cbegin(myRowView1),
+                                      KE::cend(myRowView1),
+                                      KE::cbegin(myRowView2),
+                                      KE::cend(myRowView2),
+                                      KE::begin(myRowViewDest));
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    } else if (m_apiPick == 5) {
+      auto it =
+          KE::set_difference(member, myRowView1, myRowView2, myRowViewDest,
+                             CustomLessThanComparator<value_type>());
+      resultDist = KE::distance(KE::begin(myRowViewDest), it);
+    }
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_distancesView(myRowIndex) = resultDist;
+    });
+
+    // store result of checking if all members have their local
+    // values matching the one stored in m_distancesView
+    member.team_barrier();
+    const bool intraTeamCheck = team_members_have_matching_result(
+        member, resultDist, m_distancesView(myRowIndex));
+    Kokkos::single(Kokkos::PerTeam(member), [=, *this]() {
+      m_intraTeamSentinelView(myRowIndex) = intraTeamCheck;
+    });
+  }
+};
+
+template <class LayoutTag, class ValueType>
+void test_A(std::size_t numTeams, std::size_t numCols1, std::size_t numCols2,
+            ValueType maxValue, int apiId) {
+  /* description:
+     use rank-2 views with sorted rows and run a team-level set operation,
+     using one team per row
+   */
+
+  // -----------------------------------------------
+  // prepare data
+  // -----------------------------------------------
+  auto [sourceView1, sourceView1_h] =
+      create_view_with_sorted_rows<LayoutTag, ValueType>(
+          LayoutTag{}, numTeams, numCols1, maxValue, "sourceView1", 3231);
+  auto [sourceView2, sourceView2_h] =
+      create_view_with_sorted_rows<LayoutTag, ValueType>(
+          LayoutTag{}, numTeams, numCols2, maxValue, "sourceView2", 8751);
+  auto destView = create_view<ValueType>(LayoutTag{}, numTeams,
+                                         numCols1 + numCols2, "destView");
+
+  // -----------------------------------------------
+  // launch kokkos kernel
+  // -----------------------------------------------
+  using space_t = Kokkos::DefaultExecutionSpace;
+  Kokkos::TeamPolicy<space_t> policy(numTeams, Kokkos::AUTO());
+
+  // each team stores the distance of the returned iterator from the
+  // beginning of the interval that team operates on and then we check
+  // that these distances match the expectation
+  Kokkos::View<std::size_t*> distancesView("distancesView", numTeams);
+  // sentinel to check if all members of the team compute the same result
+  Kokkos::View<bool*> intraTeamSentinelView("intraTeamSameResult", numTeams);
+
+  // use CTAD for functor
+  TestFunctorA fnc(sourceView1, sourceView2, destView, distancesView,
+                   intraTeamSentinelView, apiId);
+  Kokkos::parallel_for(policy, fnc);
+
+  // -----------------------------------------------
+  // run std algo and check
+  // -----------------------------------------------
+  auto distancesView_h         = create_host_space_copy(distancesView);
+  auto intraTeamSentinelView_h = create_host_space_copy(intraTeamSentinelView);
+  auto destViewAfterOp_h       = create_host_space_copy(destView);
+  Kokkos::View<ValueType**, Kokkos::HostSpace> stdDestView(
+      "stdDestView", numTeams, numCols1 + numCols2);
+
+  for (std::size_t i = 0; i < numTeams; ++i) {
+    auto myRow1       = Kokkos::subview(sourceView1_h, i, Kokkos::ALL());
+    auto myRow2       = Kokkos::subview(sourceView2_h, i, Kokkos::ALL());
+    auto myRowStdDest = Kokkos::subview(stdDestView, i, Kokkos::ALL());
+
+    auto stdIt = KE::begin(myRowStdDest);
+    if (apiId <= 1) {
+      stdIt = std::set_union(KE::cbegin(myRow1), KE::cend(myRow1),
+                             KE::cbegin(myRow2), KE::cend(myRow2),
+                             KE::begin(myRowStdDest));
+    } else if (apiId <= 3) {
+      stdIt = std::set_intersection(KE::cbegin(myRow1), KE::cend(myRow1),
+                                    KE::cbegin(myRow2), KE::cend(myRow2),
+                                    KE::begin(myRowStdDest));
+    } else {
+      stdIt = std::set_difference(KE::cbegin(myRow1), KE::cend(myRow1),
+                                  KE::cbegin(myRow2), KE::cend(myRow2),
+                                  KE::begin(myRowStdDest));
+    }
+    const std::size_t stdDistance =
+        KE::distance(KE::begin(myRowStdDest), stdIt);
+    ASSERT_EQ(stdDistance, distancesView_h(i));
+    ASSERT_TRUE(intraTeamSentinelView_h(i));
+    for (std::size_t j = 0; j < stdDistance; ++j) {
+      ASSERT_EQ(destViewAfterOp_h(i, j), stdDestView(i, j));
+    }
+  }
+}
+
+template <class LayoutTag, class ValueType>
+void run_all_scenarios() {
+  for (int numTeams : teamSizesToTest) {
+    for (const auto& numCols : {std::make_pair(0, 0), std::make_pair(0, 3),
+                                std::make_pair(5, 0), std::make_pair(1, 1),
+                                std::make_pair(13, 101),
+                                std::make_pair(517, 400),
+                                std::make_pair(1444, 1111)}) {
+      for (ValueType maxValue : {ValueType{10}, ValueType{5000}}) {
+        for (int apiId : {0, 1, 2, 3, 4, 5}) {
+          test_A<LayoutTag, ValueType>(numTeams, numCols.first,
+                                       numCols.second, maxValue, apiId);
+        }
+      }
+    }
+  }
+}
+
+TEST(std_algorithms_set_ops_team_test, test) {
+  run_all_scenarios<DynamicTag, int>();
+  run_all_scenarios<StridedTwoRowsTag, int>();
+  run_all_scenarios<StridedThreeRowsTag, int>();
+}
+
+}  // namespace TeamSetOps
+}  // namespace stdalgos
+}  // namespace Test
@@ -16,7 +16,7 @@
 
 template <class Scalar, int UNROLL>
 struct RunGather {
-  static void run(int N, int K, int D, int R, int F);
+  static void run(int N, int K, int D, int R, int F, int P);
 };
 
 #define UNROLL 1
@@ -45,13 +45,13 @@ struct RunGather {
 #undef UNROLL
 
 template <class Scalar>
-void run_gather_test(int N, int K, int D, int R, int U, int F) {
-  if (U == 1) RunGather<Scalar, 1>::run(N, K, D, R, F);
-  if (U == 2) RunGather<Scalar, 2>::run(N, K, D, R, F);
-  if (U == 3) RunGather<Scalar, 3>::run(N, K, D, R, F);
-  if (U == 4) RunGather<Scalar, 4>::run(N, K, D, R, F);
-  if (U == 5) RunGather<Scalar, 5>::run(N, K, D, R, F);
-  if (U == 6) RunGather<Scalar, 6>::run(N, K, D, R, F);
-  if (U == 7) RunGather<Scalar, 7>::run(N, K, D, R, F);
-  if (U == 8) RunGather<Scalar, 8>::run(N, K, D, R, F);
+void run_gather_test(int N, int K, int D, int R, int U, int F, int P) {
+  if (U == 1) RunGather<Scalar, 1>::run(N, K, D, R, F, P);
+  if (U == 2) RunGather<Scalar, 2>::run(N, K, D, R, F, P);
+  if (U == 3) RunGather<Scalar, 3>::run(N, K, D, R, F, P);
+  if (U == 4) RunGather<Scalar, 4>::run(N, K, D, R, F, P);
+  if (U == 5) RunGather<Scalar, 5>::run(N, K, D, R, F, P);
+  if (U == 6) RunGather<Scalar, 6>::run(N, K, D, R, F, P);
+  if (U == 7) RunGather<Scalar, 7>::run(N, K, D, R, F, P);
+  if (U == 8) RunGather<Scalar, 8>::run(N, K, D, R, F, P);
 }
@@ -23,7 +23,7 @@ int main(int argc, char* argv[]) {
   Kokkos::initialize(argc, argv);
 
   if (argc < 8) {
-    printf("Arguments: S N K D\n");
+    printf("Arguments: S N K D R U F [P]\n");
     printf(
         "  S:   Scalar Type Size (1==float, 2==double, 4=complex<double>)\n");
     printf("  N:   Number of entities\n");
@@ -34,12 +34,17 @@ int main(int argc, char* argv[]) {
     printf(
         "  F:   how many times to repeat the U unrolled operations before "
         "reading next element\n");
+    printf(
+        "  P:   prefetch distance of the host execution spaces, one of "
+        "0,4,8,16,32,64 (default 0 == no prefetching)\n");
     printf("Example Input GPU:\n");
     printf("  Bandwidth Bound : 2 10000000 1 1 10 1 1\n");
     printf("  Cache Bound     : 2 10000000 64 1 10 1 1\n");
     printf("  Cache Gather    : 2 10000000 64 256 10 1 1\n");
     printf("  Global Gather   : 2 100000000 16 100000000 1 1 1\n");
     printf("  Typical MD      : 2 100000 32 512 1000 8 2\n");
+    printf("Example Input CPU:\n");
+    printf("  Prefetch Gather : 2 10000000 16 10000000 10 1 1 16\n");
     Kokkos::finalize();
     return 0;
   }
@@ -51,6 +56,7 @@ int main(int argc, char* argv[]) {
   int R = std::stoi(argv[5]);
   int U = std::stoi(argv[6]);
   int F = std::stoi(argv[7]);
+  int P = argc > 8 ? std::stoi(argv[8]) : 0;
 
   if ((S != 1) && (S != 2) && (S != 4)) {
     printf("S must be one of 1,2,4\n");
@@ -60,14 +66,18 @@ int main(int argc, char* argv[]) {
     printf("N must be larger or equal to D\n");
     return 0;
   }
+  if ((P != 0) && (P != 4) && (P != 8) && (P != 16) && (P != 32) && (P != 64)) {
+    printf("P must be one of 0,4,8,16,32,64\n");
+    return 0;
+  }
   if (S == 1) {
-    run_gather_test<float>(N, K, D, R, U, F);
+    run_gather_test<float>(N, K, D, R, U, F, P);
   }
   if (S == 2) {
-    run_gather_test<double>(N, K, D, R, U, F);
+    run_gather_test<double>(N, K, D, R, U, F, P);
   }
   if (S == 4) {
-    run_gather_test<Kokkos::complex<double> >(N, K, D, R, U, F);
+    run_gather_test<Kokkos::complex<double> >(N, K, D, R, U, F, P);
   }
   Kokkos::finalize();
 }
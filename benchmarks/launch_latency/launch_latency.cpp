@@ -22,10 +22,25 @@
     Three launch kinds are tested: parallel_for, parallel_reduce into scalar,
    and parallel_reduce into view
 
+    The parallel_for launch overhead is additionally measured without a
+   label, with a string literal label, and with a std::string label, to
+   quantify the cost of the kernel label on the dispatch path.
+
+    The idle measurement sleeps G microseconds before each parallel_for and
+   fence, as happens when the host is busy with communication between
+   kernels. It reports the launch and completion latency, which includes
+   waking up the idle workers, and the process CPU time consumed per wall
+   clock time of the loop, which shows whether idle workers burn their cores.
+
+    The batched measurement splits the loop into M patches and compares M
+   parallel_for launches over the patches, each followed by nothing or by a
+   fence, to a single parallel_for_batched launch of the M patches.
+
    N controls how large the parallel loops is
    V controls how large the functor is
    M controls across how many launches the latency is averaged
    K controls how larege the nested loop is (no larger than V)
+   G controls the idle time between launches of the idle measurement
 
     For each launch kind,
     1. Avg functor dispatch latency: (time to do M launches) / M
@@ -35,6 +50,11 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+
 template <int V>
 struct TestFunctor {
   double values[V];
@@ -66,6 +86,10 @@ struct Opts {
   bool par_for         = true;
   bool par_reduce      = true;
   bool par_reduce_view = true;
+  bool par_for_labels  = true;
+  bool par_for_idle    = true;
+  bool par_for_batched = true;
+  int idle_gap_us      = 1000;
 };
 
 template <int V>
@@ -123,6 +147,17 @@ void run(int N, int M, int K, const Opts& opts) {
   double time_red_view_no_fence_fenced = -1;
   double time_red_view_fence           = -1;
 
+  double time_label_none    = -1;  // launch loop without label
+  double time_label_literal = -1;  // launch loop with string literal label
+  double time_label_string  = -1;  // launch loop with std::string label
+
+  double time_idle_fence = -1;  // launch&fence after an idle gap
+  double cpu_per_wall    = -1;  // process CPU time / wall time of idle loop
+
+  double time_patches_no_fence = -1;  // launch loop over the patches, fence
+  double time_patches_fence    = -1;  // launch&fence loop over the patches
+  double time_patches_batched  = -1;  // single batched launch of the patches
+
   if (opts.par_for) {
     // warmup
     for (int i = 0; i < 4; ++i) {
@@ -195,6 +230,97 @@ void run(int N, int M, int K, const Opts& opts) {
     timer.reset();
   }
 
+  if (opts.par_for_labels) {
+    // longer than the small string optimization buffer, so that constructing
+    // a std::string from it allocates
+    const std::string l_string = "RunLabel_parallel_for_std_string";
+
+    // warmup
+    for (int i = 0; i < 4; ++i) {
+      Kokkos::parallel_for(N, f);
+    }
+    Kokkos::fence();
+
+    timer.reset();
+    for (int i = 0; i < M; i++) {
+      Kokkos::parallel_for(N, f);
+    }
+    Kokkos::fence();
+    time_label_none = timer.seconds();
+
+    timer.reset();
+    for (int i = 0; i < M; i++) {
+      Kokkos::parallel_for("RunLabel_parallel_for_string_literal", N, f);
+    }
+    Kokkos::fence();
+    time_label_literal = timer.seconds();
+
+    timer.reset();
+    for (int i = 0; i < M; i++) {
+      Kokkos::parallel_for(l_string, N, f);
+    }
+    Kokkos::fence();
+    time_label_string = timer.seconds();
+  }
+
+  if (opts.par_for_idle) {
+    const std::string l_idle = "RunIdleFence";
+    const auto gap           = std::chrono::microseconds(opts.idle_gap_us);
+
+    // warmup
+    Kokkos::parallel_for(l_idle, N, f);
+    Kokkos::fence();
+
+    Kokkos::Timer launch_timer;
+    time_idle_fence              = 0;
+    const std::clock_t cpu_start = std::clock();
+    timer.reset();
+    for (int i = 0; i < M; i++) {
+      std::this_thread::sleep_for(gap);
+      launch_timer.reset();
+      Kokkos::parallel_for(l_idle, N, f);
+      Kokkos::fence();
+      time_idle_fence += launch_timer.seconds();
+    }
+    const double wall = timer.seconds();
+    cpu_per_wall =
+        static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC / wall;
+  }
+
+  if (opts.par_for_batched) {
+    const std::string l_patch   = "RunPatch";
+    const std::string l_batched = "RunPatchesBatched";
+    std::vector<Kokkos::Experimental::BatchedWorkItem<TestFunctor<V>>> items;
+    for (int i = 0; i < M; ++i) {
+      items.push_back(
+          {f, std::int64_t(N) * i / M, std::int64_t(N) * (i + 1) / M});
+    }
+
+    // warmup
+    Kokkos::Experimental::parallel_for_batched(l_batched, items);
+
+    timer.reset();
+    for (const auto& item : items) {
+      Kokkos::parallel_for(l_patch, Kokkos::RangePolicy<>(item.begin, item.end),
+                           f);
+    }
+    Kokkos::fence();
+    time_patches_no_fence = timer.seconds();
+
+    timer.reset();
+    for (const auto& item : items) {
+      Kokkos::parallel_for(l_patch, Kokkos::RangePolicy<>(item.begin, item.end),
+                           f);
+      Kokkos::fence();
+    }
+    time_patches_fence = timer.seconds();
+
+    // parallel_for_batched fences
+    timer.reset();
+    Kokkos::Experimental::parallel_for_batched(l_batched, items);
+    time_patches_batched = timer.seconds();
+  }
+
   const double x = 1.e6 / M;
   printf("%i %i %i %i", N, V, K, M);
   if (opts.par_for) {
@@ -210,6 +336,17 @@ void run(int N, int M, int K, const Opts& opts) {
            x * time_red_view_no_fence, x * time_red_view_fence,
            x * time_red_view_no_fence_fenced);
   }
+  if (opts.par_for_labels) {
+    printf(" parallel_for(labels): %lf %lf %lf", x * time_label_none,
+           x * time_label_literal, x * time_label_string);
+  }
+  if (opts.par_for_idle) {
+    printf(" parallel_for(idle): %lf %lf", x * time_idle_fence, cpu_per_wall);
+  }
+  if (opts.par_for_batched) {
+    printf(" parallel_for(patches): %lf %lf %lf", x * time_patches_no_fence,
+           x * time_patches_fence, x * time_patches_batched);
+  }
   printf("\n");
 }
 int main(int argc, char* argv[]) {
@@ -226,17 +363,27 @@ int main(int argc, char* argv[]) {
     printf("==========================\n");
     printf("\n");
     printf("Usage: %s ARGUMENTS [OPTIONS...]\n\n", argv[0]);
-    printf("Arguments: N M K\n");
+    printf("Arguments: N M K [G]\n");
     printf("  N: loop length\n");
     printf("  M: how many kernels to dispatch\n");
     printf(
-        "  K: nested loop length (capped by size of functor member array\n\n");
+        "  K: nested loop length (capped by size of functor member array\n");
+    printf("  G: idle microseconds before each idle launch (default 1000)\n\n");
     printf("Options:\n");
     printf("  --no-parallel-for:         skip parallel_for benchmark\n");
     printf("  --no-parallel-reduce:      skip parallel_reduce benchmark\n");
     printf(
         "  --no-parallel-reduce-view: skip parallel_reduce into view "
         "benchmark\n");
+    printf(
+        "  --no-parallel-for-labels:  skip parallel_for label overhead "
+        "benchmark\n");
+    printf(
+        "  --no-parallel-for-idle:    skip parallel_for after idle time "
+        "benchmark\n");
+    printf(
+        "  --no-parallel-for-batched: skip batched parallel_for over patches "
+        "benchmark\n");
     printf("\n\n");
     printf("  Output V is the size of the functor member array\n");
     printf("\n\n");
@@ -253,6 +400,8 @@ int main(int argc, char* argv[]) {
           M = atoi(arg.data());
         else if (i == 3)
           K = atoi(arg.data());
+        else if (i == 4)
+          opts.idle_gap_us = atoi(arg.data());
         else {
           Kokkos::abort("unexpected argument!");
         }
@@ -262,6 +411,12 @@ int main(int argc, char* argv[]) {
         opts.par_reduce = false;
       } else if (arg == "--no-parallel-reduce-view") {
         opts.par_reduce_view = false;
+      } else if (arg == "--no-parallel-for-labels") {
+        opts.par_for_labels = false;
+      } else if (arg == "--no-parallel-for-idle") {
+        opts.par_for_idle = false;
+      } else if (arg == "--no-parallel-for-batched") {
+        opts.par_for_batched = false;
       } else {
         std::stringstream ss;
         ss << "unexpected argument \"" << arg << "\" at position " << i;
@@ -270,6 +425,13 @@ int main(int argc, char* argv[]) {
     }
 
     printf("N V K M time_no_fence time_fence (time_no_fence_fenced)\n");
+    printf(
+        "  parallel_for(labels): time_no_label time_literal_label "
+        "time_string_label\n");
+    printf("  parallel_for(idle): time_fence cpu_time_per_wall_time\n");
+    printf(
+        "  parallel_for(patches): time_no_fence time_fence "
+        "time_batched\n");
 
     /* A backend may have different launch strategies for functors of different
      * sizes: test a variety of functor sizes.*/
@@ -0,0 +1,170 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file nested_sort.cpp
+
+    Throughput of the team-level nested sorts.
+
+    Every team of a TeamPolicy sorts its own segment of a key view with
+   Kokkos::Experimental::sort_team (or sort_by_key_team). The segment length
+   is swept over powers of two between --min-size and --max-size while the
+   total number of keys stays close to --total, so that small segments are
+   spread over many teams.
+
+    Reported per segment length: the fastest time of --repeats runs of the
+   sort kernel and the corresponding sorted keys per second.
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_NestedSort.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+using Key   = unsigned;
+using Value = int;
+
+using KeyView   = Kokkos::View<Key*>;
+using ValueView = Kokkos::View<Value*>;
+using TeamPol   = Kokkos::TeamPolicy<>;
+
+enum class SortKind { keys, keys_descending, keys_and_values };
+
+struct Descending {
+  KOKKOS_FUNCTION constexpr bool operator()(const Key& lhs,
+                                            const Key& rhs) const {
+    return lhs > rhs;
+  }
+};
+
+double run_sort(const KeyView& keys, const ValueView& values, int segment,
+                int teamSize, SortKind kind) {
+  const int teams = keys.extent_int(0) / segment;
+  TeamPol policy  = teamSize > 0 ? TeamPol(teams, teamSize)
+                                 : TeamPol(teams, Kokkos::AUTO());
+
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(
+      "bench-nested-sort", policy,
+      KOKKOS_LAMBDA(const TeamPol::member_type& t) {
+        auto const range =
+            Kokkos::make_pair(t.league_rank() * segment,
+                              (t.league_rank() + 1) * segment);
+        auto const k = Kokkos::subview(keys, range);
+        switch (kind) {
+          case SortKind::keys: Kokkos::Experimental::sort_team(t, k); break;
+          case SortKind::keys_descending:
+            Kokkos::Experimental::sort_team(t, k, Descending());
+            break;
+          case SortKind::keys_and_values:
+            Kokkos::Experimental::sort_by_key_team(
+                t, k, Kokkos::subview(values, range));
+            break;
+        }
+      });
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+int run_benchmark(int minSize, int maxSize, int total, int repeats,
+                  int teamSize, SortKind kind) {
+  printf("Reports fastest timing per segment length\n");
+  printf("- Total keys:     %12d\n", total);
+  printf("- Team size:      %12s\n",
+         teamSize > 0 ? std::to_string(teamSize).c_str() : "AUTO");
+  printf("- Sort:           %12s\n",
+         kind == SortKind::keys              ? "keys"
+         : kind == SortKind::keys_descending ? "descending"
+                                             : "by key");
+  printf(HLINE);
+  printf("%12s %12s %14s %14s\n", "Segment", "Teams", "Time (s)",
+         "Mkeys/s");
+
+  Kokkos::Random_XorShift64_Pool<> pool(20240611);
+  for (int segment = minSize; segment <= maxSize; segment *= 2) {
+    const int teams = total / segment > 0 ? total / segment : 1;
+    const int n     = teams * segment;
+
+    KeyView source("source", n);
+    KeyView keys("keys", n);
+    ValueView values("values", kind == SortKind::keys_and_values ? n : 0);
+    Kokkos::fill_random(source, pool, std::numeric_limits<Key>::max());
+
+    double best = std::numeric_limits<double>::max();
+    for (int r = 0; r < repeats; ++r) {
+      Kokkos::deep_copy(keys, source);
+      Kokkos::fence();
+      double const time = run_sort(keys, values, segment, teamSize, kind);
+      if (time < best) best = time;
+    }
+    printf("%12d %12d %14.6e %14.3f\n", segment, teams, best,
+           1.0e-6 * n / best);
+  }
+  printf(HLINE);
+
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  printf(HLINE);
+  printf("Kokkos Nested Sort Benchmark\n");
+  printf(HLINE);
+
+  Kokkos::initialize(argc, argv);
+
+  int minSize   = 32;
+  int maxSize   = 65536;
+  int total     = 1 << 22;
+  int repeats   = 5;
+  int teamSize  = 0;
+  SortKind kind = SortKind::keys;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--min-size") == 0) {
+      minSize = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--max-size") == 0) {
+      maxSize = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--total") == 0) {
+      total = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--repeats") == 0) {
+      repeats = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--team-size") == 0) {
+      teamSize = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--descending") == 0) {
+      kind = SortKind::keys_descending;
+    } else if (strcmp(argv[i], "--by-key") == 0) {
+      kind = SortKind::keys_and_values;
+    }
+  }
+
+  const int rc =
+      run_benchmark(minSize, maxSize, total, repeats, teamSize, kind);
+
+  Kokkos::finalize();
+
+  return rc;
+}
@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file std_algorithms_simd.cpp
+
+    Throughput of the simd fast paths of the std algorithms on host.
+
+    Every algorithm runs on the default host execution space twice over the
+   same data: once through a contiguous View, which takes the simd fast
+   path, and once through an unmanaged LayoutStride View of stride one,
+   which takes the element-wise implementation. The searching algorithms
+   are given inputs without a match, so that they scan the whole range.
+   Without a native simd ABI for the host (no AVX2, AVX-512 or NEON
+   architecture enabled) both paths are element-wise.
+
+    Reported per algorithm and value type: the fastest time of --repeats
+   calls for both paths and the speedup of the fast path.
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_StdAlgorithms.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+namespace KE = Kokkos::Experimental;
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+template <class T>
+using ContiguousView = Kokkos::View<T*, Kokkos::LayoutRight, ExecSpace>;
+
+template <class T>
+using StridedView = Kokkos::View<T*, Kokkos::LayoutStride, ExecSpace,
+                                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+// Keeps the results alive without printing them
+double sink = 0;
+
+template <class Algorithm>
+double best_time(int repeats, Algorithm const& algorithm) {
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < repeats; ++r) {
+    Kokkos::Timer timer;
+    sink += algorithm();
+    double const time = timer.seconds();
+    if (time < best) best = time;
+  }
+  return best;
+}
+
+template <class T, class Algorithm>
+void compare(const char* name, const char* type, int n, int repeats,
+             Algorithm const& algorithm) {
+  ContiguousView<T> a("a", n);
+  ContiguousView<T> b("b", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, n),
+      KOKKOS_LAMBDA(int i) { a(i) = b(i) = T(i % 7 + 1); });
+  ExecSpace().fence();
+
+  StridedView<T> a_strided(a.data(), Kokkos::LayoutStride(n, 1));
+  StridedView<T> b_strided(b.data(), Kokkos::LayoutStride(n, 1));
+
+  double const fast  = best_time(repeats, [&] { return algorithm(a, b); });
+  double const plain = best_time(
+      repeats, [&] { return algorithm(a_strided, b_strided); });
+  printf("%16s %8s %14.6e %14.6e %10.2f\n", name, type, fast, plain,
+         plain / fast);
+}
+
+template <class T>
+void run_type(const char* type, int n, int repeats) {
+  ExecSpace ex;
+  compare<T>("reduce", type, n, repeats, [&](auto a, auto) {
+    return double(KE::reduce(ex, a));
+  });
+  compare<T>("transform_reduce", type, n, repeats, [&](auto a, auto b) {
+    return double(KE::transform_reduce(ex, a, b, T(0)));
+  });
+  compare<T>("count", type, n, repeats, [&](auto a, auto) {
+    return double(KE::count(ex, a, T(1)));
+  });
+  compare<T>("find", type, n, repeats, [&](auto a, auto) {
+    return double(KE::find(ex, a, T(0)) - KE::begin(a));
+  });
+  compare<T>("min_element", type, n, repeats, [&](auto a, auto) {
+    return double(KE::min_element(ex, a) - KE::begin(a));
+  });
+  compare<T>("max_element", type, n, repeats, [&](auto a, auto) {
+    return double(KE::max_element(ex, a) - KE::begin(a));
+  });
+  compare<T>("minmax_element", type, n, repeats, [&](auto a, auto) {
+    return double(KE::minmax_element(ex, a).first - KE::begin(a));
+  });
+  compare<T>("equal", type, n, repeats, [&](auto a, auto b) {
+    return double(KE::equal(ex, a, b));
+  });
+  compare<T>("mismatch", type, n, repeats, [&](auto a, auto b) {
+    return double(KE::mismatch(ex, a, b).first - KE::begin(a));
+  });
+}
+
+int run_benchmark(int n, int repeats) {
+  printf("Reports fastest timing per algorithm\n");
+  printf("- Elements:       %12d\n", n);
+  printf("- Repeats:        %12d\n", repeats);
+  printf(HLINE);
+  printf("%16s %8s %14s %14s %10s\n", "Algorithm", "Type", "SIMD (s)",
+         "Strided (s)", "Speedup");
+
+  run_type<double>("double", n, repeats);
+  run_type<float>("float", n, repeats);
+  run_type<std::int32_t>("int32", n, repeats);
+  run_type<std::int64_t>("int64", n, repeats);
+  printf(HLINE);
+
+  return sink == -1;
+}
+
+int main(int argc, char* argv[]) {
+  printf(HLINE);
+  printf("Kokkos Std Algorithms SIMD Benchmark\n");
+  printf(HLINE);
+
+  Kokkos::initialize(argc, argv);
+
+  int n       = 1 << 24;
+  int repeats = 10;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--size") == 0) {
+      n = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--repeats") == 0) {
+      repeats = std::atoi(argv[i + 1]);
+      ++i;
+    }
+  }
+
+  const int rc = run_benchmark(n, repeats);
+
+  Kokkos::finalize();
+
+  return rc;
+}
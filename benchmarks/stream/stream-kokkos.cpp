@@ -29,11 +29,16 @@
 using StreamDeviceArray =
     Kokkos::View<double*, Kokkos::MemoryTraits<Kokkos::Restrict>>;
 using StreamHostArray = typename StreamDeviceArray::HostMirror;
+// aliases the device arrays, the kernels write their output with non-temporal
+// stores on the host
+using StreamStreamingArray = Kokkos::View<
+    double*, Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::StreamingStore>>;
 
 using StreamIndex = int;
 using Policy      = Kokkos::RangePolicy<Kokkos::IndexType<StreamIndex>>;
 
-void perform_set(StreamDeviceArray& a, const double scalar) {
+template <class OutputArray>
+void perform_set(OutputArray& a, const double scalar) {
   Kokkos::parallel_for(
       "set", Policy(0, a.extent(0)),
       KOKKOS_LAMBDA(const StreamIndex i) { a[i] = scalar; });
@@ -41,7 +46,8 @@ void perform_set(StreamDeviceArray& a, const double scalar) {
   Kokkos::fence();
 }
 
-void perform_copy(StreamDeviceArray& a, StreamDeviceArray& b) {
+template <class OutputArray>
+void perform_copy(StreamDeviceArray& a, OutputArray& b) {
   Kokkos::parallel_for(
       "copy", Policy(0, a.extent(0)),
       KOKKOS_LAMBDA(const StreamIndex i) { b[i] = a[i]; });
@@ -49,8 +55,8 @@ void perform_copy(StreamDeviceArray& a, StreamDeviceArray& b) {
   Kokkos::fence();
 }
 
-void perform_scale(StreamDeviceArray& b, StreamDeviceArray& c,
-                   const double scalar) {
+template <class OutputArray>
+void perform_scale(OutputArray& b, StreamDeviceArray& c, const double scalar) {
   Kokkos::parallel_for(
       "scale", Policy(0, b.extent(0)),
       KOKKOS_LAMBDA(const StreamIndex i) { b[i] = scalar * c[i]; });
@@ -58,8 +64,8 @@ void perform_scale(StreamDeviceArray& b, StreamDeviceArray& c,
   Kokkos::fence();
 }
 
-void perform_add(StreamDeviceArray& a, StreamDeviceArray& b,
-                 StreamDeviceArray& c) {
+template <class OutputArray>
+void perform_add(StreamDeviceArray& a, StreamDeviceArray& b, OutputArray& c) {
   Kokkos::parallel_for(
       "add", Policy(0, a.extent(0)),
       KOKKOS_LAMBDA(const StreamIndex i) { c[i] = a[i] + b[i]; });
@@ -67,8 +73,9 @@ void perform_add(StreamDeviceArray& a, StreamDeviceArray& b,
   Kokkos::fence();
 }
 
-void perform_triad(StreamDeviceArray& a, StreamDeviceArray& b,
-                   StreamDeviceArray& c, const double scalar) {
+template <class OutputArray>
+void perform_triad(OutputArray& a, StreamDeviceArray& b, StreamDeviceArray& c,
+                   const double scalar) {
   Kokkos::parallel_for(
       "triad", Policy(0, a.extent(0)),
       KOKKOS_LAMBDA(const StreamIndex i) { a[i] = b[i] + scalar * c[i]; });
@@ -129,6 +136,75 @@ int perform_validation(StreamHostArray& a, StreamHostArray& b,
   return errorCount;
 }
 
+void initialize_arrays(StreamDeviceArray& a, StreamDeviceArray& b,
+                       StreamDeviceArray& c) {
+  printf("Initializing Views...\n");
+  Kokkos::deep_copy(a, 1.0);
+  Kokkos::deep_copy(b, 2.0);
+  Kokkos::deep_copy(c, 0.0);
+}
+
+struct StreamTimes {
+  double set   = std::numeric_limits<double>::max();
+  double copy  = std::numeric_limits<double>::max();
+  double scale = std::numeric_limits<double>::max();
+  double add   = std::numeric_limits<double>::max();
+  double triad = std::numeric_limits<double>::max();
+};
+
+// The kernels read from the dev_* arrays and write to the out_* arrays, which
+// alias them.
+template <class OutputArray>
+StreamTimes run_kernels(StreamDeviceArray& dev_a, StreamDeviceArray& dev_b,
+                        StreamDeviceArray& dev_c, OutputArray& out_a,
+                        OutputArray& out_b, OutputArray& out_c,
+                        const double scalar) {
+  StreamTimes times;
+  Kokkos::Timer timer;
+
+  for (StreamIndex k = 0; k < STREAM_NTIMES; ++k) {
+    timer.reset();
+    perform_set(out_c, 1.5);
+    times.set = std::min(times.set, timer.seconds());
+
+    timer.reset();
+    perform_copy(dev_a, out_c);
+    times.copy = std::min(times.copy, timer.seconds());
+
+    timer.reset();
+    perform_scale(out_b, dev_c, scalar);
+    times.scale = std::min(times.scale, timer.seconds());
+
+    timer.reset();
+    perform_add(dev_a, dev_b, out_c);
+    times.add = std::min(times.add, timer.seconds());
+
+    timer.reset();
+    perform_triad(out_a, dev_b, dev_c, scalar);
+    times.triad = std::min(times.triad, timer.seconds());
+  }
+
+  return times;
+}
+
+void print_rates(const StreamTimes& times) {
+  printf("Set             %11.2f MB/s\n",
+         (1.0e-06 * 1.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
+             times.set);
+  printf("Copy            %11.2f MB/s\n",
+         (1.0e-06 * 2.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
+             times.copy);
+  printf("Scale           %11.2f MB/s\n",
+         (1.0e-06 * 2.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
+             times.scale);
+  printf("Add             %11.2f MB/s\n",
+         (1.0e-06 * 3.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
+             times.add);
+  printf("Triad           %11.2f MB/s\n",
+         (1.0e-06 * 3.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
+             times.triad);
+}
+
 int run_benchmark() {
   printf("Reports fastest timing per kernel\n");
   printf("Creating Views...\n");
@@ -156,54 +232,19 @@ int run_benchmark() {
 
   const double scalar = 3.0;
 
-  double setTime   = std::numeric_limits<double>::max();
-  double copyTime  = std::numeric_limits<double>::max();
-  double scaleTime = std::numeric_limits<double>::max();
-  double addTime   = std::numeric_limits<double>::max();
-  double triadTime = std::numeric_limits<double>::max();
-
-  printf("Initializing Views...\n");
-
-  Kokkos::parallel_for(
-      "init",
-      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0,
-                                                             STREAM_ARRAY_SIZE),
-      KOKKOS_LAMBDA(const int i) {
-        a[i] = 1.0;
-        b[i] = 2.0;
-        c[i] = 0.0;
-      });
-
-  // Copy contents of a (from the host) to the dev_a (device)
-  Kokkos::deep_copy(dev_a, a);
-  Kokkos::deep_copy(dev_b, b);
-  Kokkos::deep_copy(dev_c, c);
-
   printf("Starting benchmarking...\n");
 
-  Kokkos::Timer timer;
-
-  for (StreamIndex k = 0; k < STREAM_NTIMES; ++k) {
-    timer.reset();
-    perform_set(dev_c, 1.5);
-    setTime = std::min(setTime, timer.seconds());
-
-    timer.reset();
-    perform_copy(dev_a, dev_c);
-    copyTime = std::min(copyTime, timer.seconds());
-
-    timer.reset();
-    perform_scale(dev_b, dev_c, scalar);
-    scaleTime = std::min(scaleTime, timer.seconds());
-
-    timer.reset();
-    perform_add(dev_a, dev_b, dev_c);
-    addTime = std::min(addTime, timer.seconds());
+  initialize_arrays(dev_a, dev_b, dev_c);
+  const StreamTimes regular =
+      run_kernels(dev_a, dev_b, dev_c, dev_a, dev_b, dev_c, scalar);
 
-    timer.reset();
-    perform_triad(dev_a, dev_b, dev_c, scalar);
-    triadTime = std::min(triadTime, timer.seconds());
-  }
+  // Same kernels from the same initial values with streaming stores
+  initialize_arrays(dev_a, dev_b, dev_c);
+  StreamStreamingArray stream_a(dev_a.data(), dev_a.extent(0));
+  StreamStreamingArray stream_b(dev_b.data(), dev_b.extent(0));
+  StreamStreamingArray stream_c(dev_c.data(), dev_c.extent(0));
+  const StreamTimes streaming =
+      run_kernels(dev_a, dev_b, dev_c, stream_a, stream_b, stream_c, scalar);
 
   Kokkos::deep_copy(a, dev_a);
   Kokkos::deep_copy(b, dev_b);
@@ -214,21 +255,10 @@ int run_benchmark() {
 
   printf(HLINE);
 
-  printf("Set             %11.2f MB/s\n",
-         (1.0e-06 * 1.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
-             setTime);
-  printf("Copy            %11.2f MB/s\n",
-         (1.0e-06 * 2.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
-             copyTime);
-  printf("Scale           %11.2f MB/s\n",
-         (1.0e-06 * 2.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
-             scaleTime);
-  printf("Add             %11.2f MB/s\n",
-         (1.0e-06 * 3.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
-             addTime);
-  printf("Triad           %11.2f MB/s\n",
-         (1.0e-06 * 3.0 * (double)sizeof(double) * (double)STREAM_ARRAY_SIZE) /
-             triadTime);
+  printf("Regular stores\n");
+  print_rates(regular);
+  printf("Streaming stores\n");
+  print_rates(streaming);
 
   printf(HLINE);
 
@@ -0,0 +1,212 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file work_stealing.cpp
+
+    Load balancing of the Static and Dynamic schedules for irregular work.
+
+    Every league rank of a TeamPolicy (every index of a RangePolicy) performs a
+   number of dependent floating point iterations given by a cost profile:
+
+    - uniform: every item costs --work iterations
+    - linear:  cost grows linearly from 0 to 2 * --work over the range
+    - front:   the first 1/16 of the items cost 16 * --work, the rest 1
+    - sparse:  one pseudo-randomly chosen item out of 64 costs 64 * --work,
+               the rest 1
+
+    All profiles except uniform sum up to roughly the same total amount of
+   work. Reported per profile: the fastest time of --repeats runs for each
+   schedule and the speedup of Dynamic over Static.
+*/
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+enum class Profile { uniform, linear, front, sparse };
+
+using ResultView = Kokkos::View<double*>;
+
+KOKKOS_INLINE_FUNCTION int item_cost(Profile profile, int i, int n, int work) {
+  switch (profile) {
+    case Profile::uniform: return work;
+    case Profile::linear:
+      return static_cast<int>((2.0 * work * i) / n);
+    case Profile::front: return i < n / 16 ? 16 * work : 1;
+    case Profile::sparse: {
+      // splitmix32 style hash of the index
+      unsigned h = static_cast<unsigned>(i) * 0x9E3779B9u;
+      h ^= h >> 16;
+      h *= 0x85EBCA6Bu;
+      h ^= h >> 13;
+      return (h & 63u) == 0 ? 64 * work : 1;
+    }
+  }
+  return work;
+}
+
+KOKKOS_INLINE_FUNCTION double spin(int iterations, double x) {
+  for (int k = 0; k < iterations; ++k) x = x * 0.999999 + 1.0e-6;
+  return x;
+}
+
+template <class Schedule>
+double run_team(const ResultView& result, Profile profile, int work,
+                int teamSize, int chunk) {
+  using policy_t = Kokkos::TeamPolicy<Kokkos::Schedule<Schedule>>;
+  using member_t = typename policy_t::member_type;
+
+  const int n     = result.extent_int(0);
+  policy_t policy = teamSize > 0 ? policy_t(n, teamSize)
+                                 : policy_t(n, Kokkos::AUTO());
+  if (chunk > 0) policy.set_chunk_size(chunk);
+
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(
+      "bench-work-stealing-team", policy, KOKKOS_LAMBDA(const member_t& t) {
+        const int i    = t.league_rank();
+        const int cost = item_cost(profile, i, n, work);
+        double x       = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(t, t.team_size()),
+            [=](const int r, double& update) {
+              const int begin = (cost * r) / t.team_size();
+              const int end   = (cost * (r + 1)) / t.team_size();
+              update += spin(end - begin, 1.0 + i + r);
+            },
+            x);
+        Kokkos::single(Kokkos::PerTeam(t), [&]() { result(i) = x; });
+      });
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+template <class Schedule>
+double run_range(const ResultView& result, Profile profile, int work,
+                 int chunk) {
+  using policy_t = Kokkos::RangePolicy<Kokkos::Schedule<Schedule>>;
+
+  const int n = result.extent_int(0);
+  policy_t policy(0, n);
+  if (chunk > 0) policy.set_chunk_size(chunk);
+
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(
+      "bench-work-stealing-range", policy, KOKKOS_LAMBDA(const int i) {
+        result(i) = spin(item_cost(profile, i, n, work), 1.0 + i);
+      });
+  Kokkos::fence();
+  return timer.seconds();
+}
+
+template <class F>
+double best_of(int repeats, F const& f) {
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < repeats; ++r) {
+    double const time = f();
+    if (time < best) best = time;
+  }
+  return best;
+}
+
+int run_benchmark(int size, int work, int repeats, int teamSize, int chunk) {
+  printf("Reports fastest timing per cost profile\n");
+  printf("- Items:          %12d\n", size);
+  printf("- Work per item:  %12d\n", work);
+  printf("- Team size:      %12s\n",
+         teamSize > 0 ? std::to_string(teamSize).c_str() : "AUTO");
+  printf("- Chunk size:     %12s\n",
+         chunk > 0 ? std::to_string(chunk).c_str() : "default");
+  printf("- Concurrency:    %12d\n",
+         Kokkos::DefaultExecutionSpace().concurrency());
+  printf(HLINE);
+  printf("%8s %8s %14s %14s %10s\n", "Policy", "Profile", "Static (s)",
+         "Dynamic (s)", "Speedup");
+
+  ResultView result("result", size);
+
+  const char* names[] = {"uniform", "linear", "front", "sparse"};
+  for (Profile profile :
+       {Profile::uniform, Profile::linear, Profile::front, Profile::sparse}) {
+    const char* name = names[static_cast<int>(profile)];
+
+    double const team_static = best_of(repeats, [&]() {
+      return run_team<Kokkos::Static>(result, profile, work, teamSize, chunk);
+    });
+    double const team_dynamic = best_of(repeats, [&]() {
+      return run_team<Kokkos::Dynamic>(result, profile, work, teamSize, chunk);
+    });
+    printf("%8s %8s %14.6e %14.6e %10.3f\n", "team", name, team_static,
+           team_dynamic, team_static / team_dynamic);
+
+    double const range_static = best_of(repeats, [&]() {
+      return run_range<Kokkos::Static>(result, profile, work, chunk);
+    });
+    double const range_dynamic = best_of(repeats, [&]() {
+      return run_range<Kokkos::Dynamic>(result, profile, work, chunk);
+    });
+    printf("%8s %8s %14.6e %14.6e %10.3f\n", "range", name, range_static,
+           range_dynamic, range_static / range_dynamic);
+  }
+  printf(HLINE);
+
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  printf(HLINE);
+  printf("Kokkos Work Stealing Benchmark\n");
+  printf(HLINE);
+
+  Kokkos::initialize(argc, argv);
+
+  int size     = 1 << 16;
+  int work     = 2000;
+  int repeats  = 5;
+  int teamSize = 1;
+  int chunk    = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--size") == 0) {
+      size = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--work") == 0) {
+      work = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--repeats") == 0) {
+      repeats = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--team-size") == 0) {
+      teamSize = std::atoi(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "--chunk") == 0) {
+      chunk = std::atoi(argv[i + 1]);
+      ++i;
+    }
+  }
+
+  const int rc = run_benchmark(size, work, repeats, teamSize, chunk);
+
+  Kokkos::finalize();
+
+  return rc;
+}
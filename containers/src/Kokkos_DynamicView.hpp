@@ -113,12 +113,12 @@ struct ChunkedArrayManager {
   void allocate_device(const std::string& label) {
     if (m_chunks == nullptr) {
       m_chunks = reinterpret_cast<pointer_type*>(MemorySpace().allocate(
-          label.c_str(), (sizeof(pointer_type) * (m_chunk_max + 2))));
+          label.c_str(), (sizeof(pointer_type) * (m_chunk_max + 3))));
     }
   }
 
   void initialize() {
-    for (unsigned i = 0; i < m_chunk_max + 2; i++) {
+    for (unsigned i = 0; i < m_chunk_max + 3; i++) {
       m_chunks[i] = nullptr;
     }
     m_valid = true;
@@ -146,7 +146,7 @@ struct ChunkedArrayManager {
 
     void execute() {
       // Destroy the array of chunk pointers.
-      // Two entries beyond the max chunks are allocation counters.
+      // Three entries beyond the max chunks are allocation counters.
       uintptr_t const len =
           *reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
       for (unsigned i = 0; i < len; i++) {
@@ -156,7 +156,7 @@ struct ChunkedArrayManager {
       // Destroy the linked allocation if we have one.
       if (m_linked != nullptr) {
         Space().deallocate(m_label.c_str(), m_linked,
-                           (sizeof(value_type*) * (m_chunk_max + 2)));
+                           (sizeof(value_type*) * (m_chunk_max + 3)));
       }
     }
 
@@ -177,11 +177,12 @@ struct ChunkedArrayManager {
     using record_type =
         Kokkos::Impl::SharedAllocationRecord<MemorySpace, destroy_type>;
 
-    // Allocate + 2 extra slots so that *m_chunk[m_chunk_max] ==
-    // num_chunks_alloc and *m_chunk[m_chunk_max+1] == extent This must match in
-    // Destroy's execute(...) method
+    // Allocate + 3 extra slots so that *m_chunk[m_chunk_max] ==
+    // num_chunks_alloc, *m_chunk[m_chunk_max+1] == extent and
+    // *m_chunk[m_chunk_max+2] == number of entries that failed to append
+    // This must match in Destroy's execute(...) method
     record_type* const record = record_type::allocate(
-        MemorySpace(), label, (sizeof(pointer_type) * (m_chunk_max + 2)));
+        MemorySpace(), label, (sizeof(pointer_type) * (m_chunk_max + 3)));
     m_chunks = static_cast<pointer_type*>(record->data());
     m_track.assign_allocated_record_to_uninitialized(record);
 
@@ -198,7 +199,7 @@ struct ChunkedArrayManager {
     if (other.m_chunks != m_chunks) {
       Kokkos::Impl::DeepCopy<OtherMemorySpace, MemorySpace, ExecutionSpace>(
           exec_space, other.m_chunks, m_chunks,
-          sizeof(pointer_type) * (m_chunk_max + 2));
+          sizeof(pointer_type) * (m_chunk_max + 3));
     }
   }
 
@@ -225,6 +226,7 @@ struct ChunkedArrayManager {
 
 /** \brief Dynamic views are restricted to rank-one and no layout.
  *         Resize only occurs on host outside of parallel_regions.
+ *         Kernels may append to the chunks allocated beforehand.
  *         Subviews are not allowed.
  */
 template <typename DataType, typename... P>
@@ -397,6 +399,48 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     return (*ch)[i0 & m_chunk_mask];
   }
 
+  //----------------------------------------
+  /** \brief  Index returned by grow_by and append when the new entries do
+   *          not fit in the allocated chunks.
+   */
+  static constexpr size_t invalid_index = ~size_t(0);
+
+  /** \brief  Concurrently extend the array by count entries from within a
+   *          kernel and return the index of the first one.
+   *
+   *  The entries must fit in the chunks allocated by resize_serial or
+   *  reserve_serial, otherwise the extent is unchanged, the failure is
+   *  counted and invalid_index is returned. The host sees the new extent
+   *  after calling sync_append_serial.
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t grow_by(const size_t count) const {
+    // *m_chunks[m_chunk_max] stores the current number of chunks being used
+    uintptr_t* const pc = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
+    const uintptr_t capacity = *pc << m_chunk_shift;
+
+    uintptr_t extent = Kokkos::atomic_load(pc + 1);
+    while (extent + count <= capacity) {
+      const uintptr_t old =
+          Kokkos::atomic_compare_exchange(pc + 1, extent, extent + count);
+      if (old == extent) return extent;
+      extent = old;
+    }
+
+    Kokkos::atomic_add(pc + 2, uintptr_t(count));
+    return invalid_index;
+  }
+
+  /** \brief  Concurrently append value from within a kernel and return its
+   *          index, or invalid_index if it does not fit (see grow_by).
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t append(const value_type& value) const {
+    const size_t i = grow_by(1);
+    if (i != invalid_index) (*this)(i) = value;
+    return i;
+  }
+
   //----------------------------------------
   /** \brief  Resizing in serial can grow or shrink the array size
    *          up to the maximum number of chunks
@@ -443,6 +487,68 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         "DynamicView::resize_serial: Fence after copying chunks to the device");
   }
 
+  /** \brief  Allocate chunks in serial so that kernels can append up to a
+   *          total of n entries, the extent is unchanged.
+   * */
+  template <typename IntType>
+  inline void reserve_serial(IntType const& n) {
+    using local_value_type   = typename traits::value_type;
+    using value_pointer_type = local_value_type*;
+
+    const uintptr_t NC = (n + m_chunk_mask) >> m_chunk_shift;
+
+    if (m_chunk_max < NC) {
+      Kokkos::abort("DynamicView::reserve_serial exceeded maximum size");
+    }
+
+    uintptr_t* const pc =
+        reinterpret_cast<uintptr_t*>(m_chunks_host + m_chunk_max);
+    if (NC <= *pc) return;
+
+    std::string _label = m_chunks_host.track().template get_label<host_space>();
+    while (*pc < NC) {
+      m_chunks_host[*pc] =
+          reinterpret_cast<value_pointer_type>(device_space().allocate(
+              _label.c_str(), sizeof(local_value_type) << m_chunk_shift));
+      ++*pc;
+    }
+
+    typename device_space::execution_space exec{};
+    m_chunks_host.deep_copy_to(exec, m_chunks);
+    exec.fence(
+        "DynamicView::reserve_serial: Fence after copying chunks to the "
+        "device");
+  }
+
+  /** \brief  Wait for the kernels appending to the array and update the
+   *          extent seen on the host.
+   *
+   *  Return the number of entries that did not fit in the allocated chunks
+   *  since the last call, the caller can reserve_serial( size() + failed )
+   *  and append them again. Must be called before resize_serial or
+   *  reserve_serial once kernels have appended.
+   * */
+  inline size_t sync_append_serial() {
+    typename device_space::execution_space exec{};
+    m_chunks.deep_copy_to(exec, m_chunks_host);
+    exec.fence(
+        "DynamicView::sync_append_serial: Fence after copying chunks to the "
+        "host");
+
+    // *m_chunks_host[m_chunk_max+2] counts the entries that failed to append
+    uintptr_t* const pf =
+        reinterpret_cast<uintptr_t*>(m_chunks_host + m_chunk_max + 2);
+    const size_t failed = *pf;
+    if (failed != 0) {
+      *pf = 0;
+      m_chunks_host.deep_copy_to(exec, m_chunks);
+      exec.fence(
+          "DynamicView::sync_append_serial: Fence after copying chunks to the "
+          "device");
+    }
+    return failed;
+  }
+
   KOKKOS_INLINE_FUNCTION bool is_allocated() const {
     if (m_chunks_host.valid()) {
       // *m_chunks_host[m_chunk_max] stores the current number of chunks being
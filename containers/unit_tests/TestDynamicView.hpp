@@ -263,6 +263,83 @@ TEST(TEST_CATEGORY, dynamic_view) {
   }
 }
 
+template <class Space>
+void test_dynamic_view_append(const int n) {
+  using execution_space = typename Space::execution_space;
+  using view_type       = Kokkos::Experimental::DynamicView<int*, Space>;
+
+  // Every third index is emitted, in blocks of two entries
+  const int expected = 2 * ((n + 2) / 3);
+
+  view_type dv("dv", 1024, 2 * n);
+  dv.resize_serial(2);
+  ASSERT_EQ(dv.size(), 2u);
+  // Not enough room, about half of the blocks fail
+  dv.reserve_serial(expected / 2);
+  ASSERT_EQ(dv.size(), 2u);
+
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) {
+      // Start over with enough room for all of them
+      dv.resize_serial(2);
+      dv.reserve_serial(3 + expected);
+    }
+
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, n), KOKKOS_LAMBDA(int i) {
+          if (i % 3 != 0) return;
+          const size_t k = dv.grow_by(2);
+          if (k == view_type::invalid_index) return;
+          dv(k)     = pass * n + i;
+          dv(k + 1) = -(pass * n + i);
+        });
+    const size_t failed = dv.sync_append_serial();
+
+    if (pass == 0) {
+      ASSERT_GT(failed, 0u);
+      ASSERT_EQ(dv.size() - 2 + failed, static_cast<size_t>(expected));
+      ASSERT_LE(dv.size(), dv.allocation_extent());
+    } else {
+      ASSERT_EQ(failed, 0u);
+      ASSERT_EQ(dv.size(), static_cast<size_t>(2 + expected));
+    }
+  }
+  ASSERT_EQ(dv.sync_append_serial(), 0u);
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, expected / 2),
+      KOKKOS_LAMBDA(int b, int& update) {
+        const int value = dv(2 + 2 * b);
+        if (value < n || value >= 2 * n || (value - n) % 3 != 0 ||
+            dv(2 + 2 * b + 1) != -value)
+          ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+
+  int sum = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, expected / 2),
+      KOKKOS_LAMBDA(int b, int& update) { update += dv(2 + 2 * b) - n; },
+      sum);
+  int expected_sum = 0;
+  for (int i = 0; i < n; i += 3) expected_sum += i;
+  ASSERT_EQ(sum, expected_sum);
+
+  // append a single value past the end
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      KOKKOS_LAMBDA(int) { dv.append(7); });
+  ASSERT_EQ(dv.sync_append_serial(), 0u);
+  ASSERT_EQ(dv.size(), static_cast<size_t>(3 + expected));
+}
+
+TEST(TEST_CATEGORY, dynamic_view_append) {
+  test_dynamic_view_append<TEST_EXECSPACE>(10000);
+  test_dynamic_view_append<TEST_EXECSPACE>(100000);
+}
+
 }  // namespace Test
 
 #endif /* #ifndef KOKKOS_TEST_DYNAMICVIEW_HPP */
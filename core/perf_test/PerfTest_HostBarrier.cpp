@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostBarrier.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "Benchmark_Context.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+// Latency of the host barriers used by the pool rendezvous, the threads
+// rendezvous the way HostThreadTeamData::pool_rendezvous does: rank 0 waits
+// for all the threads to arrive and then releases them.
+
+constexpr int num_barriers_per_iteration = 1000;
+
+struct alignas(64) BarrierNode {
+  int data[Kokkos::Impl::HostBarrier::required_buffer_length];
+};
+
+struct CentralizedBarrier {
+  std::vector<BarrierNode>& nodes;
+
+  void rendezvous(const int rank, const int size, int& step) const {
+    using Kokkos::Impl::HostBarrier;
+    int* buffer = nodes[0].data;
+    HostBarrier::split_arrive(buffer, size, step);
+    if (rank != 0) {
+      HostBarrier::wait(buffer, size, step);
+    } else {
+      HostBarrier::split_master_wait(buffer, size, step);
+      HostBarrier::split_release(buffer, size, step);
+    }
+  }
+};
+
+struct TreeBarrier {
+  std::vector<BarrierNode>& nodes;
+
+  void rendezvous(const int rank, const int size, int& step) const {
+    using Kokkos::Impl::HostTreeBarrier;
+    auto node = [this](const int r) { return nodes[r].data; };
+    if (HostTreeBarrier::arrive(node, rank, size, step)) {
+      HostTreeBarrier::release(node, rank, size, step);
+    }
+  }
+};
+
+template <class Barrier>
+static void HostBarrierLatency(benchmark::State& state) {
+  const int size = state.range(0);
+  std::vector<BarrierNode> nodes(size);
+  const Barrier barrier{nodes};
+
+  for (auto _ : state) {
+    std::fill(nodes.begin(), nodes.end(), BarrierNode{});
+
+    // the threads are started before the timer, and only wait for the go
+    std::atomic<int> num_ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int rank = 1; rank < size; ++rank) {
+      threads.emplace_back([&, rank] {
+        int step = 0;
+        ++num_ready;
+        while (!go) {
+        }
+        for (int i = 0; i < num_barriers_per_iteration; ++i) {
+          barrier.rendezvous(rank, size, step);
+        }
+      });
+    }
+    while (num_ready != size - 1) {
+    }
+
+    Kokkos::Timer timer;
+    go       = true;
+    int step = 0;
+    for (int i = 0; i < num_barriers_per_iteration; ++i) {
+      barrier.rendezvous(0, size, step);
+    }
+    state.SetIterationTime(timer.seconds());
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  state.counters[KokkosBenchmark::benchmark_fom("s/barrier")] =
+      benchmark::Counter(num_barriers_per_iteration,
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+}
+
+static void host_barrier_thread_counts(benchmark::internal::Benchmark* b) {
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  b->ArgName("threads")->RangeMultiplier(2)->Range(1, max_threads);
+  b->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_TEMPLATE(HostBarrierLatency, CentralizedBarrier)
+    ->Apply(host_barrier_thread_counts);
+BENCHMARK_TEMPLATE(HostBarrierLatency, TreeBarrier)
+    ->Apply(host_barrier_thread_counts);
+
+}  // namespace Test
@@ -60,6 +60,18 @@ static void ViewDeepCopy_Rank2(benchmark::State& state) {
   deepcopy_view(a, b, state);
 }
 
+// Square matrices from cache-sized to memory-sized, the copies between
+// LayoutLeft and LayoutRight are transposes
+template <class LayoutA, class LayoutB>
+static void ViewDeepCopy_Rank2Square(benchmark::State& state) {
+  const int N = state.range(0);
+
+  Kokkos::View<double**, LayoutA> a("A2", N, N);
+  Kokkos::View<double**, LayoutB> b("B2", N, N);
+
+  deepcopy_view(a, b, state);
+}
+
 template <class LayoutA, class LayoutB>
 static void ViewDeepCopy_Rank3(benchmark::State& state) {
   const int N1 = state.range(0);
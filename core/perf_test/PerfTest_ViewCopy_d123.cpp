@@ -28,6 +28,12 @@ BENCHMARK(ViewDeepCopy_Rank2<Kokkos::LayoutRight, Kokkos::LayoutLeft>)
     ->Arg(10)
     ->UseManualTime();
 
+BENCHMARK(ViewDeepCopy_Rank2Square<Kokkos::LayoutRight, Kokkos::LayoutLeft>)
+    ->ArgName("N")
+    ->RangeMultiplier(4)
+    ->Range(256, 4096)
+    ->UseManualTime();
+
 BENCHMARK(ViewDeepCopy_Rank3<Kokkos::LayoutRight, Kokkos::LayoutLeft>)
     ->ArgName("N")
     ->Arg(10)
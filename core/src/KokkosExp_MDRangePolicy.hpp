@@ -476,6 +476,43 @@ template <typename ES, typename T, size_t N, size_t NT,
 MDRangePolicy(ES const&, Array<T, N> const&, Array<T, N> const&,
               Array<T, NT> const&) -> MDRangePolicy<ES, Rank<N>>;
 
+namespace Experimental {
+
+// MDRangePolicy over all entries of a View with LayoutTiled whose tiles are
+// the tiles of the layout and are visited in the order the layout stores
+// them, so that every tile of work covers one contiguous chunk of memory.
+template <class ExecutionSpace, class ViewType>
+auto make_tiled_mdrange_policy(const ExecutionSpace& space,
+                               const ViewType& view) {
+  using array_layout = typename ViewType::array_layout;
+  static_assert(is_layout_tiled_v<array_layout>,
+                "make_tiled_mdrange_policy requires a View with LayoutTiled");
+  using policy_type =
+      MDRangePolicy<ExecutionSpace,
+                    Rank<array_layout::rank, array_layout::outer_pattern,
+                         array_layout::inner_pattern>>;
+  using point_type = typename policy_type::point_type;
+  using tile_type  = typename policy_type::tile_type;
+
+  constexpr unsigned tile_dims[3] = {array_layout::N0, array_layout::N1,
+                                     array_layout::N2};
+
+  point_type upper = {};
+  tile_type tile   = {};
+  for (unsigned r = 0; r < array_layout::rank; ++r) {
+    upper[r] = view.extent(r);
+    tile[r]  = tile_dims[r];
+  }
+  return policy_type(space, point_type{}, upper, tile);
+}
+
+template <class ViewType>
+auto make_tiled_mdrange_policy(const ViewType& view) {
+  return make_tiled_mdrange_policy(typename ViewType::execution_space(), view);
+}
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 #endif  // KOKKOS_CORE_EXP_MD_RANGE_POLICY_HPP
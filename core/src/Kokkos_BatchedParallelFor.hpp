@@ -0,0 +1,210 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_BATCHED_PARALLEL_FOR_HPP
+#define KOKKOS_BATCHED_PARALLEL_FOR_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_CopyViews.hpp>
+#include <impl/Kokkos_Utilities.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+// One kernel of a batch: functor(i) is called for every i in [begin, end).
+template <class FunctorType, class IndexType = std::int64_t>
+struct BatchedWorkItem {
+  FunctorType functor;
+  IndexType begin;
+  IndexType end;
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+// The work items are cut into chunks of at most chunk_size iterations and
+// every index of the launched range is one chunk: the dynamic schedule of
+// the range is the shared work queue balancing the chunks across threads.
+template <class FunctorType, class IndexType>
+struct BatchedParallelForFunctor {
+  using item_type =
+      Kokkos::Experimental::BatchedWorkItem<FunctorType, IndexType>;
+
+  const item_type* m_items;
+  // m_chunk_offsets[k] is the index of the first chunk of item k
+  const IndexType* m_chunk_offsets;
+  IndexType m_num_items;
+  IndexType m_chunk_size;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType chunk) const {
+    // last item whose first chunk is not after chunk, empty items own no
+    // chunk and are skipped
+    IndexType lo = 0;
+    IndexType hi = m_num_items;
+    while (hi - lo > 1) {
+      const IndexType mid = lo + (hi - lo) / 2;
+      if (m_chunk_offsets[mid] <= chunk) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+
+    const item_type& item = m_items[lo];
+    const IndexType begin =
+        item.begin + (chunk - m_chunk_offsets[lo]) * m_chunk_size;
+    const IndexType end =
+        begin + m_chunk_size < item.end ? begin + m_chunk_size : item.end;
+    for (IndexType i = begin; i < end; ++i) {
+      item.functor(i);
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Executes a batch of small parallel_for kernels in a single launch. This
+// avoids paying the launch overhead of the backend (e.g. the fork/join of a
+// parallel region and the instance lock of OpenMP) once per kernel.
+// The items may run concurrently and in any order, so they must not
+// depend on each other.
+// chunk_size is the largest number of iterations executed as one unit of
+// work, 0 lets the implementation pick it from the total amount of work.
+// The items are not copied for host execution spaces and only as bytes for
+// the other ones, so the call fences the execution space before returning.
+template <class ExecutionSpace, class FunctorType, class IndexType>
+void parallel_for_batched(
+    const std::string& label, const ExecutionSpace& ex,
+    const std::vector<BatchedWorkItem<FunctorType, IndexType>>& items,
+    Kokkos::Impl::type_identity_t<IndexType> chunk_size = 0) {
+  static_assert(Kokkos::is_execution_space_v<ExecutionSpace>,
+                "Kokkos::Experimental::parallel_for_batched: the second "
+                "argument must be an execution space");
+  static_assert(std::is_integral_v<IndexType>,
+                "Kokkos::Experimental::parallel_for_batched: the index type "
+                "of the work items must be integral");
+
+  using item_type    = BatchedWorkItem<FunctorType, IndexType>;
+  using memory_space = typename ExecutionSpace::memory_space;
+  using func_type    =
+      Kokkos::Impl::BatchedParallelForFunctor<FunctorType, IndexType>;
+
+  const IndexType num_items = items.size();
+  if (num_items == 0) return;
+
+  IndexType total_work = 0;
+  for (const auto& item : items) {
+    if (item.end > item.begin) total_work += item.end - item.begin;
+  }
+  if (total_work == 0) return;
+  if (chunk_size <= 0) {
+    // a few chunks per thread for the load balancing, but not so small that
+    // handing them out dominates the work
+    const IndexType num_chunks = 8 * IndexType(ex.concurrency());
+    chunk_size = (total_work + num_chunks - 1) / num_chunks;
+    if (chunk_size < 32) chunk_size = 32;
+  }
+
+  Kokkos::View<IndexType*, memory_space> chunk_offsets(
+      Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                         "Kokkos::parallel_for_batched::chunk_offsets"),
+      num_items);
+  auto chunk_offsets_h = Kokkos::create_mirror_view(chunk_offsets);
+  IndexType num_chunks = 0;
+  for (IndexType k = 0; k < num_items; ++k) {
+    chunk_offsets_h(k)   = num_chunks;
+    const IndexType size = items[k].end - items[k].begin;
+    if (size > 0) num_chunks += (size + chunk_size - 1) / chunk_size;
+  }
+  Kokkos::deep_copy(ex, chunk_offsets, chunk_offsets_h);
+
+  const item_type* items_ptr = items.data();
+  Kokkos::View<unsigned char*, memory_space> items_buffer;
+  if constexpr (!Kokkos::SpaceAccessibility<ExecutionSpace,
+                                            Kokkos::HostSpace>::accessible) {
+    // the functors are copied as bytes like the backends copy functors for
+    // a launch, the items are not constructed nor destroyed in the buffer
+    const std::size_t bytes = num_items * sizeof(item_type);
+
+    items_buffer = Kokkos::View<unsigned char*, memory_space>(
+        Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                           "Kokkos::parallel_for_batched::items"),
+        bytes);
+    Kokkos::deep_copy(
+        ex, items_buffer,
+        Kokkos::View<const unsigned char*, Kokkos::HostSpace,
+                     Kokkos::MemoryUnmanaged>(
+            reinterpret_cast<const unsigned char*>(items.data()), bytes));
+    items_ptr = reinterpret_cast<const item_type*>(items_buffer.data());
+  }
+
+  Kokkos::parallel_for(
+      label,
+      Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>,
+                          Kokkos::IndexType<IndexType>>(ex, 0, num_chunks)
+          .set_chunk_size(1),
+      func_type{items_ptr, chunk_offsets.data(), num_items, chunk_size});
+  ex.fence(
+      "Kokkos::Experimental::parallel_for_batched: fence after operation "
+      "since the work items are borrowed");
+}
+
+template <class ExecutionSpace, class FunctorType, class IndexType>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>>
+parallel_for_batched(
+    const ExecutionSpace& ex,
+    const std::vector<BatchedWorkItem<FunctorType, IndexType>>& items,
+    Kokkos::Impl::type_identity_t<IndexType> chunk_size = 0) {
+  parallel_for_batched("Kokkos::parallel_for_batched", ex, items, chunk_size);
+}
+
+template <class FunctorType, class IndexType>
+void parallel_for_batched(
+    const std::string& label,
+    const std::vector<BatchedWorkItem<FunctorType, IndexType>>& items,
+    Kokkos::Impl::type_identity_t<IndexType> chunk_size = 0) {
+  parallel_for_batched(label, Kokkos::DefaultExecutionSpace(), items,
+                       chunk_size);
+}
+
+template <class FunctorType, class IndexType>
+void parallel_for_batched(
+    const std::vector<BatchedWorkItem<FunctorType, IndexType>>& items,
+    Kokkos::Impl::type_identity_t<IndexType> chunk_size = 0) {
+  parallel_for_batched("Kokkos::parallel_for_batched",
+                       Kokkos::DefaultExecutionSpace(), items, chunk_size);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -21,6 +21,8 @@ static_assert(false,
 #endif
 #ifndef KOKKOS_COPYVIEWS_HPP_
 #define KOKKOS_COPYVIEWS_HPP_
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <Kokkos_Parallel.hpp>
@@ -35,6 +37,16 @@ namespace Kokkos {
 
 namespace Impl {
 
+// Views with the StreamingStore trait in memory the host can access are
+// filled through the stores of ViewFill, which bypass the caches, instead of
+// with memset. Copies keep std::memcpy, which already writes large blocks
+// around the caches with vector stores.
+template <class ViewType>
+inline constexpr bool is_host_streaming_store_view_v =
+    ViewType::memory_traits::is_streaming_store &&
+    Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                               typename ViewType::memory_space>::accessible;
+
 template <class Layout>
 struct ViewFillLayoutSelector {};
 
@@ -269,6 +281,35 @@ struct ViewFill<ViewType, Layout, ExecSpace, 8, iType> {
   };
 };
 
+// Copies between LayoutLeft and LayoutRight transpose the data, with the
+// default host tiles one of the two views is then walked with a large stride
+// along a whole extent. On the host these copies go through square blocks of
+// the first and the last dimension, the contiguous ones of the two layouts,
+// small enough for the blocks of both views to stay in the L1 cache. The zero
+// tiles of the other copies select the default tiles of MDRangePolicy.
+template <class ViewTypeA, class ViewTypeB, class ExecSpace, int Rank>
+Kokkos::Array<int64_t, Rank> view_copy_tile() {
+  using layout_a = typename ViewTypeA::array_layout;
+  using layout_b = typename ViewTypeB::array_layout;
+
+  Kokkos::Array<int64_t, Rank> tile = {};
+  if constexpr (Kokkos::SpaceAccessibility<ExecSpace,
+                                           Kokkos::HostSpace>::accessible &&
+                ((std::is_same_v<layout_a, Kokkos::LayoutLeft> &&
+                  std::is_same_v<layout_b, Kokkos::LayoutRight>) ||
+                 (std::is_same_v<layout_a, Kokkos::LayoutRight> &&
+                  std::is_same_v<layout_b, Kokkos::LayoutLeft>))) {
+    // the largest power of two in [8, 64] with blocks of at most 8 KiB
+    constexpr int64_t value_size = sizeof(typename ViewTypeA::value_type);
+    int64_t block                = 8;
+    while (block < 64 && 4 * block * block * value_size <= 8192) block *= 2;
+    for (int r = 0; r < Rank; ++r) tile[r] = 1;
+    tile[0]        = block;
+    tile[Rank - 1] = block;
+  }
+  return tile;
+}
+
 template <class ViewTypeA, class ViewTypeB, class Layout, class ExecSpace,
           typename iType>
 struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 1, iType> {
@@ -311,8 +352,10 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 2, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 2>();
     Kokkos::parallel_for("Kokkos::ViewCopy-2D",
-                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}),
+                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)},
+                                     {tile[0], tile[1]}),
                          *this);
   }
 
@@ -343,9 +386,11 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 3, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 3>();
     Kokkos::parallel_for(
         "Kokkos::ViewCopy-3D",
-        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}),
+        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)},
+                    {tile[0], tile[1], tile[2]}),
         *this);
   }
 
@@ -375,10 +420,12 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 4, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 4>();
     Kokkos::parallel_for(
         "Kokkos::ViewCopy-4D",
         policy_type(space, {0, 0, 0, 0},
-                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)}),
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)},
+                    {tile[0], tile[1], tile[2], tile[3]}),
         *this);
   }
 
@@ -409,10 +456,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 5, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 5>();
     Kokkos::parallel_for("Kokkos::ViewCopy-5D",
                          policy_type(space, {0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4)}),
+                                      a.extent(3), a.extent(4)},
+                                     {tile[0], tile[1], tile[2], tile[3],
+                                      tile[4]}),
                          *this);
   }
 
@@ -443,10 +493,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 6, iType> {
   ViewCopy(const ViewTypeA& a_, const ViewTypeB& b_,
            const ExecSpace space = ExecSpace())
       : a(a_), b(b_) {
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 6>();
     Kokkos::parallel_for("Kokkos::ViewCopy-6D",
                          policy_type(space, {0, 0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(2),
-                                      a.extent(3), a.extent(4), a.extent(5)}),
+                                      a.extent(3), a.extent(4), a.extent(5)},
+                                     {tile[0], tile[1], tile[2], tile[3],
+                                      tile[4], tile[5]}),
                          *this);
   }
 
@@ -479,10 +532,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 7, iType> {
       : a(a_), b(b_) {
     // MDRangePolicy is not supported for 7D views
     // Iterate separately over extent(2)
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 6>();
     Kokkos::parallel_for("Kokkos::ViewCopy-7D",
                          policy_type(space, {0, 0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(3),
-                                      a.extent(4), a.extent(5), a.extent(6)}),
+                                      a.extent(4), a.extent(5), a.extent(6)},
+                                     {tile[0], tile[1], tile[2], tile[3],
+                                      tile[4], tile[5]}),
                          *this);
   }
 
@@ -516,10 +572,13 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType> {
       : a(a_), b(b_) {
     // MDRangePolicy is not supported for 8D views
     // Iterate separately over extent(2) and extent(4)
+    const auto tile = view_copy_tile<ViewTypeA, ViewTypeB, ExecSpace, 6>();
     Kokkos::parallel_for("Kokkos::ViewCopy-8D",
                          policy_type(space, {0, 0, 0, 0, 0, 0},
                                      {a.extent(0), a.extent(1), a.extent(3),
-                                      a.extent(5), a.extent(6), a.extent(7)}),
+                                      a.extent(5), a.extent(6), a.extent(7)},
+                                     {tile[0], tile[1], tile[2], tile[3],
+                                      tile[4], tile[5]}),
                          *this);
   }
 
@@ -538,6 +597,140 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType> {
 namespace Kokkos {
 namespace Impl {
 
+// Copies between host views of the same trivially copyable value type whose
+// innermost dimension is contiguous in both views, e.g. subview(a, ALL, r, 3)
+// of a LayoutLeft view. The dimensions following the innermost one are
+// collapsed into a single run as long as the run stays contiguous in both
+// views, the remaining outer dimensions are iterated over and each iteration
+// copies a run, or a piece of one, with std::memcpy.
+template <class ValueType, int Rank>
+struct ViewCopyContiguousRuns {
+  ValueType* dst;
+  const ValueType* src;
+  int64_t run_length;
+  int64_t piece_length;
+  int64_t pieces;
+  int outer_rank;
+  int64_t extents[Rank];
+  int64_t dst_strides[Rank];
+  int64_t src_strides[Rank];
+
+  void operator()(const int64_t i) const {
+    int64_t run          = i / pieces;
+    const int64_t begin  = (i % pieces) * piece_length;
+    const int64_t length = std::min(piece_length, run_length - begin);
+    int64_t dst_offset   = begin;
+    int64_t src_offset   = begin;
+    for (int r = 0; r < outer_rank; ++r) {
+      const int64_t index = run % extents[r];
+      run /= extents[r];
+      dst_offset += index * dst_strides[r];
+      src_offset += index * src_strides[r];
+    }
+    std::memcpy(dst + dst_offset, src + src_offset,
+                length * sizeof(ValueType));
+  }
+};
+
+// The strides of these layouts describe the addressing of the entries, unlike
+// e.g. the ones of LayoutTiled, see ViewOffset.
+template <class Layout>
+inline constexpr bool view_copy_layout_is_strided_v =
+    std::is_same_v<Layout, Kokkos::LayoutLeft> ||
+    std::is_same_v<Layout, Kokkos::LayoutRight> ||
+    std::is_same_v<Layout, Kokkos::LayoutStride>;
+
+// Returns false if the copy has to go through ViewCopy: the execution space
+// can't access host memory, the value types differ, one of the layouts is not
+// strided, or the contiguous runs are too short for std::memcpy to beat the
+// element-wise copy.
+template <class ExecutionSpace, class DstType, class SrcType>
+bool view_copy_contiguous_runs(const ExecutionSpace& space, const DstType& dst,
+                               const SrcType& src) {
+  using value_type   = typename DstType::value_type;
+  using dst_layout   = typename DstType::array_layout;
+  using src_layout   = typename SrcType::array_layout;
+  constexpr int rank = DstType::rank;
+  if constexpr (!Kokkos::SpaceAccessibility<ExecutionSpace,
+                                            Kokkos::HostSpace>::accessible ||
+                !std::is_same_v<value_type,
+                                typename SrcType::non_const_value_type> ||
+                !std::is_trivially_copyable_v<value_type> || rank == 0 ||
+                !view_copy_layout_is_strided_v<dst_layout> ||
+                !view_copy_layout_is_strided_v<src_layout>) {
+    return false;
+  } else {
+    // runs shorter than a cache line are copied as fast element by element,
+    // the pieces of a run copied by the threads are at least a page long
+    constexpr int64_t min_run_bytes   = 64;
+    constexpr int64_t min_piece_bytes = 4096;
+
+    int64_t extents[rank];
+    int64_t dst_strides[rank + 1];
+    int64_t src_strides[rank + 1];
+    dst.stride(dst_strides);
+    src.stride(src_strides);
+    // the dimensions of extent one don't matter
+    int dims[rank];
+    int nontrivial = 0;
+    for (int r = 0; r < rank; ++r) {
+      extents[r] = dst.extent(r);
+      if (extents[r] == 0) return true;
+      if (extents[r] > 1) dims[nontrivial++] = r;
+    }
+    if (nontrivial == 0) return false;
+
+    // the innermost dimension is the first one for LayoutLeft-like strides
+    // and the last one for LayoutRight-like strides
+    auto const contiguous = [&](int r) {
+      return dst_strides[r] == 1 && src_strides[r] == 1;
+    };
+    if (!contiguous(dims[0])) {
+      if (!contiguous(dims[nontrivial - 1])) return false;
+      for (int k = 0; k < nontrivial / 2; ++k)
+        std::swap(dims[k], dims[nontrivial - 1 - k]);
+    }
+
+    int k              = 0;
+    int64_t run_length = extents[dims[k++]];
+    while (k < nontrivial && dst_strides[dims[k]] == run_length &&
+           src_strides[dims[k]] == run_length) {
+      run_length *= extents[dims[k++]];
+    }
+    if (run_length * int64_t(sizeof(value_type)) < min_run_bytes) return false;
+
+    ViewCopyContiguousRuns<value_type, rank> functor;
+    functor.dst        = dst.data();
+    functor.src        = src.data();
+    functor.run_length = run_length;
+    functor.outer_rank = nontrivial - k;
+    int64_t runs       = 1;
+    for (int r = 0; k < nontrivial; ++r, ++k) {
+      functor.extents[r]     = extents[dims[k]];
+      functor.dst_strides[r] = dst_strides[dims[k]];
+      functor.src_strides[r] = src_strides[dims[k]];
+      runs *= extents[dims[k]];
+    }
+
+    // split the runs if there are fewer of them than threads
+    const int64_t concurrency = space.concurrency();
+    const int64_t max_pieces =
+        std::max<int64_t>(1, run_length * int64_t(sizeof(value_type)) /
+                                 min_piece_bytes);
+    const int64_t pieces =
+        std::min(max_pieces, (concurrency + runs - 1) / runs);
+    functor.pieces       = pieces;
+    functor.piece_length = (run_length + pieces - 1) / pieces;
+
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-ContiguousRuns",
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::IndexType<int64_t>>(
+            space, 0, runs * pieces),
+        functor);
+    return true;
+  }
+}
+
 template <class ExecutionSpace, class DstType, class SrcType>
 void view_copy(const ExecutionSpace& space, const DstType& dst,
                const SrcType& src) {
@@ -557,6 +750,8 @@ void view_copy(const ExecutionSpace& space, const DstType& dst,
     Kokkos::Impl::throw_runtime_exception(
         "Kokkos::Impl::view_copy called with invalid execution space");
   } else {
+    if (view_copy_contiguous_runs(space, dst, src)) return;
+
     // Figure out iteration order in case we need it
     int64_t strides[DstType::rank + 1];
     dst.stride(strides);
@@ -644,6 +839,11 @@ void view_copy(const DstType& dst, const SrcType& src) {
     Kokkos::Impl::throw_runtime_exception(ss.str());
   }
 
+  using copy_execution_space =
+      std::conditional_t<bool(DstExecCanAccessSrc), dst_execution_space,
+                         src_execution_space>;
+  if (view_copy_contiguous_runs(copy_execution_space(), dst, src)) return;
+
   // Figure out iteration order in case we need it
   int64_t strides[DstType::rank + 1];
   dst.stride(strides);
@@ -1334,7 +1534,9 @@ inline void contiguous_fill(
                      std::conditional_t<ViewType::rank == 0,
                                         typename ViewType::memory_space,
                                         Kokkos::AnonymousSpace>>,
-      Kokkos::MemoryTraits<0>>;
+      Kokkos::MemoryTraits<ViewType::memory_traits::is_streaming_store
+                               ? Kokkos::StreamingStore
+                               : 0>>;
 
   ViewTypeFlat dst_flat(dst.data(), dst.size());
   if (dst.span() < static_cast<size_t>(std::numeric_limits<int>::max())) {
@@ -1366,7 +1568,8 @@ contiguous_fill_or_memset(
     const ExecutionSpace& exec_space, const View<DT, DP...>& dst,
     typename ViewTraits<DT, DP...>::const_value_type& value) {
   // With OpenMP, using memset has significant performance issues.
-  if (Impl::is_zero_byte(value)
+  if (!is_host_streaming_store_view_v<View<DT, DP...>> &&
+      Impl::is_zero_byte(value)
 #ifdef KOKKOS_ENABLE_OPENMP
       && !std::is_same_v<ExecutionSpace, Kokkos::OpenMP>
 #endif
@@ -1404,7 +1607,7 @@ contiguous_fill_or_memset(
 // On A64FX memset seems to do the wrong thing with regards to first touch
 // leading to the significant performance issues
 #ifndef KOKKOS_ARCH_A64FX
-  if (Impl::is_zero_byte(value))
+  if (!is_host_streaming_store_view_v<ViewType> && Impl::is_zero_byte(value))
     // FIXME intel/19 icpc fails to deduce template parameter here,
     // resulting in compilation errors; explicitly passing the template
     // parameter to ZeroMemset helps workaround the issue.
@@ -2939,7 +3142,7 @@ inline void deep_copy(
       Impl::view_copy(exec_space, dst, src);
     } else if (DstExecCanAccessSrc || SrcExecCanAccessDst) {
       using cpy_exec_space =
-          std::conditional_t<DstExecCanAccessSrc, dst_execution_space,
+          std::conditional_t<bool(DstExecCanAccessSrc), dst_execution_space,
                              src_execution_space>;
       exec_space.fence(
           "Kokkos::deep_copy: view-to-view noncontiguous copy on space, pre "
@@ -58,6 +58,7 @@
 #include <Kokkos_MemoryPool.hpp>
 #include <Kokkos_Array.hpp>
 #include <Kokkos_View.hpp>
+#include <Kokkos_Prefetch.hpp>
 #include <Kokkos_Vectorization.hpp>
 #include <Kokkos_Atomic.hpp>
 #include <Kokkos_hwloc.hpp>
@@ -293,6 +294,7 @@ std::vector<ExecSpace> partition_space(ExecSpace const& space,
 
 #include <Kokkos_Crs.hpp>
 #include <Kokkos_WorkGraphPolicy.hpp>
+#include <Kokkos_BatchedParallelFor.hpp>
 // Including this in Kokkos_Parallel_Reduce.hpp led to a circular dependency
 // because Kokkos::Sum is used in Kokkos_Combined_Reducer.hpp and the default.
 // The real answer is to finally break up Kokkos_Parallel_Reduce.hpp into
@@ -21,7 +21,9 @@
 #define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_HALF
 #endif
 
+#include <impl/Kokkos_Host_Half_Impl_Type.hpp>
 #include <impl/Kokkos_Half_FloatingPointWrapper.hpp>
+#include <impl/Kokkos_Host_Half_Conversion.hpp>
 #include <impl/Kokkos_Half_NumericTraits.hpp>
 #include <impl/Kokkos_Half_MathematicalFunctions.hpp>
 
@@ -232,7 +232,141 @@ template <typename Layout, class Enable = void>
 struct KOKKOS_DEPRECATED is_layouttiled : std::false_type {};
 #endif
 
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+/// \struct LayoutTiled
+/// \brief Memory layout tag indicating a blocked mapping of rank 2 or rank 3
+///   multi-indices.
+///
+/// The index space is covered by tiles of ArgN0 x ArgN1 (x ArgN2) entries
+/// whose extents must be powers of two.  Each tile occupies one contiguous
+/// chunk of memory in which the entries are ordered according to InnerP,
+/// while the tiles themselves are ordered according to OuterP.  Tiles at the
+/// upper end of a dimension are padded, so that the span of a View with this
+/// layout exceeds its size unless every extent is a multiple of the tile
+/// extent.  A rank 2 layout is selected by ArgN2 == 0.  Individual tiles are
+/// accessed through Kokkos::Experimental::tile_subview, general subviews are
+/// not supported.
+template <Kokkos::Iterate OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2 = 0>
+struct LayoutTiled {
+  static_assert(OuterP != Kokkos::Iterate::Default &&
+                    InnerP != Kokkos::Iterate::Default,
+                "LayoutTiled requires Iterate::Left or Iterate::Right as "
+                "outer and inner pattern");
+  static_assert(Impl::is_integral_power_of_two(ArgN0) &&
+                    Impl::is_integral_power_of_two(ArgN1) &&
+                    (ArgN2 == 0 || Impl::is_integral_power_of_two(ArgN2)),
+                "LayoutTiled requires power-of-two tile dimensions");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutTiled;
+
+  static constexpr Kokkos::Iterate outer_pattern = OuterP;
+  static constexpr Kokkos::Iterate inner_pattern = InnerP;
+
+  static constexpr unsigned rank = ArgN2 == 0 ? 2 : 3;
+
+  static constexpr unsigned N0 = ArgN0;
+  static constexpr unsigned N1 = ArgN1;
+  static constexpr unsigned N2 = ArgN2 == 0 ? 1 : ArgN2;
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutTiled(LayoutTiled const&)            = default;
+  LayoutTiled(LayoutTiled&&)                 = default;
+  LayoutTiled& operator=(LayoutTiled const&) = default;
+  LayoutTiled& operator=(LayoutTiled&&)      = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutTiled(size_t argN0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : dimension{argN0, argN1, argN2, argN3, argN4, argN5, argN6, argN7} {}
+
+  friend bool operator==(const LayoutTiled& left, const LayoutTiled& right) {
+    for (unsigned int r = 0; r < ARRAY_LAYOUT_MAX_RANK; ++r)
+      if (left.dimension[r] != right.dimension[r]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const LayoutTiled& left, const LayoutTiled& right) {
+    return !(left == right);
+  }
+};
+
+template <typename Layout>
+struct is_layout_tiled : std::false_type {};
+
+template <Kokkos::Iterate OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2>
+struct is_layout_tiled<LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>>
+    : std::true_type {};
+
+template <typename Layout>
+inline constexpr bool is_layout_tiled_v = is_layout_tiled<Layout>::value;
+
+}  // namespace Experimental
+
 namespace Impl {
+
+// Index arithmetic of a LayoutTiled shared by the View mapping and the mdspan
+// layout mapping.  Tile extents are powers of two, so that the tile index and
+// the position within the tile are a shift and a mask of the index.
+template <class Layout>
+struct LayoutTiledOffset {
+  static constexpr unsigned rank = Layout::rank;
+
+  static constexpr unsigned shift_0 = integral_power_of_two(Layout::N0);
+  static constexpr unsigned shift_1 = integral_power_of_two(Layout::N1);
+  static constexpr unsigned shift_2 = integral_power_of_two(Layout::N2);
+
+  static constexpr size_t mask_0 = Layout::N0 - 1;
+  static constexpr size_t mask_1 = Layout::N1 - 1;
+  static constexpr size_t mask_2 = Layout::N2 - 1;
+
+  // log2 of the number of entries of one tile
+  static constexpr unsigned shift_tile = shift_0 + shift_1 + shift_2;
+
+  static constexpr bool outer_left =
+      Layout::outer_pattern == Kokkos::Iterate::Left;
+  static constexpr bool inner_left =
+      Layout::inner_pattern == Kokkos::Iterate::Left;
+
+  // Number of tiles needed to cover extent n along dimension r
+  KOKKOS_INLINE_FUNCTION static constexpr size_t tile_count(unsigned r,
+                                                            size_t n) {
+    return r == 0   ? (n + mask_0) >> shift_0
+           : r == 1 ? (n + mask_1) >> shift_1
+                    : (n + mask_2) >> shift_2;
+  }
+
+  // Offset of (i0, i1, i2) in an array covered by t0 x t1 x t2 tiles
+  KOKKOS_INLINE_FUNCTION static constexpr size_t offset(size_t t0, size_t t1,
+                                                        size_t t2, size_t i0,
+                                                        size_t i1, size_t i2) {
+    size_t const tile =
+        outer_left
+            ? (i0 >> shift_0) + t0 * ((i1 >> shift_1) + t1 * (i2 >> shift_2))
+            : ((i0 >> shift_0) * t1 + (i1 >> shift_1)) * t2 + (i2 >> shift_2);
+    size_t const local =
+        inner_left
+            ? (i0 & mask_0) +
+                  (((i1 & mask_1) + ((i2 & mask_2) << shift_1)) << shift_0)
+            : ((((i0 & mask_0) << shift_1) + (i1 & mask_1)) << shift_2) +
+                  (i2 & mask_2);
+    return (tile << shift_tile) + local;
+  }
+};
+
 // For use with view_copy
 template <typename... Layout>
 struct layout_iterate_type_selector {
@@ -261,6 +395,14 @@ struct layout_iterate_type_selector<Kokkos::LayoutStride> {
   static const Kokkos::Iterate inner_iteration_pattern =
       Kokkos::Iterate::Default;
 };
+
+template <Kokkos::Iterate OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2>
+struct layout_iterate_type_selector<
+    Kokkos::Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>> {
+  static const Kokkos::Iterate outer_iteration_pattern = OuterP;
+  static const Kokkos::Iterate inner_iteration_pattern = InnerP;
+};
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
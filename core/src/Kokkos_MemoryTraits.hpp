@@ -37,11 +37,12 @@ namespace Kokkos {
  *  these traits are present.
  */
 enum MemoryTraitsFlags {
-  Unmanaged    = 0x01,
-  RandomAccess = 0x02,
-  Atomic       = 0x04,
-  Restrict     = 0x08,
-  Aligned      = 0x10
+  Unmanaged      = 0x01,
+  RandomAccess   = 0x02,
+  Atomic         = 0x04,
+  Restrict       = 0x08,
+  Aligned        = 0x10,
+  StreamingStore = 0x20
 };
 
 template <unsigned T>
@@ -61,6 +62,8 @@ struct MemoryTraits {
       (unsigned(0) != (T & unsigned(Kokkos::Restrict)));
   static constexpr bool is_aligned =
       (unsigned(0) != (T & unsigned(Kokkos::Aligned)));
+  static constexpr bool is_streaming_store =
+      (unsigned(0) != (T & unsigned(Kokkos::StreamingStore)));
 };
 
 }  // namespace Kokkos
@@ -37,6 +37,7 @@ static_assert(false,
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 
 #include <cstddef>
+#include <string_view>
 #include <type_traits>
 #include <typeinfo>
 
@@ -98,6 +99,61 @@ struct FunctorPolicyExecutionSpace {
       execution_space_t, Policy>;
 };
 
+//----------------------------------------------------------------------------
+/** \brief  Whether parallel_for issues the prefetches of a RangePolicy with a
+ *          PrefetchDistance trait, only host execution spaces do.
+ */
+template <class Policy>
+struct is_host_prefetch_policy : std::false_type {};
+
+template <class... Properties>
+struct is_host_prefetch_policy<RangePolicy<Properties...>>
+    : std::bool_constant<
+          (RangePolicy<Properties...>::prefetch_distance > 0) &&
+          SpaceAccessibility<
+              typename RangePolicy<Properties...>::execution_space,
+              HostSpace>::accessible> {};
+
+template <class Functor, class... Args>
+using functor_prefetch_t =
+    decltype(std::declval<const Functor&>().prefetch(std::declval<Args>()...));
+
+/** \brief  Calls the prefetch member of the functor for the iteration that is
+ *          prefetch_distance iterations ahead before running iteration i.
+ */
+template <class FunctorType, class Policy>
+struct ParallelForPrefetchFunctor {
+  using index_type = typename Policy::index_type;
+  using work_tag   = typename Policy::work_tag;
+
+  static constexpr index_type distance = Policy::prefetch_distance;
+
+  static_assert(
+      std::is_void_v<work_tag>
+          ? is_detected_v<functor_prefetch_t, FunctorType, index_type>
+          : is_detected_v<functor_prefetch_t, FunctorType, work_tag,
+                          index_type>,
+      "Kokkos Error: a RangePolicy with a PrefetchDistance requires a functor "
+      "with a prefetch(i) or prefetch(WorkTag, i) member function");
+
+  FunctorType m_functor;
+  index_type m_end;
+
+  template <class Tag = work_tag>
+  KOKKOS_INLINE_FUNCTION std::enable_if_t<std::is_void_v<Tag>> operator()(
+      const index_type i) const {
+    if (distance < m_end - i) m_functor.prefetch(i + distance);
+    m_functor(i);
+  }
+
+  template <class Tag = work_tag>
+  KOKKOS_INLINE_FUNCTION std::enable_if_t<!std::is_void_v<Tag>> operator()(
+      const Tag& tag, const index_type i) const {
+    if (distance < m_end - i) m_functor.prefetch(tag, i + distance);
+    m_functor(tag, i);
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -126,11 +182,15 @@ namespace Kokkos {
  * over the range of integer indices <tt>iwork=[0,work_count-1]</tt>.
  * This compares to a single iteration \c iwork of a \c for loop.
  * If \c execution_space is not defined DefaultExecutionSpace will be used.
+ *
+ * The label is taken as a \c std::string_view so that launching with a string
+ * literal does not allocate; a \c std::string is only constructed when a tool
+ * is loaded or tuning is enabled.
  */
 template <
     class ExecPolicy, class FunctorType,
     class Enable = std::enable_if_t<is_execution_policy<ExecPolicy>::value>>
-inline void parallel_for(const std::string& str, const ExecPolicy& policy,
+inline void parallel_for(std::string_view str, const ExecPolicy& policy,
                          const FunctorType& functor) {
   uint64_t kpID = 0;
 
@@ -139,11 +199,24 @@ inline void parallel_for(const std::string& str, const ExecPolicy& policy,
       Kokkos::Tools::Impl::begin_parallel_for(policy, functor, str, kpID);
   const auto& inner_policy = response.policy;
 
-  auto closure =
-      Kokkos::Impl::construct_with_shared_allocation_tracking_disabled<
-          Impl::ParallelFor<FunctorType, ExecPolicy>>(functor, inner_policy);
+  if constexpr (Impl::is_host_prefetch_policy<ExecPolicy>::value) {
+    using prefetch_functor =
+        Impl::ParallelForPrefetchFunctor<FunctorType, ExecPolicy>;
+    auto closure =
+        Kokkos::Impl::construct_with_shared_allocation_tracking_disabled<
+            Impl::ParallelFor<prefetch_functor, ExecPolicy>>(
+            Kokkos::Impl::construct_with_shared_allocation_tracking_disabled<
+                prefetch_functor>(functor, inner_policy.end()),
+            inner_policy);
 
-  closure.execute();
+    closure.execute();
+  } else {
+    auto closure =
+        Kokkos::Impl::construct_with_shared_allocation_tracking_disabled<
+            Impl::ParallelFor<FunctorType, ExecPolicy>>(functor, inner_policy);
+
+    closure.execute();
+  }
 
   Kokkos::Tools::Impl::end_parallel_for(inner_policy, functor, str, kpID);
 }
@@ -156,7 +229,7 @@ inline void parallel_for(
 }
 
 template <class FunctorType>
-inline void parallel_for(const std::string& str, const size_t work_count,
+inline void parallel_for(std::string_view str, const size_t work_count,
                          const FunctorType& functor) {
   using execution_space =
       typename Impl::FunctorPolicyExecutionSpace<FunctorType,
@@ -348,7 +421,7 @@ namespace Kokkos {
 template <class ExecutionPolicy, class FunctorType,
           class Enable =
               std::enable_if_t<is_execution_policy<ExecutionPolicy>::value>>
-inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
+inline void parallel_scan(std::string_view str, const ExecutionPolicy& policy,
                           const FunctorType& functor) {
   uint64_t kpID = 0;
   /** Request a tuned policy from the tools subsystem */
@@ -374,7 +447,7 @@ inline void parallel_scan(
 }
 
 template <class FunctorType>
-inline void parallel_scan(const std::string& str, const size_t work_count,
+inline void parallel_scan(std::string_view str, const size_t work_count,
                           const FunctorType& functor) {
   using execution_space =
       typename Kokkos::Impl::FunctorPolicyExecutionSpace<FunctorType,
@@ -394,7 +467,7 @@ inline void parallel_scan(const size_t work_count, const FunctorType& functor) {
 template <class ExecutionPolicy, class FunctorType, class ReturnType,
           class Enable =
               std::enable_if_t<is_execution_policy<ExecutionPolicy>::value>>
-inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
+inline void parallel_scan(std::string_view str, const ExecutionPolicy& policy,
                           const FunctorType& functor,
                           ReturnType& return_value) {
   uint64_t kpID                = 0;
@@ -434,7 +507,7 @@ inline void parallel_scan(
 }
 
 template <class FunctorType, class ReturnType>
-inline void parallel_scan(const std::string& str, const size_t work_count,
+inline void parallel_scan(std::string_view str, const size_t work_count,
                           const FunctorType& functor,
                           ReturnType& return_value) {
   using execution_space =
@@ -26,6 +26,7 @@ static_assert(false,
 #include <Kokkos_View.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_Tools_Generic.hpp>
+#include <string_view>
 #include <type_traits>
 
 namespace Kokkos {
@@ -1506,7 +1507,7 @@ struct ParallelReduceAdaptor {
   using return_value_adapter =
       Impl::ParallelReduceReturnValue<void, ReturnType, FunctorType>;
 
-  static inline void execute_impl(const std::string& label,
+  static inline void execute_impl(std::string_view label,
                                   const PolicyType& policy,
                                   const FunctorType& functor,
                                   ReturnType& return_value) {
@@ -1550,7 +1551,7 @@ struct ParallelReduceAdaptor {
   template <typename Dummy = ReturnType>
   static inline std::enable_if_t<!(is_array_reduction &&
                                    std::is_pointer_v<Dummy>)>
-  execute(const std::string& label, const PolicyType& policy,
+  execute(std::string_view label, const PolicyType& policy,
           const FunctorType& functor, ReturnType& return_value) {
     execute_impl(label, policy, functor, return_value);
   }
@@ -1562,12 +1563,12 @@ struct ParallelReduceAdaptor {
 /*! \fn void parallel_reduce(label,policy,functor,return_argument)
     \brief Perform a parallel reduction.
     \param label An optional Label giving the call name. Must be able to
-   construct a std::string from the argument. \param policy A Kokkos Execution
-   Policy, such as an integer, a RangePolicy or a TeamPolicy. \param functor A
-   functor with a reduction operator, and optional init, join and final
-   functions. \param return_argument A return argument which can be a scalar, a
-   View, or a ReducerStruct. This argument can be left out if the functor has a
-   final function.
+   construct a std::string_view from the argument. \param policy A Kokkos
+   Execution Policy, such as an integer, a RangePolicy or a TeamPolicy. \param
+   functor A functor with a reduction operator, and optional init, join and
+   final functions. \param return_argument A return argument which can be a
+   scalar, a View, or a ReducerStruct. This argument can be left out if the
+   functor has a final function.
 */
 
 // Parallel Reduce Blocking behavior
@@ -1622,7 +1623,7 @@ parallel_reduce_needs_fence(ExecutionSpace const&, ViewLike const&) {
 template <class ExecutionSpace, class... Args>
 struct ParallelReduceFence {
   template <class... ArgsDeduced>
-  static void fence(const ExecutionSpace& ex, const std::string& name,
+  static void fence(const ExecutionSpace& ex, const char* name,
                     ArgsDeduced&&... args) {
     if (Impl::parallel_reduce_needs_fence(ex, (ArgsDeduced&&)args...)) {
       ex.fence(name);
@@ -1677,7 +1678,7 @@ inline std::enable_if_t<Kokkos::is_execution_policy<PolicyType>::value &&
                         !(Kokkos::is_view<ReturnType>::value ||
                           Kokkos::is_reducer<ReturnType>::value ||
                           std::is_pointer_v<ReturnType>)>
-parallel_reduce(const std::string& label, const PolicyType& policy,
+parallel_reduce(std::string_view label, const PolicyType& policy,
                 const FunctorType& functor, ReturnType& return_value) {
   static_assert(
       !std::is_const_v<ReturnType>,
@@ -1742,7 +1743,7 @@ template <class FunctorType, class ReturnType>
 inline std::enable_if_t<!(Kokkos::is_view<ReturnType>::value ||
                           Kokkos::is_reducer<ReturnType>::value ||
                           std::is_pointer_v<ReturnType>)>
-parallel_reduce(const std::string& label, const size_t& policy,
+parallel_reduce(std::string_view label, const size_t& policy,
                 const FunctorType& functor, ReturnType& return_value) {
   static_assert(
       !std::is_const_v<ReturnType>,
@@ -1768,7 +1769,7 @@ inline std::enable_if_t<Kokkos::is_execution_policy<PolicyType>::value &&
                         (Kokkos::is_view<ReturnType>::value ||
                          Kokkos::is_reducer<ReturnType>::value ||
                          std::is_pointer_v<ReturnType>)>
-parallel_reduce(const std::string& label, const PolicyType& policy,
+parallel_reduce(std::string_view label, const PolicyType& policy,
                 const FunctorType& functor, const ReturnType& return_value) {
   ReturnType return_value_impl = return_value;
   Impl::ParallelReduceAdaptor<PolicyType, FunctorType, ReturnType>::execute(
@@ -1820,7 +1821,7 @@ template <class FunctorType, class ReturnType>
 inline std::enable_if_t<Kokkos::is_view<ReturnType>::value ||
                         Kokkos::is_reducer<ReturnType>::value ||
                         std::is_pointer_v<ReturnType>>
-parallel_reduce(const std::string& label, const size_t& policy,
+parallel_reduce(std::string_view label, const size_t& policy,
                 const FunctorType& functor, const ReturnType& return_value) {
   using policy_type =
       typename Impl::ParallelReducePolicyType<void, size_t,
@@ -1839,7 +1840,7 @@ parallel_reduce(const std::string& label, const size_t& policy,
 
 template <class PolicyType, class FunctorType>
 inline void parallel_reduce(
-    const std::string& label, const PolicyType& policy,
+    std::string_view label, const PolicyType& policy,
     const FunctorType& functor,
     std::enable_if_t<Kokkos::is_execution_policy<PolicyType>::value>* =
         nullptr) {
@@ -1915,7 +1916,7 @@ inline void parallel_reduce(const size_t& policy, const FunctorType& functor) {
 }
 
 template <class FunctorType>
-inline void parallel_reduce(const std::string& label, const size_t& policy,
+inline void parallel_reduce(std::string_view label, const size_t& policy,
                             const FunctorType& functor) {
   using policy_type =
       typename Impl::ParallelReducePolicyType<void, size_t,
@@ -0,0 +1,72 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_PREFETCH_HPP
+#define KOKKOS_PREFETCH_HPP
+
+#include <Kokkos_View.hpp>
+
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+KOKKOS_IMPL_HOST_FUNCTION
+inline void prefetch_host(const void* ptr) {
+#if defined(__GNUC__)
+  __builtin_prefetch(ptr, 0, 3);
+#else
+  (void)ptr;
+#endif
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Hint that view(indices...) is going to be read soon.
+ *
+ *  On the host a software prefetch brings the cache line of the element into
+ *  all cache levels, the indices are not checked and may be out of bounds.
+ *  Device backends ignore the hint.
+ */
+template <class DataType, class... Properties, class... Indices>
+KOKKOS_FORCEINLINE_FUNCTION void prefetch(
+    const View<DataType, Properties...>& view, const Indices... indices) {
+  using view_type = View<DataType, Properties...>;
+  static_assert(std::is_void_v<typename view_type::specialize>,
+                "Kokkos::Experimental::prefetch requires a View without "
+                "specialization");
+  static_assert(sizeof...(Indices) == view_type::rank,
+                "Kokkos::Experimental::prefetch requires one index per rank");
+  if constexpr (view_type::rank == 0) {
+    KOKKOS_IF_ON_HOST((Kokkos::Impl::prefetch_host(view.data());))
+  } else {
+    KOKKOS_IF_ON_HOST((Kokkos::Impl::prefetch_host(
+        view.data() + view.impl_map().m_impl_offset(indices...));))
+  }
+  KOKKOS_IF_ON_DEVICE(((void)view; ((void)indices, ...);))
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
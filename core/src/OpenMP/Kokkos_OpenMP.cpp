@@ -24,6 +24,7 @@
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
 
 #include <impl/Kokkos_ExecSpaceManager.hpp>
+#include <impl/Kokkos_StreamingStoreFence.hpp>
 
 namespace Kokkos {
 
@@ -85,6 +86,7 @@ void OpenMP::impl_static_fence(std::string const &name) {
               instance_ptr->m_instance_mutex);
         }
       });
+  Impl::streaming_store_fence();
 }
 
 void OpenMP::fence(const std::string &name) const {
@@ -94,6 +96,7 @@ void OpenMP::fence(const std::string &name) const {
         auto *internal_instance = this->impl_internal_space_instance();
         std::lock_guard<std::mutex> lock(internal_instance->m_instance_mutex);
       });
+  Impl::streaming_store_fence();
 }
 
 bool OpenMP::impl_is_initialized() noexcept {
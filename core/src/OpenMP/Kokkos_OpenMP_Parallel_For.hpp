@@ -194,11 +194,21 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   typename std::enable_if<!std::is_same<typename Policy::schedule_type::type,
                                         Kokkos::Dynamic>::value>::type
   execute_parallel() const {
+    if constexpr (host_iterate_tile_morton_order<MDRangePolicy>) {
+      // Hand out contiguous segments of the tile curve
+#pragma omp parallel for schedule(static) \
+    num_threads(m_instance->thread_pool_size())
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
+        m_iter(iwork);
+      }
+    } else {
 #pragma omp parallel for schedule(static, 1) \
     num_threads(m_instance->thread_pool_size())
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
-      m_iter(iwork);
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
+        m_iter(iwork);
+      }
     }
   }
 
@@ -44,6 +44,7 @@ static_assert(false,
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_HostSharedPtr.hpp>
 #include <impl/Kokkos_InitializationSettings.hpp>
+#include <impl/Kokkos_StreamingStoreFence.hpp>
 
 namespace Kokkos {
 
@@ -157,6 +158,7 @@ class Serial {
           }
         });  // TODO: correct device ID
     Kokkos::memory_fence();
+    Impl::streaming_store_fence();
   }
 
   void fence(const std::string& name =
@@ -168,6 +170,7 @@ class Serial {
           std::lock_guard<std::mutex> lock(internal_instance->m_instance_mutex);
         });  // TODO: correct device ID
     Kokkos::memory_fence();
+    Impl::streaming_store_fence();
   }
 
   /** \brief  Return the maximum amount of concurrency.  */
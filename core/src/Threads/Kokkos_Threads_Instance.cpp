@@ -32,6 +32,7 @@
 #include <impl/Kokkos_CPUDiscovery.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
+#include <impl/Kokkos_StreamingStoreFence.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -79,12 +80,6 @@ inline unsigned fan_size(const unsigned rank, const unsigned size) {
   return count;
 }
 
-void wait_yield(volatile ThreadState &flag, const ThreadState value) {
-  while (value == flag) {
-    std::this_thread::yield();
-  }
-}
-
 }  // namespace
 }  // namespace Impl
 }  // namespace Kokkos
@@ -110,13 +105,13 @@ void ThreadsInternal::driver() {
 
   ThreadsInternal this_thread;
 
-  while (this_thread.m_pool_state == ThreadState::Active) {
+  while (this_thread.m_pool_state.value == ThreadState::Active) {
     (*s_current_function)(this_thread, s_current_function_arg);
 
     // Deactivate thread and wait for reactivation
-    this_thread.m_pool_state = ThreadState::Inactive;
+    set_thread_state(this_thread.m_pool_state, ThreadState::Inactive);
 
-    wait_yield(this_thread.m_pool_state, ThreadState::Inactive);
+    spinwait_while_equal(this_thread.m_pool_state, ThreadState::Inactive);
   }
 }
 
@@ -144,26 +139,27 @@ ThreadsInternal::ThreadsInternal()
     // Given a good entry set this thread in the 's_threads_exec' array
     if (entry < s_thread_pool_size[0] &&
         nil == atomic_compare_exchange(s_threads_exec + entry, nil, this)) {
-      m_pool_base     = s_threads_exec;
-      m_pool_rank     = s_thread_pool_size[0] - (entry + 1);
-      m_pool_rank_rev = s_thread_pool_size[0] - (pool_rank() + 1);
-      m_pool_size     = s_thread_pool_size[0];
-      m_pool_fan_size = fan_size(m_pool_rank, m_pool_size);
-      m_pool_state    = ThreadState::Active;
+      m_pool_base        = s_threads_exec;
+      m_pool_rank        = s_thread_pool_size[0] - (entry + 1);
+      m_pool_rank_rev    = s_thread_pool_size[0] - (pool_rank() + 1);
+      m_pool_size        = s_thread_pool_size[0];
+      m_pool_fan_size    = fan_size(m_pool_rank, m_pool_size);
+      m_pool_state.value = ThreadState::Active;
 
       s_threads_pid[m_pool_rank] = std::this_thread::get_id();
 
       // Inform spawning process that the threads_exec entry has been set.
-      s_threads_process.m_pool_state = ThreadState::Active;
+      set_thread_state(s_threads_process.m_pool_state, ThreadState::Active);
     } else {
       // Inform spawning process that the threads_exec entry could not be set.
-      s_threads_process.m_pool_state = ThreadState::Terminating;
+      set_thread_state(s_threads_process.m_pool_state,
+                       ThreadState::Terminating);
     }
   } else {
     // Enables 'parallel_for' to execute on unitialized Threads device
-    m_pool_rank  = 0;
-    m_pool_size  = 1;
-    m_pool_state = ThreadState::Inactive;
+    m_pool_rank        = 0;
+    m_pool_size        = 1;
+    m_pool_state.value = ThreadState::Inactive;
 
     s_threads_pid[m_pool_rank] = std::this_thread::get_id();
   }
@@ -184,14 +180,14 @@ ThreadsInternal::~ThreadsInternal() {
   m_pool_size          = 0;
   m_pool_fan_size      = 0;
 
-  m_pool_state = ThreadState::Terminating;
+  set_thread_state(m_pool_state, ThreadState::Terminating);
 
   if (&s_threads_process != this && entry < MAX_THREAD_COUNT) {
     ThreadsInternal *const nil = nullptr;
 
     atomic_compare_exchange(s_threads_exec + entry, this, nil);
 
-    s_threads_process.m_pool_state = ThreadState::Terminating;
+    set_thread_state(s_threads_process.m_pool_state, ThreadState::Terminating);
   }
 }
 
@@ -241,14 +237,18 @@ void ThreadsInternal::verify_is_process(const std::string &name,
   }
 }
 
-#ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
-KOKKOS_DEPRECATED int ThreadsInternal::in_parallel() {
+bool ThreadsInternal::impl_in_parallel() {
   // A thread function is in execution and
   // the function argument is not the special threads process argument and
   // the master process is a worker or is not the master process.
   return s_current_function && (&s_threads_process != s_current_function_arg) &&
          (s_threads_process.m_pool_base || !is_process());
 }
+
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
+KOKKOS_DEPRECATED int ThreadsInternal::in_parallel() {
+  return impl_in_parallel();
+}
 #endif
 void ThreadsInternal::fence() {
   fence("Kokkos::ThreadsInternal::fence: Unnamed Instance Fence");
@@ -273,6 +273,7 @@ void ThreadsInternal::internal_fence() {
   // Make sure function and arguments are cleared before
   // potentially re-activating threads with a subsequent launch.
   memory_fence();
+  Impl::streaming_store_fence();
 }
 
 /** \brief  Begin execution of the asynchronous functor */
@@ -295,13 +296,13 @@ void ThreadsInternal::start(void (*func)(ThreadsInternal &, const void *),
   // s_current_function. The root thread is only set to active, we still need to
   // call s_current_function.
   for (int i = s_thread_pool_size[0]; 0 < i--;) {
-    s_threads_exec[i]->m_pool_state = ThreadState::Active;
+    set_thread_state(s_threads_exec[i]->m_pool_state, ThreadState::Active);
   }
 
   if (s_threads_process.m_pool_size) {
     // Master process is the root thread, run it:
     (*func)(s_threads_process, arg);
-    s_threads_process.m_pool_state = ThreadState::Inactive;
+    set_thread_state(s_threads_process.m_pool_state, ThreadState::Inactive);
   }
 }
 
@@ -331,16 +332,16 @@ void ThreadsInternal::execute_resize_scratch_in_serial() {
   for (unsigned i = s_thread_pool_size[0]; begin < i;) {
     ThreadsInternal &th = *s_threads_exec[--i];
 
-    th.m_pool_state = ThreadState::Active;
+    set_thread_state(th.m_pool_state, ThreadState::Active);
 
-    wait_yield(th.m_pool_state, ThreadState::Active);
+    spinwait_while_equal(th.m_pool_state, ThreadState::Active);
   }
 
   if (s_threads_process.m_pool_base) {
     deallocate_scratch_memory(s_threads_process);
-    s_threads_process.m_pool_state = ThreadState::Active;
+    set_thread_state(s_threads_process.m_pool_state, ThreadState::Active);
     first_touch_allocate_thread_private_scratch(s_threads_process, nullptr);
-    s_threads_process.m_pool_state = ThreadState::Inactive;
+    set_thread_state(s_threads_process.m_pool_state, ThreadState::Inactive);
   }
 
   s_current_function_arg = nullptr;
@@ -516,7 +517,7 @@ void ThreadsInternal::initialize(int thread_count_arg) {
         &execute_function_noop;  // Initialization work function
 
     for (unsigned ith = 1; ith < thread_count; ++ith) {
-      s_threads_process.m_pool_state = ThreadState::Inactive;
+      set_thread_state(s_threads_process.m_pool_state, ThreadState::Inactive);
 
       // If hwloc available then spawned thread will
       // choose its own entry in 's_threads_coord'
@@ -534,8 +535,10 @@ void ThreadsInternal::initialize(int thread_count_arg) {
       // an entry in 's_threads_exec' will be assigned.
       std::thread t(internal_cppthread_driver);
       t.detach();
-      wait_yield(s_threads_process.m_pool_state, ThreadState::Inactive);
-      if (s_threads_process.m_pool_state == ThreadState::Terminating) break;
+      spinwait_while_equal(s_threads_process.m_pool_state,
+                           ThreadState::Inactive);
+      if (s_threads_process.m_pool_state.value == ThreadState::Terminating)
+        break;
     }
 
     // Wait for all spawned threads to deactivate before zeroing the function.
@@ -545,7 +548,7 @@ void ThreadsInternal::initialize(int thread_count_arg) {
       ThreadsInternal *const th =
           ((ThreadsInternal *volatile *)s_threads_exec)[ith];
       if (th) {
-        wait_yield(th->m_pool_state, ThreadState::Active);
+        spinwait_while_equal(th->m_pool_state, ThreadState::Active);
       } else {
         ++thread_spawn_failed;
       }
@@ -553,7 +556,7 @@ void ThreadsInternal::initialize(int thread_count_arg) {
 
     s_current_function             = nullptr;
     s_current_function_arg         = nullptr;
-    s_threads_process.m_pool_state = ThreadState::Inactive;
+    set_thread_state(s_threads_process.m_pool_state, ThreadState::Inactive);
 
     memory_fence();
 
@@ -630,11 +633,13 @@ void ThreadsInternal::finalize() {
 
   for (unsigned i = s_thread_pool_size[0]; begin < i--;) {
     if (s_threads_exec[i]) {
-      s_threads_exec[i]->m_pool_state = ThreadState::Terminating;
+      set_thread_state(s_threads_exec[i]->m_pool_state,
+                       ThreadState::Terminating);
 
-      wait_yield(s_threads_process.m_pool_state, ThreadState::Inactive);
+      spinwait_while_equal(s_threads_process.m_pool_state,
+                           ThreadState::Inactive);
 
-      s_threads_process.m_pool_state = ThreadState::Inactive;
+      set_thread_state(s_threads_process.m_pool_state, ThreadState::Inactive);
     }
 
     s_threads_pid[i] = std::thread::id();
@@ -654,11 +659,11 @@ void ThreadsInternal::finalize() {
   s_thread_pool_size[2] = 0;
 
   // Reset master thread to run solo.
-  s_threads_process.m_pool_base     = nullptr;
-  s_threads_process.m_pool_rank     = 0;
-  s_threads_process.m_pool_size     = 1;
-  s_threads_process.m_pool_fan_size = 0;
-  s_threads_process.m_pool_state    = ThreadState::Inactive;
+  s_threads_process.m_pool_base        = nullptr;
+  s_threads_process.m_pool_rank        = 0;
+  s_threads_process.m_pool_size        = 1;
+  s_threads_process.m_pool_fan_size    = 0;
+  s_threads_process.m_pool_state.value = ThreadState::Inactive;
 }
 
 //----------------------------------------------------------------------------
@@ -60,7 +60,7 @@ class ThreadsInternal {
   int m_pool_rank_rev;
   int m_pool_size;
   int m_pool_fan_size;
-  ThreadState volatile m_pool_state;  ///< State for global synchronizations
+  ThreadStateFlag m_pool_state;  ///< State for global synchronizations
 
   // Members for dynamic scheduling
   // Which thread am I stealing from currently
@@ -96,7 +96,7 @@ class ThreadsInternal {
     return reinterpret_cast<unsigned char *>(m_scratch) + m_scratch_reduce_end;
   }
 
-  KOKKOS_INLINE_FUNCTION ThreadState volatile &state() { return m_pool_state; }
+  KOKKOS_INLINE_FUNCTION ThreadStateFlag &state() { return m_pool_state; }
   KOKKOS_INLINE_FUNCTION ThreadsInternal *const *pool_base() const {
     return m_pool_base;
   }
@@ -141,7 +141,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_thread_state(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -161,7 +161,7 @@ class ThreadsInternal {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadState::Active;
+        set_thread_state(get_thread(rank)->m_pool_state, ThreadState::Active);
       }
     }
 
@@ -182,7 +182,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_thread_state(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -191,7 +191,7 @@ class ThreadsInternal {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadState::Active;
+        set_thread_state(get_thread(rank)->m_pool_state, ThreadState::Active);
       }
     }
   }
@@ -273,7 +273,7 @@ class ThreadsInternal {
 
     if (rev_rank) {
       // Set: Active -> ReductionAvailable
-      m_pool_state = ThreadState::ReductionAvailable;
+      set_thread_state(m_pool_state, ThreadState::ReductionAvailable);
 
       // Wait for contributing threads' scan value to be available.
       if ((1 << m_pool_fan_size) < (m_pool_rank + 1)) {
@@ -289,7 +289,7 @@ class ThreadsInternal {
 
       // This thread has completed inclusive scan
       // Set: ReductionAvailable -> ScanAvailable
-      m_pool_state = ThreadState::ScanAvailable;
+      set_thread_state(m_pool_state, ThreadState::ScanAvailable);
 
       // Wait for all threads to complete inclusive scan
       // Wait: ScanAvailable -> Rendezvous
@@ -303,7 +303,7 @@ class ThreadsInternal {
       // Wait: ReductionAvailable -> ScanAvailable
       spinwait_while_equal(fan.m_pool_state, ThreadState::ReductionAvailable);
       // Set: ScanAvailable -> Rendezvous
-      fan.m_pool_state = ThreadState::Rendezvous;
+      set_thread_state(fan.m_pool_state, ThreadState::Rendezvous);
     }
 
     // All threads have completed the inclusive scan.
@@ -335,13 +335,14 @@ class ThreadsInternal {
     }
     if (rev_rank) {
       // Set: ScanAvailable -> ScanCompleted
-      m_pool_state = ThreadState::ScanCompleted;
+      set_thread_state(m_pool_state, ThreadState::ScanCompleted);
       // Wait: ScanCompleted -> Active
       spinwait_while_equal(m_pool_state, ThreadState::ScanCompleted);
     }
     // Set: ScanCompleted -> Active
     for (int i = 0; i < m_pool_fan_size; ++i) {
-      m_pool_base[rev_rank + (1 << i)]->m_pool_state = ThreadState::Active;
+      set_thread_state(m_pool_base[rev_rank + (1 << i)]->m_pool_state,
+                       ThreadState::Active);
     }
   }
 
@@ -367,7 +368,7 @@ class ThreadsInternal {
     }
 
     if (rev_rank) {
-      m_pool_state = ThreadState::Rendezvous;
+      set_thread_state(m_pool_state, ThreadState::Rendezvous);
       // Wait: Rendezvous -> Active
       spinwait_while_equal(m_pool_state, ThreadState::Rendezvous);
     } else {
@@ -391,7 +392,8 @@ class ThreadsInternal {
     }
 
     for (int i = 0; i < m_pool_fan_size; ++i) {
-      m_pool_base[rev_rank + (1 << i)]->m_pool_state = ThreadState::Active;
+      set_thread_state(m_pool_base[rev_rank + (1 << i)]->m_pool_state,
+                       ThreadState::Active);
     }
   }
 
@@ -405,6 +407,7 @@ class ThreadsInternal {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
   KOKKOS_DEPRECATED static int in_parallel();
 #endif
+  static bool impl_in_parallel();
   static void fence();
   static void fence(const std::string &);
   static void internal_fence();
@@ -557,6 +560,9 @@ inline int Threads::impl_is_initialized() {
 }
 
 inline void Threads::impl_initialize(InitializationSettings const &settings) {
+  if (settings.has_threads_spin_budget()) {
+    Impl::set_spinwait_budget(settings.get_threads_spin_budget());
+  }
   Impl::ThreadsInternal::initialize(
       settings.has_num_threads() ? settings.get_num_threads() : -1);
 }
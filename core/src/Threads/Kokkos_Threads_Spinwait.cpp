@@ -24,6 +24,8 @@
 #include <Threads/Kokkos_Threads_Spinwait.hpp>
 #include <impl/Kokkos_BitOps.hpp>
 
+#include <atomic>
+#include <climits>
 #include <thread>
 #if defined(_WIN32)
 #include <process.h>
@@ -31,11 +33,55 @@
 #include <windows.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define KOKKOS_IMPL_THREADS_HAS_FUTEX
+#endif
+
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
 namespace Impl {
 
+namespace {
+
+// Spin before parking, 2^12 iterations take from tens to a few hundred
+// microseconds depending on the latency of 'pause'.
+std::atomic<int> s_spinwait_budget(1 << 12);
+
+#if defined(KOKKOS_IMPL_THREADS_HAS_FUTEX)
+
+static_assert(sizeof(ThreadState) == sizeof(int),
+              "ThreadState must be usable as a futex word");
+
+int* futex_word(ThreadStateFlag& flag) {
+  return const_cast<int*>(reinterpret_cast<int volatile*>(&flag.value));
+}
+
+void futex_wait(ThreadStateFlag& flag, ThreadState const value) {
+  syscall(SYS_futex, futex_word(flag), FUTEX_WAIT_PRIVATE,
+          static_cast<int>(value), nullptr, nullptr, 0);
+}
+
+void futex_wake(ThreadStateFlag& flag) {
+  syscall(SYS_futex, futex_word(flag), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+          nullptr, 0);
+}
+
+#endif
+
+}  // namespace
+
+int get_spinwait_budget() {
+  return s_spinwait_budget.load(std::memory_order_relaxed);
+}
+
+void set_spinwait_budget(const int budget) {
+  s_spinwait_budget.store(budget, std::memory_order_relaxed);
+}
+
 void host_thread_yield(const uint32_t i, const WaitMode mode) {
   static constexpr uint32_t sleep_limit = 1 << 13;
   static constexpr uint32_t yield_limit = 1 << 12;
@@ -108,15 +154,44 @@ void host_thread_yield(const uint32_t i, const WaitMode mode) {
 #endif /* defined( KOKKOS_ENABLE_ASM ) */
 }
 
-void spinwait_while_equal(ThreadState const volatile& flag,
-                          ThreadState const value) {
+void spinwait_while_equal(ThreadStateFlag& flag, ThreadState const value) {
   Kokkos::store_fence();
   uint32_t i = 0;
-  while (value == flag) {
+#if defined(KOKKOS_IMPL_THREADS_HAS_FUTEX)
+  const int budget = get_spinwait_budget();
+  if (0 <= budget) {
+    // Spin without yielding, then park until set_thread_state wakes us.
+    while (value == flag.value && i < static_cast<uint32_t>(budget)) {
+      host_thread_yield(++i, WaitMode::ROOT);
+    }
+    if (value == flag.value) {
+      flag.parked.fetch_add(1, std::memory_order_seq_cst);
+      while (value == flag.value) {
+        futex_wait(flag, value);
+      }
+      flag.parked.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+#endif
+  while (value == flag.value) {
     host_thread_yield(++i, WaitMode::ACTIVE);
   }
   Kokkos::load_fence();
 }
 
+void set_thread_state(ThreadStateFlag& flag, ThreadState const value) {
+  flag.value = value;
+#if defined(KOKKOS_IMPL_THREADS_HAS_FUTEX)
+  // Nobody parks with a negative budget.
+  if (get_spinwait_budget() < 0) return;
+  // Order the store before reading the parked count of the flag, pairs with
+  // the increment in spinwait_while_equal.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (0 < flag.parked.load(std::memory_order_relaxed)) {
+    futex_wake(flag);
+  }
+#endif
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
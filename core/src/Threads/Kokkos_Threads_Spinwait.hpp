@@ -34,8 +34,24 @@ enum class WaitMode : int {
 
 void host_thread_yield(const uint32_t i, const WaitMode mode);
 
-void spinwait_while_equal(ThreadState const volatile& flag,
-                          ThreadState const value);
+/** \brief  Wait while flag == value.
+ *
+ *  Spin for the spin budget, then park the thread until the flag is changed
+ *  through set_thread_state. Without futexes the thread escalates from
+ *  spinning to yielding and sleeping instead of parking.
+ */
+void spinwait_while_equal(ThreadStateFlag& flag, ThreadState const value);
+
+/** \brief  Set flag = value and wake the threads parked on flag. */
+void set_thread_state(ThreadStateFlag& flag, ThreadState const value);
+
+/** \brief  Number of spin iterations before a waiting thread parks.
+ *          A negative budget never parks. Set from the threads_spin_budget
+ *          initialization setting, a negative budget must not be set while
+ *          a thread is parked.
+ */
+int get_spinwait_budget();
+void set_spinwait_budget(const int budget);
 
 }  // namespace Impl
 }  // namespace Kokkos
@@ -17,6 +17,8 @@
 #ifndef KOKKOS_THREADS_STATE_HPP
 #define KOKKOS_THREADS_STATE_HPP
 
+#include <atomic>
+
 namespace Kokkos {
 namespace Impl {
 /** \brief States of a worker thread */
@@ -33,6 +35,17 @@ enum class ThreadState {
   ScanAvailable,
   ReductionAvailable
 };
+
+/** \brief State word of a worker thread with the number of threads parked on
+ *         it, so that set_thread_state only wakes the words waited on.
+ */
+struct ThreadStateFlag {
+  ThreadState volatile value;
+  std::atomic<int> parked;
+
+  explicit ThreadStateFlag(ThreadState const state)
+      : value(state), parked(0) {}
+};
 }  // namespace Impl
 }  // namespace Kokkos
 
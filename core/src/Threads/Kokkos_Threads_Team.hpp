@@ -90,7 +90,7 @@ class ThreadsExecTeamMember {
 
     // If not root then wait for release
     if (m_team_rank_rev) {
-      m_instance->state() = ThreadState::Rendezvous;
+      set_thread_state(m_instance->state(), ThreadState::Rendezvous);
       spinwait_while_equal(m_instance->state(), ThreadState::Rendezvous);
     }
 
@@ -102,7 +102,7 @@ class ThreadsExecTeamMember {
     for (n = 1;
          (!(m_team_rank_rev & n)) && ((j = m_team_rank_rev + n) < m_team_size);
          n <<= 1) {
-      m_team_base[j]->state() = ThreadState::Active;
+      set_thread_state(m_team_base[j]->state(), ThreadState::Active);
     }
   }
 
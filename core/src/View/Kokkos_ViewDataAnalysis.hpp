@@ -392,6 +392,15 @@ struct ViewDataAnalysis {
   using non_const_scalar_array_type = non_const_type;
 };
 
+/** \brief  Maps the multi-index of a View to the offset of its entry.
+ *
+ *  The stride_N() and stride_fill() members of the specializations describe
+ *  the addressing only if is_regular is true, in which case the offset of
+ *  (i0, i1, ...) is i0 * stride_0() + i1 * stride_1() + ... . Irregular
+ *  mappings such as LayoutTiled return the strides within a tile, so code
+ *  that derives addresses or contiguous runs from the strides, like the copy
+ *  fast paths, must reject them.
+ */
 template <class Dimension, class Layout, class Enable = void>
 struct ViewOffset {
   using is_mapping_plugin = std::false_type;
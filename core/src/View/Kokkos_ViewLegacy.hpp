@@ -1451,6 +1451,31 @@ KOKKOS_DEPRECATED KOKKOS_INLINE_FUNCTION auto subview(const View<D, P...>& src,
 template <class V, class... Args>
 using Subview = decltype(subview(std::declval<V>(), std::declval<Args>()...));
 
+namespace Experimental {
+
+/** \brief  View of one tile of a View with LayoutTiled.
+ *
+ *  The tile indices count tiles, not entries.  The returned View has the
+ *  static extents of a tile and the inner pattern of the layout as
+ *  LayoutLeft or LayoutRight, and it shares the allocation of src.
+ */
+template <class D, class... P, class... TileIndices>
+KOKKOS_INLINE_FUNCTION auto tile_subview(const View<D, P...>& src,
+                                         TileIndices... tile_indices) {
+  using array_layout = typename View<D, P...>::array_layout;
+  static_assert(is_layout_tiled_v<array_layout>,
+                "tile_subview requires a View with LayoutTiled");
+  static_assert(View<D, P...>::rank == sizeof...(TileIndices),
+                "tile_subview requires one tile index for each source View "
+                "rank");
+
+  return typename Kokkos::Impl::ViewMapping<
+      void, typename View<D, P...>::traits, array_layout,
+      TileIndices...>::type(src, array_layout(), tile_indices...);
+}
+
+}  // namespace Experimental
+
 } /* namespace Kokkos */
 
 //----------------------------------------------------------------------------
@@ -32,6 +32,7 @@
 #include <View/Kokkos_ViewTraits.hpp>
 #include <View/Kokkos_ViewCtor.hpp>
 #include <View/Kokkos_ViewAtomic.hpp>
+#include <View/Kokkos_ViewStreamingStore.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_StringManipulation.hpp>
 #include <impl/Kokkos_ZeroMemset_fwd.hpp>
@@ -2330,6 +2331,201 @@ struct ViewOffset<Dimension, Kokkos::LayoutStride, void> {
             stride(sub.range_index(6), rhs), stride(sub.range_index(7), rhs)) {}
 };
 
+//----------------------------------------------------------------------------
+// LayoutTiled : every tile is contiguous, partial tiles at the upper end of a
+// dimension are padded
+template <class Dimension, class Layout>
+struct ViewOffset<
+    Dimension, Layout,
+    std::enable_if_t<Kokkos::Experimental::is_layout_tiled_v<Layout>>> {
+  static_assert(Dimension::rank == Layout::rank,
+                "LayoutTiled requires a View of the same rank as its tiles");
+
+ private:
+  using tiled_offset = LayoutTiledOffset<Layout>;
+
+ public:
+  using is_mapping_plugin = std::true_type;
+  using is_regular        = std::false_type;
+
+  using size_type      = size_t;
+  using dimension_type = Dimension;
+  using array_layout   = Layout;
+
+  dimension_type m_dim;
+  // number of tiles along each dimension
+  size_type m_tile_N0;
+  size_type m_tile_N1;
+  size_type m_tile_N2;
+
+  //----------------------------------------
+
+  // rank 2
+  template <typename I0, typename I1>
+  KOKKOS_INLINE_FUNCTION constexpr size_type operator()(I0 const& i0,
+                                                        I1 const& i1) const {
+    return tiled_offset::offset(m_tile_N0, m_tile_N1, m_tile_N2, i0, i1, 0);
+  }
+
+  // rank 3
+  template <typename I0, typename I1, typename I2>
+  KOKKOS_INLINE_FUNCTION constexpr size_type operator()(I0 const& i0,
+                                                        I1 const& i1,
+                                                        I2 const& i2) const {
+    return tiled_offset::offset(m_tile_N0, m_tile_N1, m_tile_N2, i0, i1, i2);
+  }
+
+  //----------------------------------------
+
+  KOKKOS_INLINE_FUNCTION
+  constexpr array_layout layout() const {
+    constexpr auto r = dimension_type::rank;
+    return array_layout((r > 0 ? m_dim.N0 : KOKKOS_INVALID_INDEX),
+                        (r > 1 ? m_dim.N1 : KOKKOS_INVALID_INDEX),
+                        (r > 2 ? m_dim.N2 : KOKKOS_INVALID_INDEX),
+                        KOKKOS_INVALID_INDEX, KOKKOS_INVALID_INDEX,
+                        KOKKOS_INVALID_INDEX, KOKKOS_INVALID_INDEX,
+                        KOKKOS_INVALID_INDEX);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const {
+    return m_dim.N0;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const {
+    return m_dim.N1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const {
+    return m_dim.N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const {
+    return m_dim.N3;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const {
+    return m_dim.N4;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const {
+    return m_dim.N5;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const {
+    return m_dim.N6;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const {
+    return m_dim.N7;
+  }
+
+  /* Cardinality of the domain index space */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type size() const {
+    return size_type(m_dim.N0) * m_dim.N1 * m_dim.N2;
+  }
+
+  /* Span of the range space, including the padding of partial tiles */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type span() const {
+    return (m_tile_N0 * m_tile_N1 * m_tile_N2) << tiled_offset::shift_tile;
+  }
+
+  /* Contiguous unless partial tiles introduce padding */
+  KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    return span() == size();
+  }
+
+  /* Strides of dimensions between neighbouring entries of the same tile. They
+   * do not describe the addressing across tiles, see is_regular. */
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const {
+    return tiled_offset::inner_left ? 1 : size_type(Layout::N1) * Layout::N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const {
+    return tiled_offset::inner_left ? Layout::N0 : Layout::N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const {
+    return dimension_type::rank < 3 ? span()
+           : tiled_offset::inner_left
+               ? size_type(Layout::N0) * Layout::N1
+               : 1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const {
+    return span();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const {
+    return span();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const {
+    return span();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const {
+    return span();
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const {
+    return span();
+  }
+
+  // Fill the target unbounded array s with the stride.
+  // Preconditions: s must be an array of dimension_type::rank elements
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION iType stride_fill(iType* const s) const {
+    s[0] = stride_0();
+    s[1] = stride_1();
+    if constexpr (2 < dimension_type::rank) {
+      s[2] = stride_2();
+    }
+    return span();
+  }
+
+  // Fill the target unbounded array s with the stride and the total spanned
+  // size. Preconditions: s must be an array of dimension_type::rank + 1
+  // elements
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    s[dimension_type::rank] = stride_fill(s);
+  }
+
+  //----------------------------------------
+
+#ifdef KOKKOS_IMPL_WINDOWS_CUDA
+  KOKKOS_FUNCTION ViewOffset()
+      : m_dim(dimension_type()), m_tile_N0(0), m_tile_N1(0), m_tile_N2(0) {}
+  KOKKOS_FUNCTION ViewOffset(const ViewOffset& src) {
+    m_dim     = src.m_dim;
+    m_tile_N0 = src.m_tile_N0;
+    m_tile_N1 = src.m_tile_N1;
+    m_tile_N2 = src.m_tile_N2;
+  }
+  KOKKOS_FUNCTION ViewOffset& operator=(const ViewOffset& src) {
+    m_dim     = src.m_dim;
+    m_tile_N0 = src.m_tile_N0;
+    m_tile_N1 = src.m_tile_N1;
+    m_tile_N2 = src.m_tile_N2;
+    return *this;
+  }
+#else
+  ViewOffset()                             = default;
+  ViewOffset(const ViewOffset&)            = default;
+  ViewOffset& operator=(const ViewOffset&) = default;
+#endif
+
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION constexpr ViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const&,
+      array_layout const& arg_layout)
+      : m_dim(arg_layout.dimension[0], arg_layout.dimension[1],
+              arg_layout.dimension[2], 0, 0, 0, 0, 0),
+        m_tile_N0(tiled_offset::tile_count(0, m_dim.N0)),
+        m_tile_N1(tiled_offset::tile_count(1, m_dim.N1)),
+        m_tile_N2(tiled_offset::tile_count(2, m_dim.N2)) {}
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION constexpr ViewOffset(
+      const ViewOffset<DimRHS, array_layout, void>& rhs)
+      : m_dim(rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2, 0, 0, 0, 0, 0),
+        m_tile_N0(rhs.m_tile_N0),
+        m_tile_N1(rhs.m_tile_N1),
+        m_tile_N2(rhs.m_tile_N2) {
+    static_assert(int(DimRHS::rank) == int(dimension_type::rank),
+                  "ViewOffset assignment requires equal rank");
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -2371,6 +2567,38 @@ struct ViewDataHandle {
   }
 };
 
+// Stores to the non-const data of views with the StreamingStore trait go
+// through StreamingStoreDataElement, the trait takes precedence over Restrict
+// and Aligned but not over Atomic.
+template <class Traits>
+inline constexpr bool is_streaming_store_data_v =
+    std::is_same_v<typename Traits::non_const_value_type,
+                   typename Traits::value_type> &&
+    std::is_void_v<typename Traits::specialize> &&
+    Traits::memory_traits::is_streaming_store &&
+    !Traits::memory_traits::is_atomic;
+
+template <class Traits>
+struct ViewDataHandle<Traits,
+                      std::enable_if_t<is_streaming_store_data_v<Traits>>> {
+  using value_type  = typename Traits::value_type;
+  using handle_type = Kokkos::Impl::StreamingStoreViewDataHandle<Traits>;
+  using return_type = Kokkos::Impl::StreamingStoreDataElement<Traits>;
+  using track_type  = Kokkos::Impl::SharedAllocationTracker;
+
+  KOKKOS_INLINE_FUNCTION
+  static handle_type assign(value_type* arg_data_ptr,
+                            track_type const& /*arg_tracker*/) {
+    return handle_type(arg_data_ptr);
+  }
+
+  template <class SrcHandleType>
+  KOKKOS_INLINE_FUNCTION static handle_type assign(
+      const SrcHandleType& arg_handle, size_t offset) {
+    return handle_type(arg_handle + offset);
+  }
+};
+
 template <class Traits>
 struct ViewDataHandle<
     Traits,
@@ -2401,7 +2629,8 @@ struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               (!Traits::memory_traits::is_aligned) &&
                               Traits::memory_traits::is_restrict &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!is_streaming_store_data_v<Traits>))>> {
   using value_type  = typename Traits::value_type;
   using handle_type = typename Traits::value_type* KOKKOS_RESTRICT;
   using return_type = typename Traits::value_type& KOKKOS_RESTRICT;
@@ -2424,7 +2653,8 @@ struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               Traits::memory_traits::is_aligned &&
                               (!Traits::memory_traits::is_restrict) &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!is_streaming_store_data_v<Traits>))>> {
   using value_type = typename Traits::value_type;
   // typedef work-around for intel compilers error #3186: expected typedef
   // declaration
@@ -2462,7 +2692,8 @@ struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               Traits::memory_traits::is_aligned &&
                               Traits::memory_traits::is_restrict &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!is_streaming_store_data_v<Traits>))>> {
   using value_type = typename Traits::value_type;
   // typedef work-around for intel compilers error #3186: expected typedef
   // declaration
@@ -3333,6 +3564,65 @@ class ViewMapping<
   }
 };
 
+//----------------------------------------------------------------------------
+// One tile of a LayoutTiled View, selected by the layout as first argument
+// followed by the tile indices.  The tile is a View of static extents with the
+// inner pattern of the layout which shares the allocation of the source.
+
+template <class SrcTraits, class Layout, class... TileIndices>
+class ViewMapping<
+    std::enable_if_t<(
+        std::is_void_v<typename SrcTraits::specialize> &&
+        std::is_same_v<typename SrcTraits::array_layout, Layout> &&
+        Kokkos::Experimental::is_layout_tiled_v<Layout> &&
+        Layout::rank == sizeof...(TileIndices) &&
+        (std::is_integral_v<TileIndices> && ...))>,
+    SrcTraits, Layout, TileIndices...> {
+ private:
+  using value_type = typename SrcTraits::value_type;
+
+ public:
+  using array_layout =
+      std::conditional_t<Layout::inner_pattern == Kokkos::Iterate::Left,
+                         Kokkos::LayoutLeft, Kokkos::LayoutRight>;
+
+  using data_type =
+      std::conditional_t<Layout::rank == 2, value_type[Layout::N0][Layout::N1],
+                         value_type[Layout::N0][Layout::N1][Layout::N2]>;
+
+  using traits_type =
+      Kokkos::ViewTraits<data_type, array_layout,
+                         typename SrcTraits::device_type,
+                         typename SrcTraits::memory_traits>;
+
+  using type =
+      Kokkos::View<data_type, array_layout, typename SrcTraits::device_type,
+                   typename SrcTraits::memory_traits>;
+
+  template <class DstTraits>
+  KOKKOS_INLINE_FUNCTION static void assign(
+      ViewMapping<DstTraits, void>& dst,
+      ViewMapping<SrcTraits, void> const& src, Layout const&,
+      TileIndices... tile_indices) {
+    static_assert(ViewMapping<DstTraits, traits_type, void>::is_assignable,
+                  "Tile subview destination type must be compatible with "
+                  "tile subview derived type");
+
+    using tiled_offset = LayoutTiledOffset<Layout>;
+    size_t const tile[3] = {static_cast<size_t>(tile_indices)...};
+
+    dst.m_impl_offset = typename ViewMapping<DstTraits, void>::offset_type();
+    dst.m_impl_handle = ViewDataHandle<DstTraits>::assign(
+        src.m_impl_handle,
+        tiled_offset::offset(src.m_impl_offset.m_tile_N0,
+                             src.m_impl_offset.m_tile_N1,
+                             src.m_impl_offset.m_tile_N2,
+                             tile[0] << tiled_offset::shift_0,
+                             tile[1] << tiled_offset::shift_1,
+                             tile[2] << tiled_offset::shift_2));
+  }
+};
+
 //----------------------------------------------------------------------------
 
 }  // namespace Impl
@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef KOKKOS_VIEWSTREAMINGSTORE_HPP
+#define KOKKOS_VIEWSTREAMINGSTORE_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+// Non-temporal stores on x86 write around the caches through the write
+// combining buffers, without reading the cache line for ownership first.
+// They are weakly ordered and only drained by an sfence or a locked
+// instruction of the thread that issued them, see streaming_store_fence in
+// impl/Kokkos_StreamingStoreFence.hpp. Values of other sizes and other
+// architectures use plain stores, unless clang provides a non-temporal store
+// for the target.
+template <class T>
+KOKKOS_IMPL_HOST_FUNCTION inline void streaming_store_host(T* ptr,
+                                                           const T& value) {
+#if defined(__SSE2__)
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) == sizeof(int) &&
+                alignof(T) == alignof(int)) {
+    int bits;
+    std::memcpy(&bits, &value, sizeof(int));
+    _mm_stream_si32(reinterpret_cast<int*>(ptr), bits);
+  }
+#if defined(__x86_64__)
+  else if constexpr (std::is_trivially_copyable_v<T> &&
+                     sizeof(T) == sizeof(long long) &&
+                     alignof(T) == alignof(long long)) {
+    long long bits;
+    std::memcpy(&bits, &value, sizeof(long long));
+    _mm_stream_si64(reinterpret_cast<long long*>(ptr), bits);
+  }
+#endif
+  else {
+    *ptr = value;
+  }
+#elif defined(__clang__)
+  if constexpr (std::is_arithmetic_v<T>) {
+    __builtin_nontemporal_store(value, ptr);
+  } else {
+    *ptr = value;
+  }
+#else
+  *ptr = value;
+#endif
+}
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void streaming_store(T* ptr, const T& value) {
+  KOKKOS_IF_ON_HOST((streaming_store_host(ptr, value);))
+  KOKKOS_IF_ON_DEVICE((*ptr = value;))
+}
+
+template <class ViewTraits>
+class StreamingStoreDataElement {
+ public:
+  using value_type       = typename ViewTraits::value_type;
+  using const_value_type = typename ViewTraits::const_value_type;
+  value_type* const ptr;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit StreamingStoreDataElement(value_type* ptr_) : ptr(ptr_) {}
+
+  KOKKOS_DEFAULTED_FUNCTION
+  StreamingStoreDataElement(const StreamingStoreDataElement&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator=(const_value_type& val) const {
+    streaming_store(ptr, val);
+    return val;
+  }
+
+  // assignments between the elements of two views with the trait
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator=(const StreamingStoreDataElement& other) const {
+    const_value_type val = *other.ptr;
+    streaming_store(ptr, val);
+    return val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator+=(const_value_type& val) const {
+    return *this = *ptr + val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator-=(const_value_type& val) const {
+    return *this = *ptr - val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator*=(const_value_type& val) const {
+    return *this = *ptr * val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator/=(const_value_type& val) const {
+    return *this = *ptr / val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  operator value_type() const { return *ptr; }
+};
+
+template <class ViewTraits>
+class StreamingStoreViewDataHandle {
+ public:
+  typename ViewTraits::value_type* ptr;
+
+  KOKKOS_INLINE_FUNCTION
+  StreamingStoreViewDataHandle() : ptr(nullptr) {}
+
+  KOKKOS_INLINE_FUNCTION
+  StreamingStoreViewDataHandle(typename ViewTraits::value_type* ptr_)
+      : ptr(ptr_) {}
+
+  template <class iType>
+  KOKKOS_INLINE_FUNCTION StreamingStoreDataElement<ViewTraits> operator[](
+      const iType& i) const {
+    return StreamingStoreDataElement<ViewTraits>(ptr + i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  operator typename ViewTraits::value_type *() const { return ptr; }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -25,6 +25,103 @@ static_assert(false,
 #include "Kokkos_MDSpan_Extents.hpp"
 #include <View/Kokkos_ViewDataAnalysis.hpp>
 
+namespace Kokkos::Experimental {
+
+// mdspan layout policy equivalent to LayoutTiled
+template <Kokkos::Iterate OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2 = 0>
+struct layout_tiled {
+  template <class Extents>
+  class mapping {
+   public:
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_tiled;
+
+   private:
+    using array_layout = LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>;
+    using tiled_offset = Kokkos::Impl::LayoutTiledOffset<array_layout>;
+
+    static_assert(extents_type::rank() == array_layout::rank,
+                  "layout_tiled requires extents of the same rank as its "
+                  "tiles");
+
+    extents_type m_extents;
+
+    KOKKOS_INLINE_FUNCTION constexpr size_t tile_count(rank_type r) const {
+      return r < extents_type::rank()
+                 ? tiled_offset::tile_count(r, m_extents.extent(r))
+                 : 1;
+    }
+
+   public:
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping() noexcept = default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping(const mapping&) noexcept =
+        default;
+    KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(
+        const mapping&) noexcept = default;
+
+    KOKKOS_INLINE_FUNCTION constexpr mapping(
+        const extents_type& ext) noexcept
+        : m_extents(ext) {}
+
+    KOKKOS_INLINE_FUNCTION constexpr const extents_type& extents()
+        const noexcept {
+      return m_extents;
+    }
+
+    KOKKOS_INLINE_FUNCTION constexpr index_type required_span_size()
+        const noexcept {
+      return static_cast<index_type>(
+          (tile_count(0) * tile_count(1) * tile_count(2))
+          << tiled_offset::shift_tile);
+    }
+
+    template <class... Indices>
+    KOKKOS_INLINE_FUNCTION constexpr index_type operator()(
+        Indices... idx) const noexcept {
+      static_assert(sizeof...(Indices) == extents_type::rank());
+      size_t const i[3] = {static_cast<size_t>(idx)...};
+      return static_cast<index_type>(
+          tiled_offset::offset(tile_count(0), tile_count(1), tile_count(2),
+                               i[0], i[1], i[2]));
+    }
+
+    KOKKOS_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept {
+      return true;
+    }
+    KOKKOS_INLINE_FUNCTION static constexpr bool
+    is_always_exhaustive() noexcept {
+      return false;
+    }
+    KOKKOS_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+      return false;
+    }
+
+    KOKKOS_INLINE_FUNCTION static constexpr bool is_unique() noexcept {
+      return true;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+      size_t size = 1;
+      for (rank_type r = 0; r < extents_type::rank(); ++r)
+        size *= m_extents.extent(r);
+      return static_cast<size_t>(required_span_size()) == size;
+    }
+    KOKKOS_INLINE_FUNCTION static constexpr bool is_strided() noexcept {
+      return false;
+    }
+
+    KOKKOS_INLINE_FUNCTION friend constexpr bool operator==(
+        const mapping& lhs, const mapping& rhs) noexcept {
+      return lhs.extents() == rhs.extents();
+    }
+  };
+};
+
+}  // namespace Kokkos::Experimental
+
 // The difference between a legacy Kokkos array layout and an
 // mdspan layout is that the array layouts can have state, but don't have the
 // nested mapping. This file provides interoperability helpers.
@@ -49,6 +146,14 @@ struct LayoutFromArrayLayout<Kokkos::LayoutStride> {
   using type = layout_stride;
 };
 
+template <Kokkos::Iterate OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2>
+struct LayoutFromArrayLayout<
+    Kokkos::Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>> {
+  using type =
+      Kokkos::Experimental::layout_tiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>;
+};
+
 template <class ArrayLayout, class MDSpanType>
 KOKKOS_INLINE_FUNCTION auto array_layout_from_mapping(
     const typename MDSpanType::mapping_type &mapping) {
@@ -123,7 +228,8 @@ KOKKOS_INLINE_FUNCTION auto mapping_from_array_layout_impl(
   if constexpr (std::is_same_v<typename MappingType::layout_type,
                                layout_left> ||
                 std::is_same_v<typename MappingType::layout_type,
-                               layout_right>) {
+                               layout_right> ||
+                Kokkos::Experimental::is_layout_tiled_v<ArrayLayout>) {
     return MappingType{
         extents_type{dextents<index_type, MappingType::extents_type::rank()>{
             layout.dimension[Idx]...}}};
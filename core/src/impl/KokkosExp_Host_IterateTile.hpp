@@ -29,7 +29,12 @@
 #define KOKKOS_ENABLE_IVDEP_MDRANGE
 #endif
 
+#include <Kokkos_BitManipulation.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <Kokkos_Layout.hpp>
+
 #include <algorithm>
+#include <cstdint>
 
 namespace Kokkos {
 namespace Impl {
@@ -1609,6 +1614,68 @@ struct Tile_Loop_Type<8, IsLeft, IType, Tagged,
 };
 // end Structs for calling loops
 
+// Tiles are traversed along a Morton (Z-order) curve if the policy carries the
+// HintTileLocality work item property.  Host backends then hand out contiguous
+// segments of the curve to the threads so that each thread works on a compact
+// block of neighboring tiles, and on the same block in every launch.
+template <typename RP>
+inline constexpr bool host_iterate_tile_morton_order =
+    (typename RP::work_item_property() &
+     Kokkos::Experimental::WorkItemProperty::HintTileLocality) ==
+    Kokkos::Experimental::WorkItemProperty::HintTileLocality;
+
+// Computes the offset of the tile at position tile_idx along the Morton curve
+// over the tile grid of rp.  The coordinate bits are only interleaved while a
+// dimension has bits left, and the position is resolved by counting the tiles
+// in the lower half of the remaining subdomain for each bit, so tiles outside
+// of the (non power of two) tile grid are never enumerated.
+template <typename RP, typename IType>
+inline void morton_tile_offset(RP const& rp, IType tile_idx,
+                               typename RP::point_type& offset) {
+  constexpr int rank = RP::rank;
+
+  uint64_t pos = static_cast<uint64_t>(tile_idx);
+  uint64_t coord[rank];
+  int num_bits[rank];
+  int free_bits[rank];
+  int max_bits = 0;
+
+  for (int i = 0; i < rank; ++i) {
+    coord[i]     = 0;
+    num_bits[i]  = Kokkos::bit_width(static_cast<uint64_t>(rp.m_tile_end[i]) -
+                                     uint64_t(1));
+    free_bits[i] = num_bits[i];
+    max_bits     = std::max(max_bits, num_bits[i]);
+  }
+
+  for (int level = max_bits - 1; level >= 0; --level) {
+    // The fastest index of the outer iteration direction gets the lowest bit
+    // of each level.
+    for (int n = 0; n < rank; ++n) {
+      const int i = (RP::outer_direction == Iterate::Left) ? rank - 1 - n : n;
+      if (level >= num_bits[i]) continue;
+      free_bits[i] = level;
+
+      uint64_t lower_half_tiles = 1;
+      for (int j = 0; j < rank; ++j) {
+        const uint64_t width  = uint64_t(1) << free_bits[j];
+        const uint64_t extent =
+            static_cast<uint64_t>(rp.m_tile_end[j]) - coord[j];
+        lower_half_tiles *= std::min(extent, width);
+      }
+      if (pos >= lower_half_tiles) {
+        pos -= lower_half_tiles;
+        coord[i] += uint64_t(1) << level;
+      }
+    }
+  }
+
+  for (int i = 0; i < rank; ++i) {
+    offset[i] = static_cast<typename RP::index_type>(coord[i]) * rp.m_tile[i] +
+                rp.m_lower[i];
+  }
+}
+
 template <typename RP, typename Functor, typename Tag = void,
           typename ValueType = void, typename Enable = void>
 struct HostIterateTile;
@@ -1658,7 +1725,9 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if constexpr (host_iterate_tile_morton_order<RP>) {
+      morton_tile_offset(m_rp, tile_idx, m_offset);
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
@@ -2070,7 +2139,9 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if constexpr (host_iterate_tile_morton_order<RP>) {
+      morton_tile_offset(m_rp, tile_idx, m_offset);
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
@@ -2482,7 +2553,9 @@ struct HostIterateTile<RP, Functor, Tag, ValueType,
     point_type m_offset;
     point_type m_tiledims;
 
-    if (RP::outer_direction == Iterate::Left) {
+    if constexpr (host_iterate_tile_morton_order<RP>) {
+      morton_tile_offset(m_rp, tile_idx, m_offset);
+    } else if (RP::outer_direction == Iterate::Left) {
       for (int i = 0; i < RP::rank; ++i) {
         m_offset[i] =
             (tile_idx % m_rp.m_tile_end[i]) * m_rp.m_tile[i] + m_rp.m_lower[i];
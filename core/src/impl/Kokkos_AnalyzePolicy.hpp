@@ -28,6 +28,7 @@
 #include <traits/Kokkos_IterationPatternTrait.hpp>
 #include <traits/Kokkos_LaunchBoundsTrait.hpp>
 #include <traits/Kokkos_OccupancyControlTrait.hpp>
+#include <traits/Kokkos_PrefetchDistanceTrait.hpp>
 #include <traits/Kokkos_ScheduleTrait.hpp>
 #include <traits/Kokkos_WorkItemPropertyTrait.hpp>
 #include <traits/Kokkos_WorkTagTrait.hpp>
@@ -18,6 +18,7 @@
 #define KOKKOS_IMPL_PUBLIC_INCLUDE
 #endif
 
+#include <Kokkos_Macros.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
 
 #include <cstdlib>  // getenv
@@ -56,3 +57,48 @@ int Kokkos::Impl::mpi_local_rank_on_node() {
 }
 
 bool Kokkos::Impl::mpi_detected() { return mpi_local_rank_on_node() != -1; }
+
+namespace {
+
+Kokkos::Impl::HostSimdIsa detect_host_simd_isa() {
+  using Kokkos::Impl::HostSimdIsa;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  // besides the vector instructions used by the ABIs, the kernels for them
+  // are compiled with the scalar extensions every processor of that
+  // generation has (see example/simd_dispatch)
+  __builtin_cpu_init();
+  bool const has_avx2 =
+      __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+      __builtin_cpu_supports("f16c") && __builtin_cpu_supports("bmi") &&
+      __builtin_cpu_supports("bmi2");
+  bool const has_avx512 =
+      has_avx2 && __builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512vl") &&
+      __builtin_cpu_supports("avx512dq") &&
+      __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512cd");
+  if (has_avx512) return HostSimdIsa::avx512;
+  if (has_avx2) return HostSimdIsa::avx2;
+  return HostSimdIsa::scalar;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  // Advanced SIMD is part of every AArch64 processor
+  return HostSimdIsa::neon;
+#else
+  // without a way to query the processor, trust the configured architecture
+#if defined(KOKKOS_ARCH_AVX512XEON)
+  return HostSimdIsa::avx512;
+#elif defined(KOKKOS_ARCH_AVX2)
+  return HostSimdIsa::avx2;
+#elif defined(KOKKOS_ARCH_ARM_NEON)
+  return HostSimdIsa::neon;
+#else
+  return HostSimdIsa::scalar;
+#endif
+#endif
+}
+
+}  // namespace
+
+Kokkos::Impl::HostSimdIsa Kokkos::Impl::host_simd_isa() {
+  static HostSimdIsa const isa = detect_host_simd_isa();
+  return isa;
+}
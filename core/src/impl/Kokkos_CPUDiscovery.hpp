@@ -13,6 +13,10 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+
+#ifndef KOKKOS_IMPL_CPUDISCOVERY_HPP
+#define KOKKOS_IMPL_CPUDISCOVERY_HPP
+
 namespace Kokkos {
 namespace Impl {
 
@@ -21,5 +25,14 @@ int mpi_local_rank_on_node();
 // returns true if MPI execution environment is detected, false otherwise.
 bool mpi_detected();
 
+// Instruction sets of the host simd ABIs
+enum class HostSimdIsa { scalar, avx2, avx512, neon };
+
+// returns the widest of them supported by the processor the program runs on,
+// independently of the architecture Kokkos was configured for.
+HostSimdIsa host_simd_isa();
+
 }  // namespace Impl
 }  // namespace Kokkos
+
+#endif
@@ -532,7 +532,7 @@ KOKKOS_INLINE_FUNCTION void parallel_reduce_combined_reducers_impl(
 // rvalue references)
 template <class PolicyType, class Functor, class ReturnType1, class ReturnType2,
           class... ReturnTypes>
-auto parallel_reduce(std::string const& label, PolicyType const& policy,
+auto parallel_reduce(std::string_view label, PolicyType const& policy,
                      Functor const& functor, ReturnType1&& returnType1,
                      ReturnType2&& returnType2,
                      ReturnTypes&&... returnTypes) noexcept
@@ -597,7 +597,7 @@ auto parallel_reduce(PolicyType const& policy, Functor const& functor,
 
 template <class Functor, class ReturnType1, class ReturnType2,
           class... ReturnTypes>
-void parallel_reduce(std::string const& label, size_t n, Functor const& functor,
+void parallel_reduce(std::string_view label, size_t n, Functor const& functor,
                      ReturnType1&& returnType1, ReturnType2&& returnType2,
                      ReturnTypes&&... returnTypes) noexcept {
   Kokkos::parallel_reduce(label,
@@ -25,6 +25,7 @@
 #include <impl/Kokkos_DeviceManagement.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
 
 #include <algorithm>
 #include <cctype>
@@ -93,6 +94,8 @@ void combine(Kokkos::InitializationSettings& out,
   KOKKOS_IMPL_COMBINE_SETTING(disable_warnings);
   KOKKOS_IMPL_COMBINE_SETTING(print_configuration);
   KOKKOS_IMPL_COMBINE_SETTING(tune_internals);
+  KOKKOS_IMPL_COMBINE_SETTING(host_barrier);
+  KOKKOS_IMPL_COMBINE_SETTING(threads_spin_budget);
   KOKKOS_IMPL_COMBINE_SETTING(tools_help);
   KOKKOS_IMPL_COMBINE_SETTING(tools_libs);
   KOKKOS_IMPL_COMBINE_SETTING(tools_args);
@@ -166,6 +169,12 @@ bool is_valid_map_device_id_by(std::string const& x) {
   return x == "mpi_rank" || x == "random";
 }
 
+bool is_valid_host_barrier(std::string const& x) {
+  return x == "auto" || x == "centralized" || x == "tree";
+}
+
+bool is_valid_threads_spin_budget(int x) { return x >= -1; }
+
 }  // namespace
 
 std::vector<int> const& Kokkos::Impl::get_visible_devices() {
@@ -491,6 +500,22 @@ void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
     g_show_warnings = false;
   if (settings.has_tune_internals() && settings.get_tune_internals())
     g_tune_internals = true;
+  if (settings.has_host_barrier()) {
+    if (!is_valid_host_barrier(settings.get_host_barrier())) {
+      std::stringstream ss;
+      ss << "Error: host_barrier setting '" << settings.get_host_barrier()
+         << "' is not recognized."
+         << " Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    const std::string& host_barrier = settings.get_host_barrier();
+    Kokkos::Impl::HostThreadTeamData::set_pool_barrier(
+        host_barrier == "tree"
+            ? Kokkos::Impl::HostPoolBarrier::tree
+            : host_barrier == "centralized"
+                  ? Kokkos::Impl::HostPoolBarrier::centralized
+                  : Kokkos::Impl::HostPoolBarrier::automatic);
+  }
   declare_configuration_metadata("version_info", "Kokkos Version",
                                  version_string_from_int(KOKKOS_VERSION));
 #ifdef KOKKOS_COMPILER_APPLECC
@@ -845,6 +870,18 @@ Kokkos Core Options:
                                                assignment of local MPI ranks.
                                                Works with OpenMPI, MVAPICH, SLURM, and
                                                derived implementations.
+  --kokkos-host-barrier=(auto|centralized|tree)
+                                 : algorithm of the barrier across all the threads
+                                   of a host parallel region.
+                                   - centralized: all threads share one counter.
+                                   - tree:        combining tree, scales to
+                                                  large thread counts.
+                                   - auto:        tree for more than 64 threads
+                                                  (default).
+  --kokkos-threads-spin-budget=INT
+                                 : number of spin iterations of idle Threads
+                                   backend workers before they sleep until the
+                                   next kernel, -1 never sleeps (default 4096).
 
 Kokkos Tools Options:
   --kokkos-tools-libs=STR        : Specify which of the tools to use. Must either
@@ -885,6 +922,8 @@ void Kokkos::Impl::parse_command_line_arguments(
   int num_threads;
   int device_id;
   std::string map_device_id_by;
+  std::string host_barrier;
+  int threads_spin_budget;
   bool disable_warnings;
   bool print_configuration;
   bool tune_internals;
@@ -942,6 +981,28 @@ void Kokkos::Impl::parse_command_line_arguments(
       }
       settings.set_map_device_id_by(map_device_id_by);
       remove_flag = true;
+    } else if (check_arg_str(argv[iarg], "--kokkos-host-barrier",
+                             host_barrier)) {
+      if (!is_valid_host_barrier(host_barrier)) {
+        std::stringstream ss;
+        ss << "Error: command line argument '--kokkos-host-barrier="
+           << host_barrier << "' is not recognized."
+           << " Raised by Kokkos::initialize().\n";
+        Kokkos::abort(ss.str().c_str());
+      }
+      settings.set_host_barrier(host_barrier);
+      remove_flag = true;
+    } else if (check_arg_int(argv[iarg], "--kokkos-threads-spin-budget",
+                             threads_spin_budget)) {
+      if (!is_valid_threads_spin_budget(threads_spin_budget)) {
+        std::stringstream ss;
+        ss << "Error: command line argument '" << argv[iarg] << "' is invalid."
+           << " The spin budget must be greater than or equal to minus one."
+           << " Raised by Kokkos::initialize().\n";
+        Kokkos::abort(ss.str().c_str());
+      }
+      settings.set_threads_spin_budget(threads_spin_budget);
+      remove_flag = true;
     } else if (std::regex_match(argv[iarg],
                                 std::regex("-?-kokkos.*", std::regex::egrep))) {
       warn_not_recognized_command_line_argument(argv[iarg]);
@@ -1035,6 +1096,29 @@ void Kokkos::Impl::parse_environment_variables(
     }
     settings.set_map_device_id_by(map_device_id_by);
   }
+  char const* host_barrier = std::getenv("KOKKOS_HOST_BARRIER");
+  if (host_barrier != nullptr) {
+    if (!is_valid_host_barrier(host_barrier)) {
+      std::stringstream ss;
+      ss << "Error: environment variable 'KOKKOS_HOST_BARRIER="
+         << host_barrier << "' is not recognized."
+         << " Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    settings.set_host_barrier(host_barrier);
+  }
+  int threads_spin_budget;
+  if (check_env_int("KOKKOS_THREADS_SPIN_BUDGET", threads_spin_budget)) {
+    if (!is_valid_threads_spin_budget(threads_spin_budget)) {
+      std::stringstream ss;
+      ss << "Error: environment variable 'KOKKOS_THREADS_SPIN_BUDGET="
+         << threads_spin_budget << "' is invalid."
+         << " The spin budget must be greater than or equal to minus one."
+         << " Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    settings.set_threads_spin_budget(threads_spin_budget);
+  }
 }
 
 //----------------------------------------------------------------------------
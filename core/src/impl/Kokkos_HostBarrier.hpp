@@ -217,12 +217,119 @@ class HostBarrier {
   static void impl_backoff_wait_until_equal(int* ptr, const int v,
                                             const bool active_wait) noexcept;
 
+  friend class HostTreeBarrier;
+
  private:
   int m_size{0};
   mutable int m_step{0};
   int* m_buffer{nullptr};
 };
 
+// algorithm of the barrier shared by all the threads of a host pool
+// - centralized: HostBarrier, every thread arrives on the same counter
+// - tree: HostTreeBarrier, threads arrive on the nodes of a combining tree
+// - automatic: the tree for pools of more than tree_min_pool_size threads
+enum class HostPoolBarrier { automatic, centralized, tree };
+
+// class HostTreeBarrier
+//
+// provides a static interface for a combining tree barrier between the
+// *size* threads of execution of ranks [0, size)
+//
+// With HostBarrier, all the threads increment the same counter and spin on
+// the same flag, the cache line holding them serializes the arrivals of
+// large pools. Here, every thread owns a node, i.e. a buffer of
+// required_buffer_size bytes returned by node(rank), and only exchanges with
+// its parent and children in the tree:
+//
+// - at level l the ranks are grouped by fan_in consecutive multiples of
+//   fan_in^l, the lowest rank of each group is the parent of the others.
+//   Pool ranks being ordered "close", the lower levels combine the threads
+//   of a core and then of a NUMA region before crossing to another one.
+// - a thread arrives once its children have arrived, by setting its slot in
+//   the node of its parent to step,
+// - rank 0 is the root: all the threads have arrived when arrive returns
+//   true on it,
+// - the root calls release, which wakes up its children, who wake up their
+//   own children before returning from arrive.
+//
+// the nodes and step must have been initialized to 0, as for HostBarrier
+class HostTreeBarrier {
+ public:
+  static constexpr int fan_in = 4;
+  // pools up to this size use the centralized barrier with
+  // HostPoolBarrier::automatic
+  static constexpr int tree_min_pool_size = 64;
+
+ private:
+  // the arrival slots of the children are written by the children only and
+  // the release flag by the parent only, keep them 64 bytes apart
+  static constexpr int num_arrive_slots = 64 / sizeof(int);
+  static constexpr int release_idx      = 64 / sizeof(int);
+
+  static_assert(HostBarrier::required_buffer_size >= 2 * 64);
+
+ public:
+  // returns true on the root once all the threads have arrived, the other
+  // threads return false once the root has called release
+  template <class NodeFunctor>
+  static bool arrive(const NodeFunctor& node, const int rank, const int size,
+                     int& step) noexcept {
+    if (size <= 1) return true;
+
+    ++step;
+    int* const self = node(rank);
+    int level       = 0;
+    for (int stride = 1; stride < size; stride *= fan_in, ++level) {
+      const int group = stride * fan_in;
+      if (rank % group != 0) {
+        // every child has arrived, arrive at the parent and wait for it
+        const int parent = rank - rank % group;
+        const int slot   = arrive_slot(level, (rank - parent) / stride);
+        Kokkos::memory_fence();
+        Kokkos::atomic_store(node(parent) + slot, step);
+        HostBarrier::impl_wait_until_equal_host(self + release_idx, step);
+        release(node, rank, size, step);
+        return false;
+      }
+      for (int j = 1; j < fan_in && rank + j * stride < size; ++j) {
+        HostBarrier::impl_wait_until_equal_host(self + arrive_slot(level, j),
+                                                step);
+      }
+    }
+    return true;
+  }
+
+  // wake up the children of rank, only the root may call it
+  template <class NodeFunctor>
+  static void release(const NodeFunctor& node, const int rank, const int size,
+                      const int step) noexcept {
+    if (size <= 1) return;
+
+    // stride of the highest level at which rank is a parent, the levels are
+    // released from the top so that the largest subtrees start waking up
+    // first
+    int stride = 0;
+    for (int s = 1; s < size && rank % (s * fan_in) == 0; s *= fan_in) {
+      stride = s;
+    }
+    Kokkos::memory_fence();
+    for (; stride > 0; stride /= fan_in) {
+      for (int j = 1; j < fan_in && rank + j * stride < size; ++j) {
+        Kokkos::atomic_store(node(rank + j * stride) + release_idx, step);
+      }
+    }
+  }
+
+ private:
+  static constexpr int arrive_slot(const int level, const int child) {
+    return level * (fan_in - 1) + child - 1;
+  }
+
+  // 1024 threads, the largest host pool, need 5 levels
+  static_assert(5 * (fan_in - 1) <= num_arrive_slots);
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -27,12 +27,9 @@ namespace Impl {
 template <>
 struct ZeroMemset<HostSpace::execution_space> {
   ZeroMemset(const HostSpace::execution_space& exec, void* dst, size_t cnt) {
-    // Host spaces, except for HPX, are synchronous and we need to fence for HPX
-    // since we can't properly enqueue a std::memset otherwise.
-    // We can't use exec.fence() directly since we don't have a full definition
-    // of HostSpace here.
-    hostspace_fence(exec);
-    std::memset(dst, 0, cnt);
+    // We can't launch a parallel_for directly since we don't have a full
+    // definition of HostSpace here.
+    hostspace_parallel_zero_memset(exec, dst, cnt);
   }
 };
 
@@ -34,6 +34,61 @@ void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n) {
   hostspace_parallel_deepcopy_async(exec, dst, src, n);
 }
 
+// Whether the calling thread runs inside a parallel region of one of the host
+// backends.
+static bool hostspace_in_parallel_region() {
+#ifdef KOKKOS_ENABLE_OPENMP
+  if (omp_in_parallel()) return true;
+#endif
+#ifdef KOKKOS_ENABLE_THREADS
+  if (ThreadsInternal::impl_in_parallel()) return true;
+#endif
+#ifdef KOKKOS_ENABLE_HPX
+  if (Kokkos::Experimental::HPX::impl_get_in_parallel()) return true;
+#endif
+  return false;
+}
+
+void hostspace_parallel_zero_memset(const DefaultHostExecutionSpace& exec,
+                                    void* dst, size_t n) {
+  // Inside a parallel region the instance is busy with the enclosing kernel,
+  // neither fence it nor launch another kernel on it.
+  if (hostspace_in_parallel_region()) {
+    std::memset(dst, 0, n);
+    return;
+  }
+
+  // If the asynchronous HPX backend is enabled, do *not* zero anything
+  // synchronously, see hostspace_parallel_deepcopy_async.
+#if !(defined(KOKKOS_ENABLE_HPX) && \
+      defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH))
+  constexpr size_t host_zero_memset_serial_limit = 10 * 8192;
+  if ((n < host_zero_memset_serial_limit) || (exec.concurrency() == 1)) {
+    hostspace_fence(exec);
+    std::memset(dst, 0, n);
+    return;
+  }
+#endif
+
+  // Zero page-sized chunks with the static partitioning RangePolicy kernels
+  // use, so that every page is first touched, and hence placed on the NUMA
+  // node of, the thread that processes it in a later kernel over the same
+  // data. The callers, View initialization and deep_copy, already report the
+  // memset to the tools, so the kernel is launched without the callbacks.
+  constexpr size_t chunk_size = 4096;
+  char* dst_c                 = static_cast<char*>(dst);
+
+  auto const zero_chunk = [=](const int64_t i) {
+    size_t const begin = i * chunk_size;
+    std::memset(dst_c + begin, 0, std::min(chunk_size, n - begin));
+  };
+  using policy_t = Kokkos::RangePolicy<DefaultHostExecutionSpace,
+                                       Kokkos::IndexType<int64_t>>;
+  const Impl::ParallelFor<decltype(zero_chunk), policy_t> closure(
+      zero_chunk, policy_t(exec, 0, (n + chunk_size - 1) / chunk_size));
+  closure.execute();
+}
+
 // DeepCopy called with an execution space that can't access HostSpace
 void hostspace_parallel_deepcopy_async(void* dst, const void* src,
                                        ptrdiff_t n) {
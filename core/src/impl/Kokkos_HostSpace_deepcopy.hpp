@@ -26,6 +26,9 @@ namespace Impl {
 void hostspace_fence(const DefaultHostExecutionSpace& exec);
 
 void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n);
+// Zero n bytes in parallel for large n, see ZeroMemset
+void hostspace_parallel_zero_memset(const DefaultHostExecutionSpace& exec,
+                                    void* dst, size_t n);
 // DeepCopy called with an execution space that can't access HostSpace
 void hostspace_parallel_deepcopy_async(void* dst, const void* src, ptrdiff_t n);
 template <typename ExecutionSpace>
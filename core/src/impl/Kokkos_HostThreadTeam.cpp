@@ -20,6 +20,7 @@
 
 #include <limits>
 #include <Kokkos_Macros.hpp>
+#include <Kokkos_hwloc.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
 #include <impl/Kokkos_Error.hpp>
 
@@ -29,6 +30,52 @@
 namespace Kokkos {
 namespace Impl {
 
+namespace {
+
+using work_range_t = Kokkos::pair<int64_t, int64_t>;
+
+// Take the upper half of the work range of a victim team.
+// Return the stolen range or (-1,-1) if the victim's range is empty.
+work_range_t steal_half_work_range(work_range_t volatile *range) noexcept {
+  work_range_t w(-1, -1);
+
+  while (true) {
+    // Query and attempt to update range
+    //   from: [ w.first , w.second )
+    //   to:   [ w.first , w.second - half ) = w_new
+    //
+    // If w is invalid then is just a query.
+
+    const int64_t half = (w.second - w.first + 1) / 2;
+    const work_range_t w_new(w.first, w.second - half);
+    const work_range_t w_old =
+        Kokkos::atomic_compare_exchange(range, w, w_new);
+
+    if (!(w_old.first < w_old.second)) return work_range_t(-1, -1);
+
+    if (w_old == w) return work_range_t(w_new.second, w.second);
+
+    w = w_old;
+  }
+}
+
+// First league rank of the teams whose base rank is not less than rank.
+int league_rank_ceil(int rank, int team_alloc) noexcept {
+  return (rank + team_alloc - 1) / team_alloc;
+}
+
+HostPoolBarrier g_pool_barrier = HostPoolBarrier::automatic;
+
+}  // namespace
+
+void HostThreadTeamData::set_pool_barrier(HostPoolBarrier barrier) noexcept {
+  g_pool_barrier = barrier;
+}
+
+HostPoolBarrier HostThreadTeamData::pool_barrier() noexcept {
+  return g_pool_barrier;
+}
+
 void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
                                        const int size) {
   bool ok = true;
@@ -44,9 +91,30 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
   if (ok) {
     int64_t *const root_scratch = members[0]->m_scratch;
 
+    // Pool members are ordered as "close", consecutive ranks share a core
+    // and then a NUMA region. Without hwloc the whole pool is one region.
+    const bool hwloc_avail = Kokkos::hwloc::available();
+    const int threads_per_core =
+        hwloc_avail ? Kokkos::hwloc::get_available_threads_per_core() : 1;
+    const int threads_per_numa =
+        hwloc_avail ? threads_per_core *
+                          Kokkos::hwloc::get_available_cores_per_numa()
+                    : size;
+
+    const bool tree_barrier =
+        g_pool_barrier == HostPoolBarrier::tree ||
+        (g_pool_barrier == HostPoolBarrier::automatic &&
+         size > HostTreeBarrier::tree_min_pool_size);
+
     for (int i = m_pool_rendezvous; i < m_pool_reduce; ++i) {
       root_scratch[i] = 0;
     }
+    // the nodes of the tree barrier
+    for (int rank = 1; tree_barrier && rank < size; ++rank) {
+      for (int i = m_pool_rendezvous; i < m_team_rendezvous; ++i) {
+        members[rank]->m_scratch[i] = 0;
+      }
+    }
 
     {
       HostThreadTeamData **const pool = reinterpret_cast<HostThreadTeamData **>(
@@ -66,7 +134,12 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
         mem->m_team_alloc             = 1;
         mem->m_league_rank            = rank;
         mem->m_league_size            = size;
+        mem->m_pool_rendezvous_step   = 0;
         mem->m_team_rendezvous_step   = 0;
+        mem->m_pool_tree_barrier      = tree_barrier;
+        mem->m_pool_core_size         = std::max(1, threads_per_core);
+        mem->m_pool_numa_size         = std::max(1, threads_per_numa);
+        mem->m_steal_state            = 0x9E3779B97F4A7C15ull * (rank + 1);
         pool[rank]                    = mem;
       }
     }
@@ -93,6 +166,7 @@ void HostThreadTeamData::disband_pool() {
   m_league_rank          = 0;
   m_league_size          = 1;
   m_team_rendezvous_step = 0;
+  m_pool_tree_barrier    = false;
 }
 
 int HostThreadTeamData::organize_team(const int team_size) {
@@ -213,53 +287,67 @@ int HostThreadTeamData::get_work_stealing() noexcept {
       }
     }
 
-    if (w.first == -1 && m_steal_rank != m_pool_rank) {
+    if (w.first == -1 && 1 < m_league_size) {
       HostThreadTeamData *const *const pool =
           reinterpret_cast<HostThreadTeamData **>(m_pool_scratch +
                                                   m_pool_members);
 
-      // Attempt from beginning failed, try to steal from end of neighbor
-
-      pair_int_t volatile *steal_range = &(pool[m_steal_rank]->m_work_range);
-
-      for (int attempt = true; attempt;) {
-        // Query and attempt to update steal_work_range
-        //   from: [ w.first , w.second )
-        //   to:   [ w.first , w.second - 1 ) = w_new
-        //
-        // If w is invalid then is just a query.
-
-        const pair_int_t w_new(w.first, w.second - 1);
-
-        w = Kokkos::atomic_compare_exchange(steal_range, w, w_new);
-
-        if (w.first < w.second) {
-          // steal_work_range is viable
-
-          // If steal is successful then don't repeat attempt to steal
-          attempt = !(w_new.first == w.first && w_new.second == w.second - 1);
-        } else {
-          // steal_work_range is not viable, move to next member
-          w.first  = -1;
-          w.second = -1;
-
-          // We need to figure out whether the next team is active
-          // m_steal_rank + m_team_alloc could be the next base_rank to steal
-          // from but only if there are another m_team_size threads available so
-          // that that base rank has a full team.
-          m_steal_rank =
-              m_steal_rank + m_team_alloc + m_team_size <= m_pool_size
-                  ? m_steal_rank + m_team_alloc
-                  : 0;
+      // Attempt from beginning failed, try to steal half of a victim's range.
+      // Victim teams are grouped by the pool ranks sharing a core, then a
+      // NUMA region, then the whole pool. Each group is swept starting from
+      // a random team, skipping the teams of the previous (nested) group.
+
+      const int group_size[3] = {m_pool_core_size, m_pool_numa_size,
+                                 m_pool_size};
+
+      int prev_first = m_league_rank;
+      int prev_last  = m_league_rank + 1;
+
+      for (int level = 0; level < 3 && w.first == -1; ++level) {
+        const int size       = std::min(group_size[level], m_pool_size);
+        const int first_rank = (m_team_base / size) * size;
+        const int first      = std::min(
+            m_league_size, league_rank_ceil(first_rank, m_team_alloc));
+        const int last       = std::min(
+            m_league_size, league_rank_ceil(first_rank + size, m_team_alloc));
+        const int count      = last - first;
+
+        if (prev_last - prev_first < count) {
+          // xorshift64
+          m_steal_state ^= m_steal_state << 13;
+          m_steal_state ^= m_steal_state >> 7;
+          m_steal_state ^= m_steal_state << 17;
+
+          const int start = static_cast<int>(m_steal_state % count);
+
+          for (int i = 0; i < count && w.first == -1; ++i) {
+            const int victim = first + (start + i) % count;
+
+            if (victim < prev_first || prev_last <= victim) {
+              w = steal_half_work_range(
+                  &(pool[victim * m_team_alloc]->m_work_range));
+            }
+          }
+        }
 
-          steal_range = &(pool[m_steal_rank]->m_work_range);
+        prev_first = first;
+        prev_last  = last;
+      }
 
-          // If tried all other members then don't repeat attempt to steal
-          attempt = m_steal_rank != m_pool_rank;
+      if (w.first != -1 && w.first + 1 < w.second) {
+        // Keep the first stolen index, the rest becomes the own range.
+        // The own range is empty so it is only modified by this thread,
+        // but it is replaced atomically as other teams may query it.
+        const pair_int_t w_own(w.first + 1, w.second);
+        pair_int_t w_old(m_work_range.first, m_work_range.second);
+
+        while (true) {
+          const pair_int_t w_prev =
+              Kokkos::atomic_compare_exchange(&m_work_range, w_old, w_own);
+          if (w_prev == w_old) break;
+          w_old = w_prev;
         }
       }
-
-      if (w.first != -1) w.first = w.second - 1;
     }
 
     if (1 < m_team_size) {
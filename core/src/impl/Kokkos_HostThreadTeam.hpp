@@ -95,15 +95,28 @@ class HostThreadTeamData {
   int m_league_rank;
   int m_league_size;
   int m_work_chunk;
-  int m_steal_rank;  // work stealing rank
+  int m_pool_core_size;    // consecutive pool ranks sharing a core
+  int m_pool_numa_size;    // consecutive pool ranks sharing a NUMA region
+  uint64_t m_steal_state;  // work stealing victim selection random state
   int mutable m_pool_rendezvous_step;
   int mutable m_team_rendezvous_step;
+  bool m_pool_tree_barrier;  // pool rendezvous through HostTreeBarrier
 
   HostThreadTeamData* team_member(int r) const noexcept {
     return (reinterpret_cast<HostThreadTeamData**>(
         m_pool_scratch + m_pool_members))[m_team_base + r];
   }
 
+  // with the tree barrier, every pool member owns a node in the pool
+  // rendezvous chunk of its own scratch
+  struct PoolBarrierNode {
+    HostThreadTeamData const* m_data;
+    int* operator()(const int r) const noexcept {
+      return reinterpret_cast<int*>(m_data->pool_member(r)->m_scratch +
+                                    m_pool_rendezvous);
+    }
+  };
+
  public:
   inline bool team_rendezvous() const noexcept {
     // FIXME_OPENMP The tasking framework creates an instance with
@@ -144,6 +157,11 @@ class HostThreadTeamData {
   }
 
   inline int pool_rendezvous() const noexcept {
+    if (m_pool_tree_barrier) {
+      return HostTreeBarrier::arrive(PoolBarrierNode{this}, m_pool_rank,
+                                     m_pool_size, m_pool_rendezvous_step);
+    }
+
     int* ptr = reinterpret_cast<int*>(m_pool_scratch + m_pool_rendezvous);
     HostBarrier::split_arrive(ptr, m_pool_size, m_pool_rendezvous_step);
     if (m_pool_rank != 0) {
@@ -156,6 +174,12 @@ class HostThreadTeamData {
   }
 
   inline void pool_rendezvous_release() const noexcept {
+    if (m_pool_tree_barrier) {
+      HostTreeBarrier::release(PoolBarrierNode{this}, m_pool_rank, m_pool_size,
+                               m_pool_rendezvous_step);
+      return;
+    }
+
     HostBarrier::split_release(
         reinterpret_cast<int*>(m_pool_scratch + m_pool_rendezvous), m_pool_size,
         m_pool_rendezvous_step);
@@ -185,9 +209,12 @@ class HostThreadTeamData {
         m_league_rank(0),
         m_league_size(1),
         m_work_chunk(0),
-        m_steal_rank(0),
+        m_pool_core_size(1),
+        m_pool_numa_size(1),
+        m_steal_state(0),
         m_pool_rendezvous_step(0),
-        m_team_rendezvous_step(0) {
+        m_team_rendezvous_step(0),
+        m_pool_tree_barrier(false) {
   }
 
   //----------------------------------------
@@ -199,6 +226,10 @@ class HostThreadTeamData {
   // Each thread is its own team with team_size == 1.
   static void organize_pool(HostThreadTeamData* members[], const int size);
 
+  // Algorithm of the pool rendezvous of the pools organized afterwards.
+  static void set_pool_barrier(HostPoolBarrier barrier) noexcept;
+  static HostPoolBarrier pool_barrier() noexcept;
+
   // Called by each thread within the pool
   void disband_pool();
 
@@ -337,7 +368,10 @@ class HostThreadTeamData {
   //----------------------------------------
   // Get a work index within the range.
   // First try to steal from beginning of own teams's partition.
-  // If that fails then try to steal from end of another teams' partition.
+  // If that fails then try to steal the upper half of another team's
+  // partition, keep its first index and make the rest the own partition.
+  // Victims are visited in random order within groups of increasing
+  // distance: same core, same NUMA region, whole pool.
   int get_work_stealing() noexcept;
 
   //----------------------------------------
@@ -360,13 +394,6 @@ class HostThreadTeamData {
 
     m_work_range.first  = part * m_league_rank;
     m_work_range.second = m_work_range.first + part;
-
-    // Steal from next team, round robin
-    // The next team is offset by m_team_alloc if it fits in the pool.
-
-    m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
-                       ? m_team_base + m_team_alloc
-                       : 0;
   }
 
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
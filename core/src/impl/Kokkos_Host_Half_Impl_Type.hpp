@@ -0,0 +1,202 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
+#define KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_BitManipulation.hpp>  // bit_cast
+
+#include <cstdint>
+
+// Builds with a device backend use the half precision types of that backend,
+// host-only builds store half_t and bhalf_t in 16 bits and do the arithmetic
+// in float.
+#if !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP) &&          \
+    !defined(KOKKOS_ENABLE_SYCL) && !defined(KOKKOS_ENABLE_OPENMPTARGET) && \
+    !defined(KOKKOS_ENABLE_OPENACC)
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#define KOKKOS_IMPL_HOST_HALF_USE_F16C
+#elif defined(__aarch64__) && defined(__FLT16_MANT_DIG__)
+#define KOKKOS_IMPL_HOST_HALF_USE_FLOAT16
+#endif
+
+namespace Kokkos::Impl {
+
+// The conversions round to nearest even, turn NaN into a quiet NaN and keep
+// the subnormal numbers. Without hardware support the binary16 ones use the
+// float tricks of F. Giesen's float_to_half_fast3_rtne and half_to_float.
+KOKKOS_INLINE_FUNCTION
+std::uint16_t float_to_binary16_bits(float val) {
+#if defined(KOKKOS_IMPL_HOST_HALF_USE_F16C)
+  return _cvtss_sh(val, _MM_FROUND_TO_NEAREST_INT);
+#elif defined(KOKKOS_IMPL_HOST_HALF_USE_FLOAT16)
+  return Kokkos::bit_cast<std::uint16_t>(static_cast<_Float16>(val));
+#else
+  constexpr std::uint32_t f32_infinity = 255u << 23;
+  constexpr std::uint32_t f16_overflow = (127u + 16u) << 23;
+  constexpr std::uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u)
+                                         << 23;
+  constexpr std::uint32_t f16_min_normal = 113u << 23;
+
+  const std::uint32_t sign = Kokkos::bit_cast<std::uint32_t>(val) & 0x80000000u;
+  std::uint32_t bits       = Kokkos::bit_cast<std::uint32_t>(val) ^ sign;
+
+  std::uint32_t result;
+  if (bits >= f16_overflow) {
+    // infinity, NaN or too large: all the exponent bits are set
+    result = bits > f32_infinity ? 0x7e00 : 0x7c00;
+  } else if (bits < f16_min_normal) {
+    // subnormal or zero: the float addition aligns the 10 mantissa bits at
+    // the bottom and rounds them to nearest even
+    const float aligned = Kokkos::bit_cast<float>(bits) +
+                          Kokkos::bit_cast<float>(denorm_magic);
+    result = Kokkos::bit_cast<std::uint32_t>(aligned) - denorm_magic;
+  } else {
+    const std::uint32_t mantissa_odd = (bits >> 13) & 1u;
+    // rebias the exponent and round, a carry out of the mantissa correctly
+    // bumps the exponent
+    bits += ((15u - 127u) << 23) + 0xfffu + mantissa_odd;
+    result = bits >> 13;
+  }
+  return static_cast<std::uint16_t>(result | (sign >> 16));
+#endif
+}
+
+KOKKOS_INLINE_FUNCTION
+float binary16_bits_to_float(std::uint16_t val) {
+#if defined(KOKKOS_IMPL_HOST_HALF_USE_F16C)
+  return _cvtsh_ss(val);
+#elif defined(KOKKOS_IMPL_HOST_HALF_USE_FLOAT16)
+  return static_cast<float>(Kokkos::bit_cast<_Float16>(val));
+#else
+  constexpr std::uint32_t shifted_exponent = 0x7c00u << 13;
+  constexpr std::uint32_t magic            = 113u << 23;
+
+  const std::uint32_t exponent = (val << 13) & shifted_exponent;
+  std::uint32_t bits           = ((val & 0x7fffu) << 13) + ((127u - 15u) << 23);
+  if (exponent == shifted_exponent) {
+    // infinity or NaN
+    bits += (128u - 16u) << 23;
+  } else if (exponent == 0) {
+    // zero or subnormal: renormalize
+    bits += 1u << 23;
+    bits = Kokkos::bit_cast<std::uint32_t>(Kokkos::bit_cast<float>(bits) -
+                                           Kokkos::bit_cast<float>(magic));
+  }
+  return Kokkos::bit_cast<float>(bits | (std::uint32_t(val & 0x8000u) << 16));
+#endif
+}
+
+// bfloat16 is the upper half of a float, only the rounding needs work
+KOKKOS_INLINE_FUNCTION
+std::uint16_t float_to_bfloat16_bits(float val) {
+  const std::uint32_t bits = Kokkos::bit_cast<std::uint32_t>(val);
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+  }
+  return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >>
+                                    16);
+}
+
+KOKKOS_INLINE_FUNCTION
+float bfloat16_bits_to_float(std::uint16_t val) {
+  return Kokkos::bit_cast<float>(std::uint32_t(val) << 16);
+}
+
+// Converting double to float to half would round twice: a double just above
+// a tie of the half values can round to the tie in float, which then rounds
+// to even. Rounding to odd in float keeps the dropped bits as a sticky bit,
+// float has enough extra bits for the second rounding to be correct.
+KOKKOS_INLINE_FUNCTION
+float double_to_float_round_to_odd(double val) {
+  const float rounded = static_cast<float>(val);
+  if (static_cast<double>(rounded) == val || val != val) return rounded;
+  std::uint32_t bits = Kokkos::bit_cast<std::uint32_t>(rounded);
+  // rounded away from zero, truncate instead
+  if ((val > 0) == (static_cast<double>(rounded) > val)) --bits;
+  return Kokkos::bit_cast<float>(bits | 1u);
+}
+
+/// \brief 16-bit storage of a binary16 value
+///
+/// Like the device half types it converts implicitly from float, the
+/// arithmetic is left to floating_point_wrapper.
+struct host_binary16 {
+  std::uint16_t bits;
+
+  host_binary16() = default;
+  KOKKOS_FUNCTION
+  host_binary16(float val) : bits(float_to_binary16_bits(val)) {}
+  KOKKOS_FUNCTION
+  explicit host_binary16(double val)
+      : bits(float_to_binary16_bits(double_to_float_round_to_odd(val))) {}
+
+  KOKKOS_FUNCTION
+  explicit operator float() const { return binary16_bits_to_float(bits); }
+  KOKKOS_FUNCTION
+  explicit operator double() const { return binary16_bits_to_float(bits); }
+};
+
+/// \brief 16-bit storage of a bfloat16 value
+struct host_bfloat16 {
+  std::uint16_t bits;
+
+  host_bfloat16() = default;
+  KOKKOS_FUNCTION
+  host_bfloat16(float val) : bits(float_to_bfloat16_bits(val)) {}
+  KOKKOS_FUNCTION
+  explicit host_bfloat16(double val)
+      : bits(float_to_bfloat16_bits(double_to_float_round_to_odd(val))) {}
+
+  KOKKOS_FUNCTION
+  explicit operator float() const { return bfloat16_bits_to_float(bits); }
+  KOKKOS_FUNCTION
+  explicit operator double() const { return bfloat16_bits_to_float(bits); }
+};
+
+static_assert(sizeof(host_binary16) == 2 && sizeof(host_bfloat16) == 2);
+
+}  // namespace Kokkos::Impl
+
+// Make sure no one else tries to define half_t
+#ifndef KOKKOS_IMPL_HALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HOST_HALF_TYPE_DEFINED
+
+namespace Kokkos::Impl {
+struct half_impl_t {
+  using type = host_binary16;
+};
+}  // namespace Kokkos::Impl
+#endif  // KOKKOS_IMPL_HALF_TYPE_DEFINED
+
+// Make sure no one else tries to define bhalf_t
+#ifndef KOKKOS_IMPL_BHALF_TYPE_DEFINED
+#define KOKKOS_IMPL_BHALF_TYPE_DEFINED
+#define KOKKOS_IMPL_HOST_BHALF_TYPE_DEFINED
+
+namespace Kokkos::Impl {
+struct bhalf_impl_t {
+  using type = host_bfloat16;
+};
+}  // namespace Kokkos::Impl
+#endif  // KOKKOS_IMPL_BHALF_TYPE_DEFINED
+
+#endif  // host-only build
+#endif  // KOKKOS_HOST_HALF_IMPL_TYPE_HPP_
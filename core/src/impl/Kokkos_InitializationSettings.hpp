@@ -67,6 +67,8 @@ class InitializationSettings {
   KOKKOS_IMPL_DECLARE(bool, disable_warnings);
   KOKKOS_IMPL_DECLARE(bool, print_configuration);
   KOKKOS_IMPL_DECLARE(bool, tune_internals);
+  KOKKOS_IMPL_DECLARE(std::string, host_barrier);
+  KOKKOS_IMPL_DECLARE(int, threads_spin_budget);
   KOKKOS_IMPL_DECLARE(bool, tools_help);
   KOKKOS_IMPL_DECLARE(std::string, tools_libs);
   KOKKOS_IMPL_DECLARE(std::string, tools_args);
@@ -0,0 +1,35 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_STREAMING_STORE_FENCE_HPP
+#define KOKKOS_IMPL_STREAMING_STORE_FENCE_HPP
+
+namespace Kokkos {
+namespace Impl {
+
+// Orders the non-temporal stores of the calling thread before its later
+// stores. The host fences call it since a Serial kernel runs on the thread
+// that fences and ends without a barrier. The worker threads of OpenMP and
+// Threads drain their stores with the locked instructions of the barrier at
+// the end of the parallel region. An sfence with no pending non-temporal
+// store costs a few cycles, the fences issue it whether or not a view with
+// the StreamingStore trait was written.
+void streaming_store_fence();
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
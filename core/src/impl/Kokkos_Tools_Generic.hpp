@@ -25,6 +25,9 @@
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Tuners.hpp>
 
+#include <string>
+#include <string_view>
+
 namespace Kokkos {
 
 namespace Tools {
@@ -49,14 +52,14 @@ static MDRangeTuningMap<Rank> mdrange_tuners;
 
 // For any policies without a tuning implementation, with a reducer
 template <class ReducerType, class ExecPolicy, class Functor, typename TagType>
-auto tune_policy(const size_t, const std::string&, const ExecPolicy& policy,
+auto tune_policy(const size_t, std::string_view, const ExecPolicy& policy,
                  const Functor&, TagType) {
   return policy;
 }
 
 // For any policies without a tuning implementation, without a reducer
 template <class ExecPolicy, class Functor, typename TagType>
-auto tune_policy(const size_t, const std::string&, const ExecPolicy& policy,
+auto tune_policy(const size_t, std::string_view, const ExecPolicy& policy,
                  const Functor&, const TagType&) {
   return policy;
 }
@@ -162,12 +165,12 @@ auto default_tuned_version_of(const Policy& policy) {
 
 template <class Tuner, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-auto generic_tune_policy(const std::string& label_in, Map& map,
+auto generic_tune_policy(std::string_view label_in, Map& map,
                          const Policy& policy, const Functor& functor,
                          const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
+    std::string label(label_in);
     if (label_in.empty()) {
       using policy_type = std::remove_reference_t<decltype(policy)>;
       using work_tag    = typename policy_type::work_tag;
@@ -189,12 +192,12 @@ auto generic_tune_policy(const std::string& label_in, Map& map,
 }
 template <class Tuner, class ReducerType, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-auto generic_tune_policy(const std::string& label_in, Map& map,
+auto generic_tune_policy(std::string_view label_in, Map& map,
                          const Policy& policy, const Functor& functor,
                          const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
+    std::string label(label_in);
     if (label_in.empty()) {
       using policy_type = std::remove_reference_t<decltype(policy)>;
       using work_tag    = typename policy_type::work_tag;
@@ -217,7 +220,7 @@ auto generic_tune_policy(const std::string& label_in, Map& map,
 
 // tune a TeamPolicy, without reducer
 template <class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+auto tune_policy(const size_t /**tuning_context*/, std::string_view label_in,
                  const Kokkos::TeamPolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   return generic_tune_policy<Experimental::TeamSizeTuner>(
@@ -230,7 +233,7 @@ auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 
 // tune a TeamPolicy, with reducer
 template <class ReducerType, class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+auto tune_policy(const size_t /**tuning_context*/, std::string_view label_in,
                  const Kokkos::TeamPolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   return generic_tune_policy<Experimental::TeamSizeTuner, ReducerType>(
@@ -243,7 +246,7 @@ auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 
 template <class Functor, class TagType, class... Properties>
 auto tune_occupancy_controlled_policy(
-    const size_t /**tuning_context*/, const std::string& label_in,
+    const size_t /**tuning_context*/, std::string_view label_in,
     const Kokkos::RangePolicy<Properties...>& policy, const Functor& functor,
     const TagType& tag) {
   return generic_tune_policy<Experimental::RangePolicyOccupancyTuner>(
@@ -253,7 +256,7 @@ auto tune_occupancy_controlled_policy(
       });
 }
 template <class Functor, class TagType, class... Properties>
-auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
+auto tune_range_policy(const size_t tuning_context, std::string_view label_in,
                        const Kokkos::RangePolicy<Properties...>& policy,
                        const Functor& functor, const TagType& tag,
                        std::true_type) {
@@ -262,7 +265,7 @@ auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
 }
 template <class Functor, class TagType, class... Properties>
 auto tune_range_policy(const size_t /**tuning_context*/,
-                       const std::string& /*label_in*/,
+                       std::string_view /*label_in*/,
                        const Kokkos::RangePolicy<Properties...>& policy,
                        const Functor& /**functor*/, const TagType& /**tag*/,
                        std::false_type) {
@@ -272,7 +275,7 @@ auto tune_range_policy(const size_t /**tuning_context*/,
 // Reducer versions
 template <class RT, class Functor, class TagType, class... Properties>
 auto tune_occupancy_controlled_policy(
-    const size_t /**tuning_context*/, const std::string& label_in,
+    const size_t /**tuning_context*/, std::string_view label_in,
     const Kokkos::RangePolicy<Properties...>& policy, const Functor& functor,
     const TagType& tag) {
   return generic_tune_policy<Experimental::RangePolicyOccupancyTuner>(
@@ -282,7 +285,7 @@ auto tune_occupancy_controlled_policy(
       });
 }
 template <class RT, class Functor, class TagType, class... Properties>
-auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
+auto tune_range_policy(const size_t tuning_context, std::string_view label_in,
                        const Kokkos::RangePolicy<Properties...>& policy,
                        const Functor& functor, const TagType& tag,
                        std::true_type) {
@@ -291,7 +294,7 @@ auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
 }
 template <class ReducerType, class Functor, class TagType, class... Properties>
 auto tune_range_policy(const size_t /**tuning_context*/,
-                       const std::string& /**label_in*/,
+                       std::string_view /**label_in*/,
                        const Kokkos::RangePolicy<Properties...>& policy,
                        const Functor& /**functor*/, const TagType& /**tag*/,
                        std::false_type) {
@@ -300,7 +303,7 @@ auto tune_range_policy(const size_t /**tuning_context*/,
 
 // tune a RangePolicy, without reducer
 template <class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t tuning_context, const std::string& label_in,
+auto tune_policy(const size_t tuning_context, std::string_view label_in,
                  const Kokkos::RangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using policy_t = Kokkos::RangePolicy<Properties...>;
@@ -313,7 +316,7 @@ auto tune_policy(const size_t tuning_context, const std::string& label_in,
 
 // tune a RangePolicy, with reducer
 template <class ReducerType, class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t tuning_context, const std::string& label_in,
+auto tune_policy(const size_t tuning_context, std::string_view label_in,
                  const Kokkos::RangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using policy_t = Kokkos::RangePolicy<Properties...>;
@@ -326,7 +329,7 @@ auto tune_policy(const size_t tuning_context, const std::string& label_in,
 
 // tune a MDRangePolicy, without reducer
 template <class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+auto tune_policy(const size_t /**tuning_context*/, std::string_view label_in,
                  const Kokkos::MDRangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
@@ -340,7 +343,7 @@ auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 
 // tune a MDRangePolicy, with reducer
 template <class ReducerType, class Functor, class TagType, class... Properties>
-auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
+auto tune_policy(const size_t /**tuning_context*/, std::string_view label_in,
                  const Kokkos::MDRangePolicy<Properties...>& policy,
                  const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
@@ -355,7 +358,7 @@ auto tune_policy(const size_t /**tuning_context*/, const std::string& label_in,
 template <class ReducerType>
 struct ReductionSwitcher {
   template <class Functor, class TagType, class ExecPolicy>
-  static auto tune(const size_t tuning_context, const std::string& label,
+  static auto tune(const size_t tuning_context, std::string_view label,
                    const ExecPolicy& policy, const Functor& functor,
                    const TagType& tag) {
     if (Kokkos::tune_internals()) {
@@ -369,7 +372,7 @@ struct ReductionSwitcher {
 template <>
 struct ReductionSwitcher<Kokkos::InvalidType> {
   template <class Functor, class TagType, class ExecPolicy>
-  static auto tune(const size_t tuning_context, const std::string& label,
+  static auto tune(const size_t tuning_context, std::string_view label,
                    const ExecPolicy& policy, const Functor& functor,
                    const TagType& tag) {
     if (Kokkos::tune_internals()) {
@@ -381,12 +384,12 @@ struct ReductionSwitcher<Kokkos::InvalidType> {
 
 template <class Tuner, class Functor, class TagType,
           class TuningPermissionFunctor, class Map, class Policy>
-void generic_report_results(const std::string& label_in, Map& map,
+void generic_report_results(std::string_view label_in, Map& map,
                             const Policy& policy, const Functor&,
                             const TagType&,
                             const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
+    std::string label(label_in);
     if (label_in.empty()) {
       using policy_type = std::remove_reference_t<decltype(policy)>;
       using work_tag    = typename policy_type::work_tag;
@@ -400,13 +403,13 @@ void generic_report_results(const std::string& label_in, Map& map,
 
 // report results for a policy type we don't tune (do nothing)
 template <class ExecPolicy, class Functor, typename TagType>
-void report_policy_results(const size_t, const std::string&, const ExecPolicy&,
+void report_policy_results(const size_t, std::string_view, const ExecPolicy&,
                            const Functor&, const TagType&) {}
 
 // report results for a TeamPolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
-                           const std::string& label_in,
+                           std::string_view label_in,
                            const Kokkos::TeamPolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   generic_report_results<Experimental::TeamSizeTuner>(
@@ -420,7 +423,7 @@ void report_policy_results(const size_t /**tuning_context*/,
 // report results for an MDRangePolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
-                           const std::string& label_in,
+                           std::string_view label_in,
                            const Kokkos::MDRangePolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   using Policy              = Kokkos::MDRangePolicy<Properties...>;
@@ -435,7 +438,7 @@ void report_policy_results(const size_t /**tuning_context*/,
 // report results for an MDRangePolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
-                           const std::string& label_in,
+                           std::string_view label_in,
                            const Kokkos::RangePolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   using Policy = Kokkos::RangePolicy<Properties...>;
@@ -454,14 +457,15 @@ namespace Impl {
 
 template <class ExecPolicy, class FunctorType>
 auto begin_parallel_for(const ExecPolicy& policy, FunctorType& functor,
-                        const std::string& label, uint64_t& kpID) {
+                        std::string_view label, uint64_t& kpID) {
   using response_type =
       Kokkos::Tools::Impl::ToolResponse<ExecPolicy, FunctorType>;
   response_type response{policy};
   if (Kokkos::Tools::profileLibraryLoaded()) {
+    std::string const label_str(label);
     Kokkos::Impl::ParallelConstructName<FunctorType,
                                         typename ExecPolicy::work_tag>
-        name(label);
+        name(label_str);
     Kokkos::Tools::beginParallelFor(
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
@@ -480,7 +484,7 @@ auto begin_parallel_for(const ExecPolicy& policy, FunctorType& functor,
 
 template <class ExecPolicy, class FunctorType>
 void end_parallel_for(const ExecPolicy& policy, FunctorType& functor,
-                      const std::string& label, uint64_t& kpID) {
+                      std::string_view label, uint64_t& kpID) {
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelFor(kpID);
   }
@@ -499,14 +503,15 @@ void end_parallel_for(const ExecPolicy& policy, FunctorType& functor,
 
 template <class ExecPolicy, class FunctorType>
 auto begin_parallel_scan(const ExecPolicy& policy, FunctorType& functor,
-                         const std::string& label, uint64_t& kpID) {
+                         std::string_view label, uint64_t& kpID) {
   using response_type =
       Kokkos::Tools::Impl::ToolResponse<ExecPolicy, FunctorType>;
   response_type response{policy};
   if (Kokkos::Tools::profileLibraryLoaded()) {
+    std::string const label_str(label);
     Kokkos::Impl::ParallelConstructName<FunctorType,
                                         typename ExecPolicy::work_tag>
-        name(label);
+        name(label_str);
     Kokkos::Tools::beginParallelScan(
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
@@ -525,7 +530,7 @@ auto begin_parallel_scan(const ExecPolicy& policy, FunctorType& functor,
 
 template <class ExecPolicy, class FunctorType>
 void end_parallel_scan(const ExecPolicy& policy, FunctorType& functor,
-                       const std::string& label, uint64_t& kpID) {
+                       std::string_view label, uint64_t& kpID) {
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelScan(kpID);
   }
@@ -544,13 +549,14 @@ void end_parallel_scan(const ExecPolicy& policy, FunctorType& functor,
 
 template <class ReducerType, class ExecPolicy, class FunctorType>
 auto begin_parallel_reduce(const ExecPolicy& policy, FunctorType& functor,
-                           const std::string& label, uint64_t& kpID) {
+                           std::string_view label, uint64_t& kpID) {
   using response_type = ToolResponse<ExecPolicy, FunctorType>;
   response_type response{policy};
   if (Kokkos::Tools::profileLibraryLoaded()) {
+    std::string const label_str(label);
     Kokkos::Impl::ParallelConstructName<FunctorType,
                                         typename ExecPolicy::work_tag>
-        name(label);
+        name(label_str);
     Kokkos::Tools::beginParallelReduce(
         name.get(), Kokkos::Profiling::Experimental::device_id(policy.space()),
         &kpID);
@@ -567,7 +573,7 @@ auto begin_parallel_reduce(const ExecPolicy& policy, FunctorType& functor,
 
 template <class ReducerType, class ExecPolicy, class FunctorType>
 void end_parallel_reduce(const ExecPolicy& policy, FunctorType& functor,
-                         const std::string& label, uint64_t& kpID) {
+                         std::string_view label, uint64_t& kpID) {
   if (Kokkos::Tools::profileLibraryLoaded()) {
     Kokkos::Tools::endParallelReduce(kpID);
   }
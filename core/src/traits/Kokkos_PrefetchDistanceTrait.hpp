@@ -0,0 +1,96 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_KOKKOS_PREFETCHDISTANCETRAIT_HPP
+#define KOKKOS_KOKKOS_PREFETCHDISTANCETRAIT_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <traits/Kokkos_PolicyTraitAdaptor.hpp>
+#include <traits/Kokkos_Traits_fwd.hpp>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+//==============================================================================
+// <editor-fold desc="User interface"> {{{1
+
+/** \brief Prefetch distance of a RangePolicy on host execution spaces.
+ *
+ *  Before the functor runs iteration i, parallel_for calls its
+ *  prefetch(i + Distance) member, or prefetch(WorkTag(), i + Distance) for
+ *  tagged policies, as long as i + Distance is in the range. The functor
+ *  issues the prefetches of the loads of that iteration with
+ *  Kokkos::Experimental::prefetch, typically through an indirection array.
+ *  Device execution spaces and the other policies ignore the trait.
+ */
+template <unsigned Distance>
+struct PrefetchDistance {
+  static_assert(Distance > 0,
+                "Kokkos Error: PrefetchDistance must be positive");
+  using prefetch_distance = PrefetchDistance;
+  static constexpr unsigned value = Distance;
+};
+
+// </editor-fold> end User interface }}}1
+//==============================================================================
+
+}  // end namespace Experimental
+
+namespace Impl {
+
+//==============================================================================
+// <editor-fold desc="trait specification"> {{{1
+
+struct PrefetchDistanceTrait : TraitSpecificationBase<PrefetchDistanceTrait> {
+  struct base_traits {
+    static constexpr bool prefetch_distance_is_defaulted = true;
+
+    static constexpr unsigned prefetch_distance = 0;
+    KOKKOS_IMPL_MSVC_NVCC_EBO_WORKAROUND
+  };
+  template <class PrefetchDistanceParam, class AnalyzeNextTrait>
+  struct mixin_matching_trait : AnalyzeNextTrait {
+    using base_t = AnalyzeNextTrait;
+    using base_t::base_t;
+
+    static constexpr bool prefetch_distance_is_defaulted = false;
+
+    static_assert(base_t::prefetch_distance_is_defaulted,
+                  "Kokkos Error: More than one prefetch distance given");
+
+    static constexpr unsigned prefetch_distance = PrefetchDistanceParam::value;
+  };
+};
+
+// </editor-fold> end trait specification }}}1
+//==============================================================================
+
+//==============================================================================
+// <editor-fold desc="PolicyTraitMatcher specialization"> {{{1
+
+template <unsigned Distance>
+struct PolicyTraitMatcher<PrefetchDistanceTrait,
+                          Kokkos::Experimental::PrefetchDistance<Distance>>
+    : std::true_type {};
+
+// </editor-fold> end PolicyTraitMatcher specialization }}}1
+//==============================================================================
+
+}  // end namespace Impl
+}  // end namespace Kokkos
+
+#endif  // KOKKOS_KOKKOS_PREFETCHDISTANCETRAIT_HPP
@@ -65,6 +65,7 @@ struct WorkItemPropertyTrait;
 struct LaunchBoundsTrait;
 struct OccupancyControlTrait;
 struct GraphKernelTrait;
+struct PrefetchDistanceTrait;
 struct WorkTagTrait;
 
 // Keep these sorted by frequency of use to reduce compilation time
@@ -80,6 +81,7 @@ using execution_policy_trait_specifications =
     LaunchBoundsTrait,
     OccupancyControlTrait,
     GraphKernelTrait,
+    PrefetchDistanceTrait,
     // This one has to be last, unfortunately:
     WorkTagTrait
   >;
@@ -0,0 +1,95 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+namespace {
+
+// adds value to the entries of a patch of the view
+struct AddToPatch {
+  Kokkos::View<int*, TEST_EXECSPACE> view;
+  int value;
+
+  KOKKOS_FUNCTION
+  void operator()(const std::int64_t i) const { view(i) += value; }
+};
+
+// the patches are disjoint, have varying sizes and some are empty
+std::vector<Kokkos::Experimental::BatchedWorkItem<AddToPatch>> make_patches(
+    Kokkos::View<int*, TEST_EXECSPACE> view, int num_patches,
+    std::vector<int>& expected) {
+  std::vector<Kokkos::Experimental::BatchedWorkItem<AddToPatch>> items;
+  std::int64_t begin = 0;
+  for (int k = 0; k < num_patches; ++k) {
+    const std::int64_t size = (k * 37) % 101;
+    items.push_back({AddToPatch{view, k + 1}, begin, begin + size});
+    for (std::int64_t i = begin; i < begin + size; ++i) {
+      expected[i] += k + 1;
+    }
+    begin += size;
+  }
+  return items;
+}
+
+void test_batched_parallel_for(int num_patches, std::int64_t chunk_size) {
+  // large enough for the patches of the largest batch
+  Kokkos::View<int*, TEST_EXECSPACE> view("view", 101 * num_patches);
+  std::vector<int> expected(view.extent(0), 0);
+  auto items = make_patches(view, num_patches, expected);
+
+  Kokkos::Experimental::parallel_for_batched("batched", TEST_EXECSPACE(),
+                                             items, chunk_size);
+  // the call fences, the view can be read right away
+  auto view_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+  for (std::size_t i = 0; i < view.extent(0); ++i) {
+    ASSERT_EQ(view_h(i), expected[i]) << "at index " << i;
+  }
+
+  // the overload without label runs the same work again
+  Kokkos::Experimental::parallel_for_batched(TEST_EXECSPACE(), items);
+  Kokkos::deep_copy(view_h, view);
+  for (std::size_t i = 0; i < view.extent(0); ++i) {
+    ASSERT_EQ(view_h(i), 2 * expected[i]) << "at index " << i;
+  }
+}
+
+TEST(TEST_CATEGORY, batched_parallel_for) {
+  for (int num_patches : {0, 1, 2, 17, 1000}) {
+    for (std::int64_t chunk_size : {0, 1, 7, 64, 100000}) {
+      test_batched_parallel_for(num_patches, chunk_size);
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, batched_parallel_for_empty_items) {
+  Kokkos::View<int*, TEST_EXECSPACE> view("view", 10);
+  std::vector<Kokkos::Experimental::BatchedWorkItem<AddToPatch>> items(
+      3, {AddToPatch{view, 1}, 5, 5});
+  // reversed ranges are empty as well
+  items.push_back({AddToPatch{view, 1}, 8, 2});
+  Kokkos::Experimental::parallel_for_batched("batched", TEST_EXECSPACE(),
+                                             items);
+  auto view_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+  for (std::size_t i = 0; i < view.extent(0); ++i) {
+    ASSERT_EQ(view_h(i), 0);
+  }
+}
+
+}  // namespace
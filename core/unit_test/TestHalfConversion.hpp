@@ -84,9 +84,61 @@ void test_bhalf_conversion() {
   test_bhalf_conversion_type<unsigned long long>();
 }
 
+template <class HalfType>
+std::uint16_t half_bits(HalfType val) {
+  return Kokkos::bit_cast<std::uint16_t>(
+      static_cast<typename HalfType::impl_type>(val));
+}
+
+void test_half_rounding() {
+#if !KOKKOS_HALF_T_IS_FLOAT
+  using Kokkos::Experimental::half_t;
+  ASSERT_EQ(sizeof(half_t), 2u);
+
+  // every finite binary16 value survives the round trip through float
+  for (unsigned bits = 0; bits < (1u << 16); ++bits) {
+    if ((bits & 0x7c00u) == 0x7c00u) continue;
+    const half_t val = half_t::bit_comparison_type{std::uint16_t(bits)};
+    ASSERT_EQ(half_bits(half_t(static_cast<float>(val))), bits);
+  }
+
+  // ties round to even, also for the subnormal numbers
+  ASSERT_EQ(half_bits(half_t(1.0f + 0x1p-11f)), 0x3c00u);
+  ASSERT_EQ(half_bits(half_t(1.0f + 0x3p-11f)), 0x3c02u);
+  ASSERT_EQ(half_bits(half_t(0x1p-24f)), 0x0001u);
+  ASSERT_EQ(half_bits(half_t(0x1p-25f)), 0x0000u);
+  ASSERT_EQ(half_bits(half_t(0x3p-25f)), 0x0002u);
+  ASSERT_EQ(half_bits(half_t(65504.0f)), 0x7bffu);
+  ASSERT_EQ(half_bits(half_t(65520.0f)), 0x7c00u);
+  ASSERT_EQ(half_bits(half_t(-1e10f)), 0xfc00u);
+  // doubles are rounded once, not through float
+  ASSERT_EQ(half_bits(half_t(1.0 + 0x1p-11 + 0x1p-40)), 0x3c01u);
+  ASSERT_EQ(half_bits(half_t(1.0 + 0x1p-11 - 0x1p-40)), 0x3c00u);
+  ASSERT_EQ(half_bits(half_t(-0x1p-25 - 0x1p-60)), 0x8001u);
+  ASSERT_EQ(half_bits(half_t(65520.0 - 0x1p-20)), 0x7bffu);
+  ASSERT_EQ(half_bits(half_t(1e300)), 0x7c00u);
+  ASSERT_TRUE(Kokkos::isnan(half_t(Kokkos::Experimental::quiet_NaN_v<float>)));
+#endif
+
+#if !KOKKOS_BHALF_T_IS_FLOAT
+  using Kokkos::Experimental::bhalf_t;
+  ASSERT_EQ(sizeof(bhalf_t), 2u);
+
+  ASSERT_EQ(half_bits(bhalf_t(1.0f + 0x1p-8f)), 0x3f80u);
+  ASSERT_EQ(half_bits(bhalf_t(1.0f + 0x3p-8f)), 0x3f82u);
+  ASSERT_EQ(half_bits(bhalf_t(-2.0f)), 0xc000u);
+  ASSERT_EQ(half_bits(bhalf_t(1.0 + 0x1p-8 + 0x1p-40)), 0x3f81u);
+  ASSERT_EQ(half_bits(bhalf_t(1.0 + 0x1p-8 - 0x1p-40)), 0x3f80u);
+  ASSERT_TRUE(
+      Kokkos::isnan(bhalf_t(Kokkos::Experimental::quiet_NaN_v<float>)));
+#endif
+}
+
 TEST(TEST_CATEGORY, half_conversion) { test_half_conversion(); }
 
 TEST(TEST_CATEGORY, bhalf_conversion) { test_bhalf_conversion(); }
 
+TEST(TEST_CATEGORY, half_rounding) { test_half_rounding(); }
+
 }  // namespace Test
 #endif
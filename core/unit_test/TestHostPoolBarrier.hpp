@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
+
+namespace Test {
+
+namespace {
+
+// Selects the pool barrier and restores the one selected at initialization
+class ScopedHostPoolBarrier {
+  Kokkos::Impl::HostPoolBarrier m_previous;
+
+ public:
+  explicit ScopedHostPoolBarrier(Kokkos::Impl::HostPoolBarrier barrier)
+      : m_previous(Kokkos::Impl::HostThreadTeamData::pool_barrier()) {
+    Kokkos::Impl::HostThreadTeamData::set_pool_barrier(barrier);
+  }
+  ~ScopedHostPoolBarrier() {
+    Kokkos::Impl::HostThreadTeamData::set_pool_barrier(m_previous);
+  }
+  ScopedHostPoolBarrier(ScopedHostPoolBarrier const&)            = delete;
+  ScopedHostPoolBarrier& operator=(ScopedHostPoolBarrier const&) = delete;
+};
+
+template <class ExecSpace>
+void test_host_pool_barrier(Kokkos::Impl::HostPoolBarrier barrier) {
+  ScopedHostPoolBarrier scoped_barrier(barrier);
+
+  // the barrier is selected when a pool is organized, the pool of a new
+  // instance is organized by its first kernel
+  const ExecSpace exec =
+      Kokkos::Experimental::partition_space(ExecSpace(), 1)[0];
+  using policy_type = Kokkos::RangePolicy<ExecSpace>;
+  const int n       = 100000;
+
+  long sum = 0;
+  Kokkos::parallel_reduce(
+      policy_type(exec, 0, n),
+      KOKKOS_LAMBDA(const int i, long& update) { update += i; }, sum);
+  ASSERT_EQ(sum, long(n) * (n - 1) / 2);
+
+  Kokkos::View<long*, ExecSpace> prefix("prefix", n);
+  long total = 0;
+  Kokkos::parallel_scan(
+      policy_type(exec, 0, n),
+      KOKKOS_LAMBDA(const int i, long& update, const bool final) {
+        if (final) prefix(i) = update;
+        update += i;
+      },
+      total);
+  ASSERT_EQ(total, long(n) * (n - 1) / 2);
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(exec, 0, n),
+      KOKKOS_LAMBDA(const int i, int& error) {
+        if (prefix(i) != long(i) * (i - 1) / 2) ++error;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, host_pool_barrier) {
+  if (!Kokkos::SpaceAccessibility<TEST_EXECSPACE,
+                                  Kokkos::HostSpace>::accessible) {
+    GTEST_SKIP() << "only the host backends rendezvous through a pool barrier";
+  }
+  test_host_pool_barrier<TEST_EXECSPACE>(Kokkos::Impl::HostPoolBarrier::tree);
+  test_host_pool_barrier<TEST_EXECSPACE>(
+      Kokkos::Impl::HostPoolBarrier::centralized);
+}
+
+}  // namespace Test
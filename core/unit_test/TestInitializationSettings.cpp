@@ -51,6 +51,8 @@ constexpr bool test_initialization_settings_getter() {
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(device_id, int);
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(disable_warnings, bool);
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(tune_internals, bool);
+  CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(host_barrier, std::string);
+  CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(threads_spin_budget, int);
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(tools_help, bool);
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(tools_libs, std::string);
   CHECK_INITIALIZATION_SETTINGS_GETTER_RETURN_TYPE(tools_args, std::string);
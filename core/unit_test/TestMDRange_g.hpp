@@ -73,6 +73,79 @@ struct TestMDRangeLargeDeepCopy {
   }
 };
 
+template <typename ExecutionSpace>
+struct TestMDRangeTileLocality {
+  using HintTileLocality_t =
+      Kokkos::Experimental::WorkItemProperty::HintTileLocality_t;
+
+  template <typename Rank>
+  using policy_type =
+      Kokkos::MDRangePolicy<ExecutionSpace, Rank, HintTileLocality_t>;
+
+  static void test_rank_2(int n0, int n1, int t0, int t1) {
+    Kokkos::View<int**, ExecutionSpace> hits("hits", n0, n1);
+    policy_type<Kokkos::Rank<2>> policy({0, 0}, {n0, n1}, {t0, t1});
+
+    Kokkos::parallel_for(
+        policy, KOKKOS_LAMBDA(const int i, const int j) {
+          Kokkos::atomic_inc(&hits(i, j));
+        });
+
+    long sum = 0;
+    Kokkos::parallel_reduce(
+        policy,
+        KOKKOS_LAMBDA(const int i, const int j, long& update) {
+          update += hits(i, j) * (i * n1 + j);
+        },
+        sum);
+    ASSERT_EQ(sum, long(n0) * n1 * (long(n0) * n1 - 1) / 2);
+
+    int wrong = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>({0, 0},
+                                                               {n0, n1}),
+        KOKKOS_LAMBDA(const int i, const int j, int& update) {
+          if (hits(i, j) != 1) ++update;
+        },
+        wrong);
+    ASSERT_EQ(wrong, 0);
+  }
+
+  static void test_rank_3(int n0, int n1, int n2, int t0, int t1, int t2) {
+    Kokkos::View<int***, ExecutionSpace> hits("hits", n0, n1, n2);
+    policy_type<Kokkos::Rank<3, Kokkos::Iterate::Left, Kokkos::Iterate::Left>>
+        policy({0, 0, 0}, {n0, n1, n2}, {t0, t1, t2});
+
+    Kokkos::parallel_for(
+        policy, KOKKOS_LAMBDA(const int i, const int j, const int k) {
+          Kokkos::atomic_inc(&hits(i, j, k));
+        });
+
+    int wrong = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<3>>(
+            {0, 0, 0}, {n0, n1, n2}),
+        KOKKOS_LAMBDA(const int i, const int j, const int k, int& update) {
+          if (hits(i, j, k) != 1) ++update;
+        },
+        wrong);
+    ASSERT_EQ(wrong, 0);
+  }
+
+  static void run() {
+    test_rank_2(64, 64, 4, 4);
+    test_rank_2(37, 101, 4, 8);
+    test_rank_2(3, 1000, 2, 3);
+    test_rank_2(1, 17, 1, 1);
+    test_rank_3(13, 7, 29, 2, 2, 2);
+    test_rank_3(50, 3, 9, 3, 1, 4);
+  }
+};
+
+TEST(TEST_CATEGORY, mdrange_tile_locality) {
+  TestMDRangeTileLocality<TEST_EXECSPACE>::run();
+}
+
 // Check that deep_copy with a large range for a dimension different from the
 // first one works successfully. There was a problem with this in the Cuda
 // backend.
@@ -192,6 +192,32 @@ TEST(defaultdevicetype, cmd_line_args_tune_internals) {
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
+TEST(defaultdevicetype, cmd_line_args_host_barrier) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-host-barrier=centralized",
+      "--dummy",
+      "--kokkos-host-barrier=tree",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_host_barrier());
+  EXPECT_EQ(settings.get_host_barrier(), "tree");
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--dummy"});
+}
+
+TEST(defaultdevicetype, cmd_line_args_threads_spin_budget) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-threads-spin-budget=128",
+      "--dummy",
+      "--kokkos-threads-spin-budget=-1",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_threads_spin_budget());
+  EXPECT_EQ(settings.get_threads_spin_budget(), -1);
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--dummy"});
+}
+
 TEST(defaultdevicetype, cmd_line_args_help) {
   CmdLineArgsHelper cla = {{
       "--help",
@@ -389,6 +415,31 @@ TEST(defaultdevicetype, env_vars_tune_internals) {
   }
 }
 
+TEST(defaultdevicetype, env_vars_host_barrier) {
+  for (auto const& value : {"auto", "centralized", "tree"}) {
+    EnvVarsHelper ev = {{
+        {"KOKKOS_HOST_BARRIER", value},
+    }};
+    SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+    Kokkos::InitializationSettings settings;
+    Kokkos::Impl::parse_environment_variables(settings);
+    EXPECT_TRUE(settings.has_host_barrier()) << "KOKKOS_HOST_BARRIER=" << value;
+    EXPECT_EQ(settings.get_host_barrier(), value)
+        << "KOKKOS_HOST_BARRIER=" << value;
+  }
+}
+
+TEST(defaultdevicetype, env_vars_threads_spin_budget) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_THREADS_SPIN_BUDGET", "256"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_threads_spin_budget());
+  EXPECT_EQ(settings.get_threads_spin_budget(), 256);
+}
+
 TEST(defaultdevicetype, visible_devices) {
 #define KOKKOS_TEST_VISIBLE_DEVICES(ENV, CNT, DEV)                      \
   do {                                                                  \
@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+namespace {
+
+struct PrefetchTag {};
+
+template <class ExecSpace>
+struct TestPrefetchGather {
+  using view_type = Kokkos::View<int*, ExecSpace>;
+
+  view_type indices;
+  view_type values;
+  view_type gathered;
+  view_type prefetched;
+
+  KOKKOS_FUNCTION void prefetch(const int i) const {
+    Kokkos::Experimental::prefetch(values, indices(i));
+    prefetched(i) += 1;
+  }
+
+  KOKKOS_FUNCTION void operator()(const int i) const {
+    gathered(i) = values(indices(i));
+  }
+
+  KOKKOS_FUNCTION void prefetch(PrefetchTag, const int i) const {
+    prefetch(i);
+  }
+
+  KOKKOS_FUNCTION void operator()(PrefetchTag, const int i) const {
+    gathered(i) = -values(indices(i));
+  }
+};
+
+template <class Policy>
+void test_prefetch_distance(const int sign) {
+  using execution_space = typename Policy::execution_space;
+  using functor_type    = TestPrefetchGather<execution_space>;
+  constexpr int n       = 100;
+  constexpr int begin   = Policy::traits::prefetch_distance / 2;
+
+  functor_type functor{typename functor_type::view_type("indices", n),
+                       typename functor_type::view_type("values", n),
+                       typename functor_type::view_type("gathered", n),
+                       typename functor_type::view_type("prefetched", n)};
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n), KOKKOS_LAMBDA(const int i) {
+        functor.indices(i) = (7 * i) % n;
+        functor.values(i)  = 3 * i + 1;
+      });
+  Kokkos::parallel_for(Policy(begin, n), functor);
+
+  auto gathered = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      functor.gathered);
+  auto prefetched = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                        functor.prefetched);
+  constexpr bool issues_prefetches =
+      Kokkos::SpaceAccessibility<execution_space,
+                                 Kokkos::HostSpace>::accessible;
+  constexpr int first_prefetched = begin + Policy::traits::prefetch_distance;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(gathered(i), i < begin ? 0 : sign * (3 * ((7 * i) % n) + 1));
+    ASSERT_EQ(prefetched(i), int(issues_prefetches && i >= first_prefetched));
+  }
+}
+
+template <class ViewType>
+void test_prefetch_view(const ViewType& view) {
+  using execution_space = typename ViewType::execution_space;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1), KOKKOS_LAMBDA(int) {
+        if constexpr (ViewType::rank == 0) {
+          Kokkos::Experimental::prefetch(view);
+        } else if constexpr (ViewType::rank == 1) {
+          Kokkos::Experimental::prefetch(view, 1);
+        } else if constexpr (ViewType::rank == 2) {
+          Kokkos::Experimental::prefetch(view, 1, 2);
+        } else {
+          Kokkos::Experimental::prefetch(view, 1, 2, 3);
+        }
+      });
+  Kokkos::fence();
+}
+
+TEST(TEST_CATEGORY, prefetch_distance_trait) {
+  using Kokkos::Experimental::PrefetchDistance;
+  test_prefetch_distance<
+      Kokkos::RangePolicy<TEST_EXECSPACE, PrefetchDistance<1>>>(1);
+  test_prefetch_distance<
+      Kokkos::RangePolicy<TEST_EXECSPACE, PrefetchDistance<16>>>(1);
+  test_prefetch_distance<
+      Kokkos::RangePolicy<TEST_EXECSPACE, PrefetchTag, PrefetchDistance<8>>>(
+      -1);
+  test_prefetch_distance<
+      Kokkos::RangePolicy<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic>,
+                          PrefetchDistance<4>>>(1);
+
+  static_assert(Kokkos::RangePolicy<TEST_EXECSPACE>::prefetch_distance == 0);
+  static_assert(!Kokkos::Impl::is_host_prefetch_policy<
+                Kokkos::RangePolicy<TEST_EXECSPACE>>::value);
+}
+
+TEST(TEST_CATEGORY, prefetch_view) {
+  test_prefetch_view(Kokkos::View<double, TEST_EXECSPACE>("r0"));
+  test_prefetch_view(Kokkos::View<double*, TEST_EXECSPACE>("r1", 4));
+  test_prefetch_view(Kokkos::View<int**, Kokkos::LayoutLeft, TEST_EXECSPACE>(
+      "r2", 4, 4));
+  test_prefetch_view(Kokkos::View<const float***, TEST_EXECSPACE>(
+      Kokkos::View<float***, TEST_EXECSPACE>("r3", 4, 4, 4)));
+  Kokkos::View<double**, TEST_EXECSPACE> strided("strided", 4, 8);
+  test_prefetch_view(Kokkos::subview(strided, Kokkos::ALL, std::pair(2, 6)));
+  test_prefetch_view(Kokkos::View<double*, TEST_EXECSPACE,
+                                  Kokkos::MemoryTraits<Kokkos::Atomic>>(
+      "atomic", 4));
+}
+
+}  // namespace
@@ -400,6 +400,61 @@ TEST(TEST_CATEGORY, team_handle_by_value) {
   { TestTeamPolicyHandleByValue<TEST_EXECSPACE>(); }
 }
 
+/*! \brief Test that a dynamically scheduled league with very uneven per-team
+           costs executes every league rank exactly once
+*/
+template <typename ExecutionSpace>
+struct TestTeamDynamicSkewed {
+  using team_policy_t =
+      Kokkos::TeamPolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>;
+  using member_t     = typename team_policy_t::member_type;
+  using memory_space = typename ExecutionSpace::memory_space;
+  using view_t       = Kokkos::View<int*, memory_space>;
+
+  view_t m_count;
+  view_t m_sink;
+
+  // The first eighth of the league is much more expensive than the rest
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t& t) const {
+    const int league_rank = t.league_rank();
+    const int work        = league_rank < t.league_size() / 8 ? 2000 : 1;
+    int sum               = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(t, work),
+        [=](const int i, int& update) { update += i % 7; }, sum);
+    Kokkos::single(Kokkos::PerTeam(t), [&]() {
+      Kokkos::atomic_inc(&m_count(league_rank));
+      m_sink(league_rank) = sum;
+    });
+  }
+
+  void run(const int league_size, const int team_size, const int chunk_size) {
+    m_count = view_t("count", league_size);
+    m_sink  = view_t("sink", league_size);
+    team_policy_t policy(league_size, team_size);
+    policy.set_chunk_size(chunk_size);
+    Kokkos::parallel_for(policy, *this);
+
+    int errors = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<ExecutionSpace>(0, league_size),
+        KOKKOS_CLASS_LAMBDA(const int i, int& update) {
+          if (m_count(i) != 1) ++update;
+        },
+        errors);
+    EXPECT_EQ(errors, 0);
+  }
+};
+
+TEST(TEST_CATEGORY, team_dynamic_skewed) {
+  const int team_size = std::min(2, TEST_EXECSPACE().concurrency());
+  for (const int chunk_size : {1, 3, 16}) {
+    TestTeamDynamicSkewed<TEST_EXECSPACE>().run(1000, 1, chunk_size);
+    TestTeamDynamicSkewed<TEST_EXECSPACE>().run(777, team_size, chunk_size);
+  }
+}
+
 }  // namespace Test
 
 #ifndef KOKKOS_ENABLE_OPENMPTARGET
@@ -237,4 +237,145 @@ TEST(TEST_CATEGORY, view_copy_degenerated) {
   Kokkos::deep_copy(v_m_1, v_m_def_2);
   Kokkos::deep_copy(v_m_1, v_m_2);
 }
+
+// Halo packing of a 3D domain: the copies of the subviews have long
+// contiguous inner runs in both views, which are copied with memcpy on the
+// host.
+template <class Layout>
+void test_view_copy_contiguous_runs() {
+  using view_type = Kokkos::View<double***, Layout, TEST_EXECSPACE>;
+  const int n0 = 67, n1 = 13, n2 = 67;
+  view_type a("A", n0, n1, n2);
+  auto h_a = Kokkos::create_mirror_view(a);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < n1; ++j)
+      for (int k = 0; k < n2; ++k) h_a(i, j, k) = 10000 * i + 100 * j + k;
+  Kokkos::deep_copy(a, h_a);
+
+  constexpr bool left = std::is_same_v<Layout, Kokkos::LayoutLeft>;
+  const auto range     = Kokkos::make_pair(2, 9);
+  // the face is contiguous in each row, the runs of the whole face collapse
+  // into one in the buffer, the runs of the block stay separate
+  Kokkos::View<double**, Kokkos::LayoutStride, TEST_EXECSPACE> face;
+  Kokkos::View<double**, Kokkos::LayoutStride, TEST_EXECSPACE> other_face;
+  Kokkos::View<double***, Kokkos::LayoutStride, TEST_EXECSPACE> block;
+  if constexpr (left) {
+    face       = Kokkos::subview(a, Kokkos::ALL, range, 3);
+    other_face = Kokkos::subview(a, Kokkos::ALL, range, 7);
+    block      = Kokkos::subview(a, Kokkos::ALL, range, range);
+  } else {
+    face       = Kokkos::subview(a, 3, range, Kokkos::ALL);
+    other_face = Kokkos::subview(a, 7, range, Kokkos::ALL);
+    block      = Kokkos::subview(a, range, range, Kokkos::ALL);
+  }
+  Kokkos::View<double**, Layout, TEST_EXECSPACE> face_buffer(
+      "face_buffer", face.extent(0), face.extent(1));
+  Kokkos::View<double***, Layout, TEST_EXECSPACE> block_buffer(
+      "block_buffer", block.extent(0), block.extent(1), block.extent(2));
+  Kokkos::deep_copy(face_buffer, face);
+  Kokkos::deep_copy(TEST_EXECSPACE(), block_buffer, block);
+
+  auto h_face  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     face_buffer);
+  auto h_block = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     block_buffer);
+  for (int i = 0; i < int(h_face.extent(0)); ++i)
+    for (int j = 0; j < int(h_face.extent(1)); ++j)
+      ASSERT_EQ(h_face(i, j), left ? h_a(i, j + 2, 3) : h_a(3, i + 2, j));
+  for (int i = 0; i < int(h_block.extent(0)); ++i)
+    for (int j = 0; j < int(h_block.extent(1)); ++j)
+      for (int k = 0; k < int(h_block.extent(2)); ++k)
+        ASSERT_EQ(h_block(i, j, k), left ? h_a(i, j + 2, k + 2)
+                                         : h_a(i + 2, j + 2, k));
+
+  // unpack into the opposite face
+  Kokkos::deep_copy(other_face, face_buffer);
+  Kokkos::deep_copy(h_a, a);
+  for (int i = 0; i < int(h_face.extent(0)); ++i)
+    for (int j = 0; j < int(h_face.extent(1)); ++j)
+      ASSERT_EQ(left ? h_a(i, j + 2, 7) : h_a(7, i + 2, j), h_face(i, j));
+}
+
+// the strides of LayoutTiled are the ones within a tile, the copies between
+// tiled and strided views must not take the contiguous runs for the views
+template <class ExecSpace>
+void test_view_copy_contiguous_runs_tiled() {
+  using tiled_layout =
+      Kokkos::Experimental::LayoutTiled<Kokkos::Iterate::Left,
+                                        Kokkos::Iterate::Left, 4, 4>;
+  using tiled_view_type = Kokkos::View<double**, tiled_layout, ExecSpace>;
+  using left_view_type  = Kokkos::View<double**, Kokkos::LayoutLeft, ExecSpace>;
+  const int n = 64;
+  tiled_view_type tiled("tiled", n, n);
+  left_view_type left("left", n, n);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {n, n}),
+      KOKKOS_LAMBDA(const int i, const int j) { tiled(i, j) = 100 * i + j; });
+
+  // tiled to strided, checked through the strided view
+  Kokkos::deep_copy(left, tiled);
+  auto h_left = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), left);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) ASSERT_EQ(h_left(i, j), 100 * i + j);
+
+  // strided to tiled, checked through the tiled view
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {n, n}),
+      KOKKOS_LAMBDA(const int i, const int j) { left(i, j) = i - 100 * j; });
+  Kokkos::deep_copy(tiled, left);
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {n, n}),
+      KOKKOS_LAMBDA(const int i, const int j, int& error) {
+        if (tiled(i, j) != i - 100 * j) ++error;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+// copies every run in several pieces, the last piece of a run is shorter
+template <class ExecSpace>
+void test_view_copy_contiguous_runs_pieces() {
+  // the functor only runs on the host
+  if constexpr (Kokkos::SpaceAccessibility<ExecSpace,
+                                           Kokkos::HostSpace>::accessible) {
+    using view_type = Kokkos::View<double**, Kokkos::LayoutLeft, ExecSpace>;
+    const int64_t run_length = 1000, runs = 3, pieces = 3;
+    view_type src("src", run_length + 5, runs);
+    view_type dst("dst", run_length, runs);
+    auto src_runs = Kokkos::subview(
+        src, Kokkos::make_pair(int64_t(0), run_length), Kokkos::ALL);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, runs), KOKKOS_LAMBDA(int j) {
+          for (int i = 0; i < run_length; ++i) src(i, j) = 10000 * j + i;
+        });
+
+    Kokkos::Impl::ViewCopyContiguousRuns<double, 2> functor;
+    functor.dst            = dst.data();
+    functor.src            = src_runs.data();
+    functor.run_length     = run_length;
+    functor.piece_length   = (run_length + pieces - 1) / pieces;
+    functor.pieces         = pieces;
+    functor.outer_rank     = 1;
+    functor.extents[0]     = runs;
+    functor.dst_strides[0] = dst.stride(1);
+    functor.src_strides[0] = src_runs.stride(1);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<int64_t>>(
+            0, runs * pieces),
+        functor);
+    Kokkos::fence();
+
+    for (int j = 0; j < runs; ++j)
+      for (int i = 0; i < run_length; ++i)
+        ASSERT_EQ(dst(i, j), 10000 * j + i);
+  }
+}
+
+TEST(TEST_CATEGORY, view_copy_contiguous_runs) {
+  test_view_copy_contiguous_runs<Kokkos::LayoutLeft>();
+  test_view_copy_contiguous_runs<Kokkos::LayoutRight>();
+  test_view_copy_contiguous_runs_tiled<TEST_EXECSPACE>();
+  test_view_copy_contiguous_runs_pieces<TEST_EXECSPACE>();
+}
 }  // namespace Test
@@ -0,0 +1,215 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace Test {
+
+namespace {
+
+template <class ViewType>
+struct FillTiled2D {
+  ViewType m_view;
+  KOKKOS_FUNCTION void operator()(int i0, int i1) const {
+    m_view(i0, i1) += 1000 * i0 + i1 + 1;
+  }
+};
+
+template <class ViewType>
+struct FillTiled3D {
+  ViewType m_view;
+  KOKKOS_FUNCTION void operator()(int i0, int i1, int i2) const {
+    m_view(i0, i1, i2) += 10000 * i0 + 100 * i1 + i2 + 1;
+  }
+};
+
+// Position of the tile (t0, t1, t2) in memory in units of tiles
+template <class Layout>
+size_t expected_tile_position(size_t const (&tiles)[3], size_t t0, size_t t1,
+                              size_t t2) {
+  return Layout::outer_pattern == Kokkos::Iterate::Left
+             ? t0 + tiles[0] * (t1 + tiles[1] * t2)
+             : (t0 * tiles[1] + t1) * tiles[2] + t2;
+}
+
+template <class Layout>
+void test_view_layout_tiled_2d(int n0, int n1) {
+  using view_type = Kokkos::View<int**, Layout, TEST_EXECSPACE>;
+  // the strides are those within a tile, they do not describe the addressing
+  static_assert(!Kokkos::Impl::ViewMapping<typename view_type::traits,
+                                           void>::is_regular::value);
+
+  view_type view("tiled", n0, n1);
+  Kokkos::parallel_for(Kokkos::Experimental::make_tiled_mdrange_policy(view),
+                       FillTiled2D<view_type>{view});
+
+  auto policy = Kokkos::Experimental::make_tiled_mdrange_policy(view);
+  ASSERT_EQ(policy.m_tile[0], static_cast<int64_t>(Layout::N0));
+  ASSERT_EQ(policy.m_tile[1], static_cast<int64_t>(Layout::N1));
+
+  size_t const tiles[3] = {(n0 + Layout::N0 - 1) / Layout::N0,
+                           (n1 + Layout::N1 - 1) / Layout::N1, 1};
+  ASSERT_EQ(view.span(), tiles[0] * tiles[1] * Layout::N0 * Layout::N1);
+  ASSERT_EQ(view.span_is_contiguous(), view.span() == view.size());
+
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+  ASSERT_EQ(host.layout(), view.layout());
+
+  // every entry is visited once by the tiled policy
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      ASSERT_EQ(host(i0, i1), 1000 * i0 + i1 + 1);
+
+  // every tile is contiguous, ordered by the inner pattern within the tile
+  // and by the outer pattern between tiles
+  for (size_t t0 = 0; t0 < tiles[0]; ++t0) {
+    for (size_t t1 = 0; t1 < tiles[1]; ++t1) {
+      auto tile = Kokkos::Experimental::tile_subview(host, t0, t1);
+      static_assert(decltype(tile)::rank == 2);
+      static_assert(decltype(tile)::static_extent(0) == Layout::N0);
+      static_assert(decltype(tile)::static_extent(1) == Layout::N1);
+      ASSERT_EQ(tile.data(),
+                host.data() + expected_tile_position<Layout>(tiles, t0, t1, 0) *
+                                  Layout::N0 * Layout::N1);
+      for (size_t l0 = 0; l0 < Layout::N0; ++l0) {
+        for (size_t l1 = 0; l1 < Layout::N1; ++l1) {
+          size_t const local = Layout::inner_pattern == Kokkos::Iterate::Left
+                                   ? l0 + Layout::N0 * l1
+                                   : l0 * Layout::N1 + l1;
+          ASSERT_EQ(&tile(l0, l1), tile.data() + local);
+          size_t const i0 = t0 * Layout::N0 + l0;
+          size_t const i1 = t1 * Layout::N1 + l1;
+          if (i0 < size_t(n0) && i1 < size_t(n1)) {
+            ASSERT_EQ(&tile(l0, l1), &host(i0, i1));
+          }
+        }
+      }
+    }
+  }
+
+  // deep_copy to and from a regular layout
+  Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE> right("right", n0,
+                                                                 n1);
+  Kokkos::deep_copy(right, view);
+  view_type copy("copy", n0, n1);
+  Kokkos::deep_copy(copy, right);
+  auto host_copy =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), copy);
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      ASSERT_EQ(host_copy(i0, i1), host(i0, i1));
+
+  Kokkos::deep_copy(copy, 7);
+  Kokkos::deep_copy(host_copy, copy);
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1) ASSERT_EQ(host_copy(i0, i1), 7);
+
+#ifdef KOKKOS_ENABLE_IMPL_MDSPAN
+  auto mds = host.to_mdspan();
+  ASSERT_EQ(mds.mapping().required_span_size(), host.span());
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1) ASSERT_EQ(&mds(i0, i1), &host(i0, i1));
+#endif
+}
+
+template <class Layout>
+void test_view_layout_tiled_3d(int n0, int n1, int n2) {
+  using view_type = Kokkos::View<int***, Layout, TEST_EXECSPACE>;
+
+  view_type view("tiled", n0, n1, n2);
+  Kokkos::parallel_for(Kokkos::Experimental::make_tiled_mdrange_policy(view),
+                       FillTiled3D<view_type>{view});
+
+  size_t const tiles[3] = {(n0 + Layout::N0 - 1) / Layout::N0,
+                           (n1 + Layout::N1 - 1) / Layout::N1,
+                           (n2 + Layout::N2 - 1) / Layout::N2};
+  ASSERT_EQ(view.span(), tiles[0] * tiles[1] * tiles[2] * Layout::N0 *
+                             Layout::N1 * Layout::N2);
+
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      for (int i2 = 0; i2 < n2; ++i2)
+        ASSERT_EQ(host(i0, i1, i2), 10000 * i0 + 100 * i1 + i2 + 1);
+
+  for (size_t t0 = 0; t0 < tiles[0]; ++t0) {
+    for (size_t t1 = 0; t1 < tiles[1]; ++t1) {
+      for (size_t t2 = 0; t2 < tiles[2]; ++t2) {
+        auto tile = Kokkos::Experimental::tile_subview(host, t0, t1, t2);
+        static_assert(decltype(tile)::rank == 3);
+        ASSERT_EQ(tile.data(),
+                  host.data() +
+                      expected_tile_position<Layout>(tiles, t0, t1, t2) *
+                          Layout::N0 * Layout::N1 * Layout::N2);
+        for (size_t l0 = 0; l0 < Layout::N0; ++l0) {
+          for (size_t l1 = 0; l1 < Layout::N1; ++l1) {
+            for (size_t l2 = 0; l2 < Layout::N2; ++l2) {
+              size_t const i0 = t0 * Layout::N0 + l0;
+              size_t const i1 = t1 * Layout::N1 + l1;
+              size_t const i2 = t2 * Layout::N2 + l2;
+              if (i0 < size_t(n0) && i1 < size_t(n1) && i2 < size_t(n2)) {
+                ASSERT_EQ(&tile(l0, l1, l2), &host(i0, i1, i2));
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  Kokkos::View<int***, Kokkos::LayoutLeft, TEST_EXECSPACE> left("left", n0, n1,
+                                                                n2);
+  Kokkos::deep_copy(left, view);
+  auto host_left =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), left);
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      for (int i2 = 0; i2 < n2; ++i2)
+        ASSERT_EQ(host_left(i0, i1, i2), host(i0, i1, i2));
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, view_layout_tiled_2d) {
+  using Kokkos::Iterate;
+  using Kokkos::Experimental::LayoutTiled;
+  test_view_layout_tiled_2d<LayoutTiled<Iterate::Left, Iterate::Left, 4, 8>>(
+      13, 21);
+  test_view_layout_tiled_2d<LayoutTiled<Iterate::Right, Iterate::Right, 4, 8>>(
+      13, 21);
+  test_view_layout_tiled_2d<LayoutTiled<Iterate::Left, Iterate::Right, 2, 4>>(
+      8, 16);
+  test_view_layout_tiled_2d<LayoutTiled<Iterate::Right, Iterate::Left, 8, 2>>(
+      5, 3);
+  test_view_layout_tiled_2d<LayoutTiled<Iterate::Right, Iterate::Right, 4, 4>>(
+      0, 7);
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_3d) {
+  using Kokkos::Iterate;
+  using Kokkos::Experimental::LayoutTiled;
+  test_view_layout_tiled_3d<
+      LayoutTiled<Iterate::Left, Iterate::Left, 2, 4, 2>>(5, 9, 3);
+  test_view_layout_tiled_3d<
+      LayoutTiled<Iterate::Right, Iterate::Right, 4, 2, 4>>(7, 4, 10);
+  test_view_layout_tiled_3d<
+      LayoutTiled<Iterate::Right, Iterate::Left, 2, 2, 8>>(3, 5, 8);
+}
+
+}  // namespace Test
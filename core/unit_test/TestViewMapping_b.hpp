@@ -102,6 +102,76 @@ TEST(TEST_CATEGORY, view_mapping_atomic) {
   f.run();
 }
 
+template <class Space>
+struct TestViewMappingStreamingStore {
+  using ExecSpace = typename Space::execution_space;
+
+  using mem_trait = Kokkos::MemoryTraits<Kokkos::StreamingStore>;
+
+  using T        = Kokkos::View<double **, ExecSpace>;
+  using T_stream = Kokkos::View<double **, ExecSpace, mem_trait>;
+
+  T x;
+  T_stream x_stream;
+  T_stream y_stream;
+
+  enum { N0 = 1000, N1 = 3 };
+
+  struct TagInit {};
+  struct TagUpdate {};
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagInit &, const int i) const {
+    for (int j = 0; j < N1; ++j) y_stream(i, j) = 10 * i + j;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagUpdate &, const int i) const {
+    x_stream(i, 0) = y_stream(i, 0);
+    x_stream(i, 1) = 2 * y_stream(i, 1);
+    x_stream(i, 2) += y_stream(i, 2);
+  }
+
+  TestViewMappingStreamingStore()
+      : x("x", N0, N1), x_stream(x), y_stream("y", N0, N1) {}
+
+  void run() {
+    ASSERT_TRUE(T::reference_type_is_lvalue_reference);
+    ASSERT_FALSE(T_stream::reference_type_is_lvalue_reference);
+
+    // fills with zero and non-zero values of the contiguous view and of a
+    // column of it
+    Kokkos::deep_copy(x_stream, 0.0);
+    Kokkos::deep_copy(Kokkos::subview(x_stream, Kokkos::ALL, 2), 1.0);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace, TagInit>(0, N0), *this);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace, TagUpdate>(0, N0),
+                         *this);
+
+    auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    for (int i = 0; i < N0; ++i) {
+      ASSERT_EQ(x_host(i, 0), 10 * i);
+      ASSERT_EQ(x_host(i, 1), 2 * (10 * i + 1));
+      ASSERT_EQ(x_host(i, 2), 10 * i + 3);
+    }
+
+    // copies into the contiguous view and into a column of it
+    Kokkos::deep_copy(x_stream, y_stream);
+    Kokkos::deep_copy(Kokkos::subview(x_stream, Kokkos::ALL, 1),
+                      Kokkos::subview(y_stream, Kokkos::ALL, 0));
+    Kokkos::deep_copy(x_host, x);
+    for (int i = 0; i < N0; ++i) {
+      ASSERT_EQ(x_host(i, 0), 10 * i);
+      ASSERT_EQ(x_host(i, 1), 10 * i);
+      ASSERT_EQ(x_host(i, 2), 10 * i + 2);
+    }
+  }
+};
+
+TEST(TEST_CATEGORY, view_mapping_streaming_store) {
+  TestViewMappingStreamingStore<TEST_EXECSPACE> f;
+  f.run();
+}
+
 }  // namespace Test
 
 /*--------------------------------------------------------------------------*/
@@ -2149,6 +2149,7 @@ inline void test_subview_memory_traits_construction() {
   // Atomic (4)
   // Restricted (8)
   // Aligned (16)
+  // StreamingStore (32)
   TestSubviewMemoryTraitsConstruction<0>()();
   TestSubviewMemoryTraitsConstruction<1>()();
   TestSubviewMemoryTraitsConstruction<2>()();
@@ -2181,6 +2182,38 @@ inline void test_subview_memory_traits_construction() {
   TestSubviewMemoryTraitsConstruction<29>()();
   TestSubviewMemoryTraitsConstruction<30>()();
   TestSubviewMemoryTraitsConstruction<31>()();
+  TestSubviewMemoryTraitsConstruction<32>()();
+  TestSubviewMemoryTraitsConstruction<33>()();
+  TestSubviewMemoryTraitsConstruction<34>()();
+  TestSubviewMemoryTraitsConstruction<35>()();
+  TestSubviewMemoryTraitsConstruction<36>()();
+  TestSubviewMemoryTraitsConstruction<37>()();
+  TestSubviewMemoryTraitsConstruction<38>()();
+  TestSubviewMemoryTraitsConstruction<39>()();
+  TestSubviewMemoryTraitsConstruction<40>()();
+  TestSubviewMemoryTraitsConstruction<41>()();
+  TestSubviewMemoryTraitsConstruction<42>()();
+  TestSubviewMemoryTraitsConstruction<43>()();
+  TestSubviewMemoryTraitsConstruction<44>()();
+  TestSubviewMemoryTraitsConstruction<45>()();
+  TestSubviewMemoryTraitsConstruction<46>()();
+  TestSubviewMemoryTraitsConstruction<47>()();
+  TestSubviewMemoryTraitsConstruction<48>()();
+  TestSubviewMemoryTraitsConstruction<49>()();
+  TestSubviewMemoryTraitsConstruction<50>()();
+  TestSubviewMemoryTraitsConstruction<51>()();
+  TestSubviewMemoryTraitsConstruction<52>()();
+  TestSubviewMemoryTraitsConstruction<53>()();
+  TestSubviewMemoryTraitsConstruction<54>()();
+  TestSubviewMemoryTraitsConstruction<55>()();
+  TestSubviewMemoryTraitsConstruction<56>()();
+  TestSubviewMemoryTraitsConstruction<57>()();
+  TestSubviewMemoryTraitsConstruction<58>()();
+  TestSubviewMemoryTraitsConstruction<59>()();
+  TestSubviewMemoryTraitsConstruction<60>()();
+  TestSubviewMemoryTraitsConstruction<61>()();
+  TestSubviewMemoryTraitsConstruction<62>()();
+  TestSubviewMemoryTraitsConstruction<63>()();
 }
 
 //----------------------------------------------------------------------------
@@ -247,6 +247,67 @@ TEST(TEST_CATEGORY, deep_copy_zero_memset) {
   listen_tool_events(Config::DisableAll());
 }
 
+TEST(TEST_CATEGORY, host_zero_memset_large) {
+  if (!std::is_same_v<TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>)
+    GTEST_SKIP() << "only the default host execution space zeroes in parallel";
+
+  // large enough to be zeroed in parallel, with a range that starts and ends
+  // within a page
+  constexpr size_t n      = (1 << 20) + 13;
+  constexpr size_t offset = 5;
+  Kokkos::View<unsigned char*, Kokkos::HostSpace> bla(
+      Kokkos::view_alloc("bla", Kokkos::WithoutInitializing), n + 2 * offset);
+  Kokkos::deep_copy(bla, 0xff);
+
+  // the parallel memset is not reported as a kernel of its own
+  using namespace Kokkos::Test::Tools;
+  listen_tool_events(Config::DisableAll(), Config::EnableKernels());
+  auto success = validate_absence(
+      [&]() {
+        Kokkos::Impl::ZeroMemset<Kokkos::DefaultHostExecutionSpace>(
+            Kokkos::DefaultHostExecutionSpace{}, bla.data() + offset, n);
+      },
+      [&](BeginParallelForEvent) {
+        return MatchDiagnostic{true, {"Found begin event"}};
+      });
+  ASSERT_TRUE(success);
+  listen_tool_events(Config::DisableAll());
+  Kokkos::fence();
+
+  for (size_t i = 0; i < bla.size(); ++i) {
+    bool const zeroed = i >= offset && i < offset + n;
+    ASSERT_EQ(bla(i), zeroed ? 0 : 0xff) << "at index " << i;
+  }
+}
+
+TEST(TEST_CATEGORY, host_zero_memset_in_parallel_region) {
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+  if (!std::is_same_v<TEST_EXECSPACE, exec_space>)
+    GTEST_SKIP() << "only the default host execution space zeroes in parallel";
+  // a kernel on a single thread may not be a parallel region, where the
+  // memset fences the instance that runs it
+  int const concurrency = exec_space().concurrency();
+  if (concurrency == 1)
+    GTEST_SKIP() << "the execution space runs kernels on a single thread";
+
+  // every iteration zeroes a slice large enough to be zeroed in parallel
+  constexpr size_t n = 1 << 18;
+  Kokkos::View<unsigned char*, Kokkos::HostSpace> bla(
+      Kokkos::view_alloc("bla", Kokkos::WithoutInitializing), n * concurrency);
+  Kokkos::deep_copy(bla, 0xff);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, concurrency), [=](const int i) {
+        Kokkos::Impl::ZeroMemset<exec_space>(exec_space{}, bla.data() + i * n,
+                                             n);
+      });
+  Kokkos::fence();
+
+  for (size_t i = 0; i < bla.size(); ++i) {
+    ASSERT_EQ(bla(i), 0) << "at index " << i;
+  }
+}
+
 TEST(TEST_CATEGORY, resize_exec_space) {
   using namespace Kokkos::Test::Tools;
   listen_tool_events(Config::DisableAll(), Config::EnableFences(),
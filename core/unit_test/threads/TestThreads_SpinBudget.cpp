@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <TestThreads_Category.hpp>
+#include <Threads/Kokkos_Threads_Spinwait.hpp>
+
+#include <chrono>
+#include <thread>
+
+namespace Test {
+
+namespace {
+
+// Selects the spin budget and restores the previous one
+class ScopedSpinwaitBudget {
+  int m_previous;
+
+ public:
+  explicit ScopedSpinwaitBudget(int budget)
+      : m_previous(Kokkos::Impl::get_spinwait_budget()) {
+    Kokkos::Impl::set_spinwait_budget(budget);
+  }
+  ~ScopedSpinwaitBudget() { Kokkos::Impl::set_spinwait_budget(m_previous); }
+  ScopedSpinwaitBudget(ScopedSpinwaitBudget const&)            = delete;
+  ScopedSpinwaitBudget& operator=(ScopedSpinwaitBudget const&) = delete;
+};
+
+}  // namespace
+
+// With a zero budget the idle workers park on their state word right away,
+// every launch has to wake all of them.
+TEST(threads, spin_budget_parked_workers_wake) {
+  if (Kokkos::Impl::get_spinwait_budget() < 0) {
+    GTEST_SKIP() << "restoring a negative budget would strand the parked "
+                    "workers";
+  }
+  ScopedSpinwaitBudget scoped_budget(0);
+
+  const int concurrency = Kokkos::Threads().concurrency();
+  Kokkos::View<int*, Kokkos::Threads> launches("launches", concurrency);
+  const int n = 3;
+  for (int launch = 0; launch < n; ++launch) {
+    // leave the workers idle long enough to park
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // one iteration per thread, each thread counts its own launches
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::Threads, Kokkos::Schedule<Kokkos::Static>>(
+            0, concurrency)
+            .set_chunk_size(1),
+        KOKKOS_LAMBDA(const int) {
+          ++launches(Kokkos::Threads::impl_thread_pool_rank());
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    long sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::Threads>(0, 1000),
+        KOKKOS_LAMBDA(const int i, long& update) { update += i; }, sum);
+    ASSERT_EQ(sum, 1000L * 999 / 2);
+  }
+
+  auto launches_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), launches);
+  for (int rank = 0; rank < concurrency; ++rank) {
+    EXPECT_EQ(launches_host(rank), n) << "thread " << rank;
+  }
+}
+
+}  // namespace Test
@@ -194,6 +194,59 @@ TEST(kokkosp, kernel_name_parallel_reduce) {
 
 TEST(kokkosp, kernel_name_parallel_scan) { test_kernel_name_parallel_scan(); }
 
+void test_kernel_name_non_owning_labels() {
+  Kokkos::Tools::Experimental::set_begin_parallel_for_callback(
+      get_parallel_for_kernel_name);
+  Kokkos::Tools::Experimental::set_begin_parallel_reduce_callback(
+      get_parallel_reduce_kernel_name);
+  Kokkos::Tools::Experimental::set_begin_parallel_scan_callback(
+      get_parallel_scan_kernel_name);
+
+  using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+
+  {
+    // longer than the small string optimization buffer of common
+    // std::string implementations
+    char const* const my_label = "my_parallel_kernel_with_a_long_label";
+    std::string_view const my_label_view(my_label);
+
+    auto const my_for_lambda = KOKKOS_LAMBDA(int){};
+    Kokkos::parallel_for("my_parallel_kernel_with_a_long_label",
+                         Kokkos::RangePolicy<ExecutionSpace>(0, 1),
+                         my_for_lambda);
+    ASSERT_EQ(last_parallel_for, my_label);
+    last_parallel_for.clear();
+    Kokkos::parallel_for(my_label_view, 1, my_for_lambda);
+    ASSERT_EQ(last_parallel_for, my_label);
+
+    float my_result;
+    auto const my_reduce_lambda = KOKKOS_LAMBDA(int, float&){};
+    Kokkos::parallel_reduce(my_label, Kokkos::RangePolicy<ExecutionSpace>(0, 1),
+                            my_reduce_lambda, my_result);
+    ASSERT_EQ(last_parallel_reduce, my_label);
+    last_parallel_reduce.clear();
+    Kokkos::parallel_reduce(my_label_view, 1, my_reduce_lambda,
+                            Kokkos::Sum<float>(my_result));
+    ASSERT_EQ(last_parallel_reduce, my_label);
+
+    auto const my_scan_lambda = KOKKOS_LAMBDA(int, float&, bool){};
+    Kokkos::parallel_scan(my_label, Kokkos::RangePolicy<ExecutionSpace>(0, 1),
+                          my_scan_lambda);
+    ASSERT_EQ(last_parallel_scan, my_label);
+    last_parallel_scan.clear();
+    Kokkos::parallel_scan(my_label_view, 1, my_scan_lambda, my_result);
+    ASSERT_EQ(last_parallel_scan, my_label);
+  }
+
+  Kokkos::Tools::Experimental::set_begin_parallel_for_callback(nullptr);
+  Kokkos::Tools::Experimental::set_begin_parallel_reduce_callback(nullptr);
+  Kokkos::Tools::Experimental::set_begin_parallel_scan_callback(nullptr);
+}
+
+TEST(kokkosp, kernel_name_non_owning_labels) {
+  test_kernel_name_non_owning_labels();
+}
+
 TEST(kokkosp, kernel_name_internal) {
   struct ThisType {};
   {
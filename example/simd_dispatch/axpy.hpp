@@ -0,0 +1,54 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_EXAMPLE_SIMD_DISPATCH_AXPY_HPP
+#define KOKKOS_EXAMPLE_SIMD_DISPATCH_AXPY_HPP
+
+#include <Kokkos_SIMD_Types.hpp>
+
+namespace {
+
+// y = a * x + y on a block of the arrays, written once for all the simd ABIs.
+// The kernel only uses the simd types on raw pointers and has internal
+// linkage, so the translation units compiled for the wider instruction sets
+// emit no function the rest of the program could link to. The parallel loop
+// over the blocks is in main.cpp, compiled for the configured architecture.
+template <class Abi>
+void axpy_block(double a, double const* x, double* y, int n) {
+  using simd_type     = Kokkos::Experimental::simd<double, Abi>;
+  constexpr int width = simd_type::size();
+  simd_type const as(a);
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    simd_type xs;
+    simd_type ys;
+    xs.copy_from(x + i, Kokkos::Experimental::simd_flag_default);
+    ys.copy_from(y + i, Kokkos::Experimental::simd_flag_default);
+    ys = as * xs + ys;
+    ys.copy_to(y + i, Kokkos::Experimental::simd_flag_default);
+  }
+  for (; i < n; ++i) y[i] = a * x[i] + y[i];
+}
+
+}  // namespace
+
+// The versions of the dispatch, each one in a translation unit compiled for
+// its instruction set.
+void axpy_scalar(double a, double const* x, double* y, int n);
+void axpy_avx2(double a, double const* x, double* y, int n);
+void axpy_avx512(double a, double const* x, double* y, int n);
+
+#endif
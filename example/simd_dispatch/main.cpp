@@ -0,0 +1,70 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include "axpy.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+void axpy_scalar(double a, double const* x, double* y, int n) {
+  using Kokkos::Experimental::simd_isa;
+  using Kokkos::Experimental::simd_abi::for_isa;
+  axpy_block<for_isa<simd_isa::scalar>>(a, x, y, n);
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  using Kokkos::Experimental::simd_isa;
+  Kokkos::Experimental::simd_dispatch<void(double, double const*, double*,
+                                           int)>
+      dispatch(axpy_scalar);
+  dispatch.add(simd_isa::avx2, axpy_avx2).add(simd_isa::avx512, axpy_avx512);
+
+  char const* const names[] = {"scalar", "AVX2", "AVX-512", "NEON"};
+  std::printf("running the %s version of axpy\n",
+              names[static_cast<int>(Kokkos::Experimental::host_simd_isa())]);
+
+  int const n = 1000003;
+  std::vector<double> x(n);
+  std::vector<double> y(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = i;
+    y[i] = 1;
+  }
+  // the parallel loop runs the selected version on blocks of the arrays
+  int const block_size   = 4096;
+  int const num_blocks   = (n + block_size - 1) / block_size;
+  double const* const xp = x.data();
+  double* const yp       = y.data();
+  Kokkos::parallel_for(
+      "axpy",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_blocks),
+      [=](int block) {
+        int const begin = block * block_size;
+        dispatch(2.0, xp + begin, yp + begin, std::min(block_size, n - begin));
+      });
+  Kokkos::fence();
+
+  int num_errors = 0;
+  for (int i = 0; i < n; ++i) num_errors += y[i] != 2.0 * i + 1;
+  std::printf("%d errors\n", num_errors);
+  return num_errors == 0 ? 0 : 1;
+}
@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 #include <Kokkos_SIMD_Common.hpp>
 #include <Kokkos_BitManipulation.hpp>  // bit_cast
@@ -1493,7 +1494,7 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1524,11 +1525,11 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
       simd<std::uint64_t, abi_type> const& other);
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m128i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -1692,7 +1693,7 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<8>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx2_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1725,11 +1726,11 @@ class simd<std::int32_t, simd_abi::avx2_fixed_size<8>> {
       __m256i const& value_in)
       : m_value(value_in) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m256i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -1895,7 +1896,7 @@ class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::int64_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1929,11 +1930,11 @@ class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
       simd<std::int32_t, abi_type> const& other)
       : m_value(_mm256_cvtepi32_epi64(static_cast<__m128i>(other))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m256i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -2112,7 +2113,7 @@ class simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> {
   using value_type = std::uint64_t;
   using abi_type   = simd_abi::avx2_fixed_size<4>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -2147,11 +2148,11 @@ class simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> {
       simd<std::int64_t, abi_type> const& other)
       : m_value(static_cast<__m256i>(other)) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m256i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -2994,6 +2995,529 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx2_fixed_size<4>>,
   }
 };
 
+// The 8 and 16-bit integers fill the register with 32 or 16 lanes, they share
+// their implementation through the bases below, the masks keep all the bits of
+// a lane set like the comparisons return them.
+
+namespace Impl {
+
+template <class T>
+class avx2_narrow_mask {
+  static constexpr int lanes = 32 / sizeof(T);
+  using mask_type            = simd_mask<T, simd_abi::avx2_fixed_size<lanes>>;
+
+  __m256i m_value;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static __m256i generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    T const values[] = {static_cast<T>(
+        gen(std::integral_constant<std::size_t, Lanes>()) ? -1 : 0)...};
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values));
+  }
+
+ public:
+  class reference {
+    __m256i& m_mask;
+    int m_lane;
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m256i bit_mask() const {
+      if constexpr (sizeof(T) == 1) {
+        return _mm256_cmpeq_epi8(
+            _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                             15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+                             27, 28, 29, 30, 31),
+            _mm256_set1_epi8(char(m_lane)));
+      } else {
+        return _mm256_cmpeq_epi16(
+            _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                              15),
+            _mm256_set1_epi16(short(m_lane)));
+      }
+    }
+
+   public:
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference(__m256i& mask_arg,
+                                                    int lane_arg)
+        : m_mask(mask_arg), m_lane(lane_arg) {}
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference
+    operator=(bool value) const {
+      if (value) {
+        m_mask = _mm256_or_si256(bit_mask(), m_mask);
+      } else {
+        m_mask = _mm256_andnot_si256(bit_mask(), m_mask);
+      }
+      return *this;
+    }
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator bool() const {
+      return (_mm256_movemask_epi8(m_mask) >> (m_lane * int(sizeof(T)))) & 1;
+    }
+  };
+  using value_type = bool;
+  using abi_type   = simd_abi::avx2_fixed_size<lanes>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx2_narrow_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx2_narrow_mask(
+      value_type value)
+      : m_value(_mm256_set1_epi8(-char(value))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return lanes;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit avx2_narrow_mask(
+      __m256i const& value_in)
+      : m_value(value_in) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx2_narrow_mask(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<lanes>())) {}
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx2_narrow_mask(
+      simd_mask<U, abi_type> const& other) {
+    if constexpr (sizeof(U) == sizeof(T)) {
+      m_value = static_cast<__m256i>(other);
+    } else {
+      for (std::size_t i = 0; i < size(); ++i) (*this)[i] = other[i];
+    }
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256i()
+      const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return static_cast<value_type>(
+        reference(const_cast<__m256i&>(m_value), int(i)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type
+  operator||(avx2_narrow_mask const& other) const {
+    return mask_type(_mm256_or_si256(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type
+  operator&&(avx2_narrow_mask const& other) const {
+    return mask_type(_mm256_and_si256(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type operator!() const {
+    return mask_type(_mm256_andnot_si256(m_value, _mm256_set1_epi8(-1)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      avx2_narrow_mask const& other) const {
+    return _mm256_movemask_epi8(m_value) == _mm256_movemask_epi8(other.m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      avx2_narrow_mask const& other) const {
+    return !operator==(other);
+  }
+};
+
+template <class T>
+class avx2_narrow_simd {
+  static constexpr int lanes = 32 / sizeof(T);
+  using simd_type            = simd<T, simd_abi::avx2_fixed_size<lanes>>;
+
+  __m256i m_value;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static __m256i generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    T const values[] = {
+        static_cast<T>(gen(std::integral_constant<std::size_t, Lanes>()))...};
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values));
+  }
+
+  // the unsigned comparisons are the signed ones with the sign bits flipped
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static __m256i greater(__m256i a,
+                                                               __m256i b) {
+    if constexpr (std::is_same_v<T, std::uint8_t>) {
+      __m256i const sign = _mm256_set1_epi8(char(0x80));
+      return _mm256_cmpgt_epi8(_mm256_xor_si256(a, sign),
+                               _mm256_xor_si256(b, sign));
+    } else if constexpr (sizeof(T) == 1) {
+      return _mm256_cmpgt_epi8(a, b);
+    } else {
+      return _mm256_cmpgt_epi16(a, b);
+    }
+  }
+
+ public:
+  using value_type = T;
+  using abi_type   = simd_abi::avx2_fixed_size<lanes>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<value_type>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx2_narrow_simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return lanes;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx2_narrow_simd(U&& value) {
+    if constexpr (sizeof(T) == 1) {
+      m_value = _mm256_set1_epi8(char(value_type(value)));
+    } else {
+      m_value = _mm256_set1_epi16(short(value_type(value)));
+    }
+  }
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx2_narrow_simd(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<lanes>())) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit avx2_narrow_simd(
+      __m256i const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(&m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return reference(const_cast<__m256i*>(&m_value), int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m256i()
+      const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_type operator-() const noexcept {
+    return avx2_narrow_simd(value_type(0)) - *this;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(avx2_narrow_simd const& lhs,
+             avx2_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      return mask_type(_mm256_cmpeq_epi8(lhs.m_value, rhs.m_value));
+    } else {
+      return mask_type(_mm256_cmpeq_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(avx2_narrow_simd const& lhs,
+            avx2_narrow_simd const& rhs) noexcept {
+    return mask_type(greater(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(avx2_narrow_simd const& lhs,
+            avx2_narrow_simd const& rhs) noexcept {
+    return mask_type(greater(rhs.m_value, lhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(avx2_narrow_simd const& lhs,
+             avx2_narrow_simd const& rhs) noexcept {
+    return !(lhs > rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(avx2_narrow_simd const& lhs,
+             avx2_narrow_simd const& rhs) noexcept {
+    return !(lhs < rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(avx2_narrow_simd const& lhs,
+             avx2_narrow_simd const& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator-(avx2_narrow_simd const& lhs,
+            avx2_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      return simd_type(_mm256_sub_epi8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(_mm256_sub_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator+(avx2_narrow_simd const& lhs,
+            avx2_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      return simd_type(_mm256_add_epi8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(_mm256_add_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  // there is no 8-bit multiplication, the low bytes of the 16-bit products of
+  // the even and odd bytes are the products modulo 256
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator*(avx2_narrow_simd const& lhs,
+            avx2_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      __m256i const even = _mm256_mullo_epi16(lhs.m_value, rhs.m_value);
+      __m256i const odd =
+          _mm256_mullo_epi16(_mm256_srli_epi16(lhs.m_value, 8),
+                             _mm256_srli_epi16(rhs.m_value, 8));
+      return simd_type(
+          _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                          _mm256_and_si256(even, _mm256_set1_epi16(0xff))));
+    } else {
+      return simd_type(_mm256_mullo_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  // there are no 8-bit shifts
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator>>(avx2_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(_mm256_srai_epi16(lhs.m_value, rhs));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator<<(avx2_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(_mm256_slli_epi16(lhs.m_value, rhs));
+  }
+};
+
+}  // namespace Impl
+
+template <>
+class simd_mask<std::int8_t, simd_abi::avx2_fixed_size<32>>
+    : public Impl::avx2_narrow_mask<std::int8_t> {
+  using base_type = Impl::avx2_narrow_mask<std::int8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd_mask<std::uint8_t, simd_abi::avx2_fixed_size<32>>
+    : public Impl::avx2_narrow_mask<std::uint8_t> {
+  using base_type = Impl::avx2_narrow_mask<std::uint8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd_mask<std::int16_t, simd_abi::avx2_fixed_size<16>>
+    : public Impl::avx2_narrow_mask<std::int16_t> {
+  using base_type = Impl::avx2_narrow_mask<std::int16_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int8_t, simd_abi::avx2_fixed_size<32>>
+    : public Impl::avx2_narrow_simd<std::int8_t> {
+  using base_type = Impl::avx2_narrow_simd<std::int8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::uint8_t, simd_abi::avx2_fixed_size<32>>
+    : public Impl::avx2_narrow_simd<std::uint8_t> {
+  using base_type = Impl::avx2_narrow_simd<std::uint8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int16_t, simd_abi::avx2_fixed_size<16>>
+    : public Impl::avx2_narrow_simd<std::int16_t> {
+  using base_type = Impl::avx2_narrow_simd<std::int16_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+}  // namespace Experimental
+
+#define KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(TYPE, N, MIN, MAX)            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<TYPE, Experimental::simd_abi::avx2_fixed_size<N>>   \
+      min(Experimental::simd<                                                \
+              TYPE, Experimental::simd_abi::avx2_fixed_size<N>> const& a,    \
+          Experimental::simd<                                                \
+              TYPE, Experimental::simd_abi::avx2_fixed_size<N>> const& b) {  \
+    return Experimental::simd<TYPE,                                          \
+                              Experimental::simd_abi::avx2_fixed_size<N>>(   \
+        MIN(static_cast<__m256i>(a), static_cast<__m256i>(b)));              \
+  }                                                                          \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<TYPE, Experimental::simd_abi::avx2_fixed_size<N>>   \
+      max(Experimental::simd<                                                \
+              TYPE, Experimental::simd_abi::avx2_fixed_size<N>> const& a,    \
+          Experimental::simd<                                                \
+              TYPE, Experimental::simd_abi::avx2_fixed_size<N>> const& b) {  \
+    return Experimental::simd<TYPE,                                          \
+                              Experimental::simd_abi::avx2_fixed_size<N>>(   \
+        MAX(static_cast<__m256i>(a), static_cast<__m256i>(b)));              \
+  }
+
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::int8_t, 32, _mm256_min_epi8,
+                                       _mm256_max_epi8)
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::uint8_t, 32, _mm256_min_epu8,
+                                       _mm256_max_epu8)
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::int16_t, 16, _mm256_min_epi16,
+                                       _mm256_max_epi16)
+
+#undef KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int8_t, Experimental::simd_abi::avx2_fixed_size<32>>
+    abs(Experimental::simd<
+        std::int8_t, Experimental::simd_abi::avx2_fixed_size<32>> const& a) {
+  return Experimental::simd<std::int8_t,
+                            Experimental::simd_abi::avx2_fixed_size<32>>(
+      _mm256_abs_epi8(static_cast<__m256i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::uint8_t,
+                       Experimental::simd_abi::avx2_fixed_size<32>>
+    abs(Experimental::simd<
+        std::uint8_t, Experimental::simd_abi::avx2_fixed_size<32>> const& a) {
+  return a;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int16_t,
+                       Experimental::simd_abi::avx2_fixed_size<16>>
+    abs(Experimental::simd<
+        std::int16_t, Experimental::simd_abi::avx2_fixed_size<16>> const& a) {
+  return Experimental::simd<std::int16_t,
+                            Experimental::simd_abi::avx2_fixed_size<16>>(
+      _mm256_abs_epi16(static_cast<__m256i>(a)));
+}
+
+namespace Experimental {
+
+namespace Impl {
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t avx2_hadd_epi32(
+    __m256i const& a) {
+  __m128i const sum =
+      _mm_add_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+  __m128i const pairs = _mm_add_epi32(sum, _mm_unpackhi_epi64(sum, sum));
+  return _mm_cvtsi128_si32(
+      _mm_add_epi32(pairs, _mm_shuffle_epi32(pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t avx2_hadd_sad(
+    __m256i const& a) {
+  __m256i const sad = _mm256_sad_epu8(a, _mm256_setzero_si256());
+  __m128i const sum = _mm_add_epi64(_mm256_castsi256_si128(sad),
+                                    _mm256_extracti128_si256(sad, 1));
+  return _mm_cvtsi128_si32(_mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum)));
+}
+
+}  // namespace Impl
+
+#define KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(TYPE, N, EPI)                  \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      simd<TYPE, simd_abi::avx2_fixed_size<N>>                                \
+      condition(simd_mask<TYPE, simd_abi::avx2_fixed_size<N>> const& a,       \
+                simd<TYPE, simd_abi::avx2_fixed_size<N>> const& b,            \
+                simd<TYPE, simd_abi::avx2_fixed_size<N>> const& c) {          \
+    return simd<TYPE, simd_abi::avx2_fixed_size<N>>(                          \
+        _mm256_blendv_epi8(static_cast<__m256i>(c), static_cast<__m256i>(b), \
+                           static_cast<__m256i>(a)));                         \
+  }                                                                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      simd<TYPE, simd_abi::avx2_fixed_size<N>>                                \
+      add_sat(simd<TYPE, simd_abi::avx2_fixed_size<N>> const& a,              \
+              simd<TYPE, simd_abi::avx2_fixed_size<N>> const& b) {            \
+    return simd<TYPE, simd_abi::avx2_fixed_size<N>>(_mm256_adds_##EPI(        \
+        static_cast<__m256i>(a), static_cast<__m256i>(b)));                   \
+  }                                                                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      simd<TYPE, simd_abi::avx2_fixed_size<N>>                                \
+      sub_sat(simd<TYPE, simd_abi::avx2_fixed_size<N>> const& a,              \
+              simd<TYPE, simd_abi::avx2_fixed_size<N>> const& b) {            \
+    return simd<TYPE, simd_abi::avx2_fixed_size<N>>(_mm256_subs_##EPI(        \
+        static_cast<__m256i>(a), static_cast<__m256i>(b)));                   \
+  }
+
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::int8_t, 32, epi8)
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::uint8_t, 32, epu8)
+KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS(std::int16_t, 16, epi16)
+
+#undef KOKKOS_IMPL_SIMD_AVX2_NARROW_FUNCTIONS
+
+// the bytes are widened to 16 bits, even and odd ones apart, for the 16-bit
+// multiply-add of adjacent pairs
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<8>>
+    widening_madd(simd<std::int8_t, simd_abi::avx2_fixed_size<32>> const& a,
+                  simd<std::int8_t, simd_abi::avx2_fixed_size<32>> const& b,
+                  simd<std::int32_t, simd_abi::avx2_fixed_size<8>> const& c) {
+  __m256i const a_value = static_cast<__m256i>(a);
+  __m256i const b_value = static_cast<__m256i>(b);
+  __m256i const even    = _mm256_madd_epi16(
+      _mm256_srai_epi16(_mm256_slli_epi16(a_value, 8), 8),
+      _mm256_srai_epi16(_mm256_slli_epi16(b_value, 8), 8));
+  __m256i const odd = _mm256_madd_epi16(_mm256_srai_epi16(a_value, 8),
+                                        _mm256_srai_epi16(b_value, 8));
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<8>>(_mm256_add_epi32(
+      static_cast<__m256i>(c), _mm256_add_epi32(even, odd)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<8>>
+    widening_madd(simd<std::uint8_t, simd_abi::avx2_fixed_size<32>> const& a,
+                  simd<std::uint8_t, simd_abi::avx2_fixed_size<32>> const& b,
+                  simd<std::int32_t, simd_abi::avx2_fixed_size<8>> const& c) {
+  __m256i const a_value  = static_cast<__m256i>(a);
+  __m256i const b_value  = static_cast<__m256i>(b);
+  __m256i const low_byte = _mm256_set1_epi16(0xff);
+  __m256i const even =
+      _mm256_madd_epi16(_mm256_and_si256(a_value, low_byte),
+                        _mm256_and_si256(b_value, low_byte));
+  __m256i const odd = _mm256_madd_epi16(_mm256_srli_epi16(a_value, 8),
+                                        _mm256_srli_epi16(b_value, 8));
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<8>>(_mm256_add_epi32(
+      static_cast<__m256i>(c), _mm256_add_epi32(even, odd)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<8>>
+    widening_madd(simd<std::int16_t, simd_abi::avx2_fixed_size<16>> const& a,
+                  simd<std::int16_t, simd_abi::avx2_fixed_size<16>> const& b,
+                  simd<std::int32_t, simd_abi::avx2_fixed_size<8>> const& c) {
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<8>>(
+      _mm256_add_epi32(static_cast<__m256i>(c),
+                       _mm256_madd_epi16(static_cast<__m256i>(a),
+                                         static_cast<__m256i>(b))));
+}
+
+// the sum of absolute differences with 0 adds up the unsigned bytes, the signed
+// ones are offset by 128 into the unsigned range
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::int8_t, simd_abi::avx2_fixed_size<32>> const& a) {
+  return Impl::avx2_hadd_sad(_mm256_xor_si256(static_cast<__m256i>(a),
+                                              _mm256_set1_epi8(char(0x80)))) -
+         128 * 32;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::uint8_t, simd_abi::avx2_fixed_size<32>> const& a) {
+  return Impl::avx2_hadd_sad(static_cast<__m256i>(a));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::int16_t, simd_abi::avx2_fixed_size<16>> const& a) {
+  return Impl::avx2_hadd_epi32(
+      _mm256_madd_epi16(static_cast<__m256i>(a), _mm256_set1_epi16(1)));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 #include <Kokkos_SIMD_Common.hpp>
 #include <Kokkos_BitManipulation.hpp>  // bit_cast
@@ -1098,7 +1099,7 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1135,11 +1136,11 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
                               gen(std::integral_constant<std::size_t, 6>()),
                               gen(std::integral_constant<std::size_t, 7>()))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m256i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -1305,7 +1306,7 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<16>> {
   using value_type = std::int32_t;
   using abi_type   = simd_abi::avx512_fixed_size<16>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1350,11 +1351,11 @@ class simd<std::int32_t, simd_abi::avx512_fixed_size<16>> {
             gen(std::integral_constant<std::size_t, 14>()),
             gen(std::integral_constant<std::size_t, 15>()))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m512i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
       value_type* ptr, element_aligned_tag) const {
@@ -1521,7 +1522,7 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::uint32_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1560,11 +1561,11 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<8>> {
                               gen(std::integral_constant<std::size_t, 6>()),
                               gen(std::integral_constant<std::size_t, 7>()))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m256i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
       value_type* ptr, element_aligned_tag) const {
@@ -1723,7 +1724,7 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<16>> {
   using value_type = std::uint32_t;
   using abi_type   = simd_abi::avx512_fixed_size<16>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1770,11 +1771,11 @@ class simd<std::uint32_t, simd_abi::avx512_fixed_size<16>> {
             gen(std::integral_constant<std::size_t, 14>()),
             gen(std::integral_constant<std::size_t, 15>()))) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m512i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -1934,7 +1935,7 @@ class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::int64_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -1973,11 +1974,11 @@ class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr simd(__m512i const& value_in)
       : m_value(value_in) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m512i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -2142,7 +2143,7 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
   using value_type = std::uint64_t;
   using abi_type   = simd_abi::avx512_fixed_size<8>;
   using mask_type  = simd_mask<value_type, abi_type>;
-  using reference  = value_type&;
+  using reference  = Impl::simd_lane_reference<value_type>;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
@@ -2183,11 +2184,11 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
       simd<std::int64_t, abi_type> const& other)
       : m_value(static_cast<__m512i>(other)) {}
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
-    return reinterpret_cast<value_type*>(&m_value)[i];
+    return reference(&m_value, int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
   operator[](std::size_t i) const {
-    return reinterpret_cast<value_type const*>(&m_value)[i];
+    return reference(const_cast<__m512i*>(&m_value), int(i));
   }
   KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
                                                        element_aligned_tag) {
@@ -3221,6 +3222,500 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::avx512_fixed_size<8>>,
                                    static_cast<__m512d>(x.impl_get_value()));
 }
 
+// The 8 and 16-bit integers fill the register with 64 or 32 lanes, they share
+// their implementation through the bases below. They need AVX512BW, which the
+// processors of KOKKOS_ARCH_AVX512XEON all have.
+#ifdef __AVX512BW__
+
+namespace Impl {
+
+template <class T, int N>
+class avx512_narrow_mask {
+  using mask_type = simd_mask<T, simd_abi::avx512_fixed_size<N>>;
+  using bits_type = std::conditional_t<N == 64, __mmask64, __mmask32>;
+
+  bits_type m_value;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static bits_type generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    return (bits_type(0) | ... |
+            (bits_type(static_cast<bool>(
+                 gen(std::integral_constant<std::size_t, Lanes>())))
+             << Lanes));
+  }
+
+ public:
+  class reference {
+    bits_type& m_mask;
+    int m_lane;
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bits_type bit_mask() const {
+      return bits_type(1) << m_lane;
+    }
+
+   public:
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference(bits_type& mask_arg,
+                                                    int lane_arg)
+        : m_mask(mask_arg), m_lane(lane_arg) {}
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference
+    operator=(bool value) const {
+      if (value) {
+        m_mask |= bit_mask();
+      } else {
+        m_mask &= ~bit_mask();
+      }
+      return *this;
+    }
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator bool() const {
+      return (m_mask & bit_mask()) != 0;
+    }
+  };
+  using value_type = bool;
+  using abi_type   = simd_abi::avx512_fixed_size<N>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx512_narrow_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx512_narrow_mask(
+      value_type value)
+      : m_value(value ? ~bits_type(0) : bits_type(0)) {}
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx512_narrow_mask(
+      simd_mask<U, abi_type> const& other)
+      : m_value(static_cast<bits_type>(other)) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx512_narrow_mask(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<N>())) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return N;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit avx512_narrow_mask(
+      bits_type const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator bits_type()
+      const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return static_cast<value_type>(
+        reference(const_cast<bits_type&>(m_value), int(i)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type
+  operator||(avx512_narrow_mask const& other) const {
+    return mask_type(bits_type(m_value | other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type
+  operator&&(avx512_narrow_mask const& other) const {
+    return mask_type(bits_type(m_value & other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type operator!() const {
+    return mask_type(bits_type(~m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      avx512_narrow_mask const& other) const {
+    return m_value == other.m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      avx512_narrow_mask const& other) const {
+    return m_value != other.m_value;
+  }
+};
+
+template <class T>
+class avx512_narrow_simd {
+  static constexpr int lanes = 64 / sizeof(T);
+  using simd_type            = simd<T, simd_abi::avx512_fixed_size<lanes>>;
+  using bits_type = std::conditional_t<lanes == 64, __mmask64, __mmask32>;
+
+  __m512i m_value;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static __m512i generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    T const values[] = {
+        static_cast<T>(gen(std::integral_constant<std::size_t, Lanes>()))...};
+    return _mm512_loadu_si512(values);
+  }
+
+  template <int Predicate>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static bits_type compare(__m512i a,
+                                                                 __m512i b) {
+    if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return _mm512_cmp_epu8_mask(a, b, Predicate);
+    } else if constexpr (sizeof(T) == 1) {
+      return _mm512_cmp_epi8_mask(a, b, Predicate);
+    } else {
+      return _mm512_cmp_epi16_mask(a, b, Predicate);
+    }
+  }
+
+ public:
+  using value_type = T;
+  using abi_type   = simd_abi::avx512_fixed_size<lanes>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<value_type>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx512_narrow_simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return lanes;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION avx512_narrow_simd(U&& value) {
+    if constexpr (sizeof(T) == 1) {
+      m_value = _mm512_set1_epi8(char(value_type(value)));
+    } else {
+      m_value = _mm512_set1_epi16(short(value_type(value)));
+    }
+  }
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit avx512_narrow_simd(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<lanes>())) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit avx512_narrow_simd(
+      __m512i const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(&m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return reference(const_cast<__m512i*>(&m_value), int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm512_loadu_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm512_storeu_si512(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit operator __m512i()
+      const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_type operator-() const noexcept {
+    return avx512_narrow_simd(value_type(0)) - *this;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_EQ>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(avx512_narrow_simd const& lhs,
+            avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_NLE>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(avx512_narrow_simd const& lhs,
+            avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_LT>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_LE>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_NLT>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return mask_type(compare<_MM_CMPINT_NE>(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator-(avx512_narrow_simd const& lhs,
+            avx512_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      return simd_type(_mm512_sub_epi8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(_mm512_sub_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator+(avx512_narrow_simd const& lhs,
+            avx512_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      return simd_type(_mm512_add_epi8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(_mm512_add_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  // there is no 8-bit multiplication, the low bytes of the 16-bit products of
+  // the even and odd bytes are the products modulo 256
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator*(avx512_narrow_simd const& lhs,
+            avx512_narrow_simd const& rhs) noexcept {
+    if constexpr (sizeof(T) == 1) {
+      __m512i const even = _mm512_mullo_epi16(lhs.m_value, rhs.m_value);
+      __m512i const odd =
+          _mm512_mullo_epi16(_mm512_srli_epi16(lhs.m_value, 8),
+                             _mm512_srli_epi16(rhs.m_value, 8));
+      return simd_type(_mm512_mask_blend_epi8(
+          __mmask64(0xaaaaaaaaaaaaaaaa), even, _mm512_slli_epi16(odd, 8)));
+    } else {
+      return simd_type(_mm512_mullo_epi16(lhs.m_value, rhs.m_value));
+    }
+  }
+  // there are no 8-bit shifts
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator>>(avx512_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(_mm512_srai_epi16(lhs.m_value, rhs));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator>>(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return simd_type(_mm512_srav_epi16(lhs.m_value, rhs.m_value));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator<<(avx512_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(_mm512_slli_epi16(lhs.m_value, rhs));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator<<(avx512_narrow_simd const& lhs,
+             avx512_narrow_simd const& rhs) noexcept {
+    return simd_type(_mm512_sllv_epi16(lhs.m_value, rhs.m_value));
+  }
+};
+
+}  // namespace Impl
+
+template <class T>
+class simd_mask<T, simd_abi::avx512_fixed_size<32>>
+    : public Impl::avx512_narrow_mask<T, 32> {
+  using base_type = Impl::avx512_narrow_mask<T, 32>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <class T>
+class simd_mask<T, simd_abi::avx512_fixed_size<64>>
+    : public Impl::avx512_narrow_mask<T, 64> {
+  using base_type = Impl::avx512_narrow_mask<T, 64>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int8_t, simd_abi::avx512_fixed_size<64>>
+    : public Impl::avx512_narrow_simd<std::int8_t> {
+  using base_type = Impl::avx512_narrow_simd<std::int8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::uint8_t, simd_abi::avx512_fixed_size<64>>
+    : public Impl::avx512_narrow_simd<std::uint8_t> {
+  using base_type = Impl::avx512_narrow_simd<std::uint8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int16_t, simd_abi::avx512_fixed_size<32>>
+    : public Impl::avx512_narrow_simd<std::int16_t> {
+  using base_type = Impl::avx512_narrow_simd<std::int16_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+}  // namespace Experimental
+
+#define KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(TYPE, N, MIN, MAX)           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      Experimental::simd<TYPE, Experimental::simd_abi::avx512_fixed_size<N>>  \
+      min(Experimental::simd<                                                 \
+              TYPE, Experimental::simd_abi::avx512_fixed_size<N>> const& a,   \
+          Experimental::simd<                                                 \
+              TYPE, Experimental::simd_abi::avx512_fixed_size<N>> const& b) { \
+    return Experimental::simd<TYPE,                                           \
+                              Experimental::simd_abi::avx512_fixed_size<N>>(  \
+        MIN(static_cast<__m512i>(a), static_cast<__m512i>(b)));               \
+  }                                                                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      Experimental::simd<TYPE, Experimental::simd_abi::avx512_fixed_size<N>>  \
+      max(Experimental::simd<                                                 \
+              TYPE, Experimental::simd_abi::avx512_fixed_size<N>> const& a,   \
+          Experimental::simd<                                                 \
+              TYPE, Experimental::simd_abi::avx512_fixed_size<N>> const& b) { \
+    return Experimental::simd<TYPE,                                           \
+                              Experimental::simd_abi::avx512_fixed_size<N>>(  \
+        MAX(static_cast<__m512i>(a), static_cast<__m512i>(b)));               \
+  }
+
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::int8_t, 64, _mm512_min_epi8,
+                                         _mm512_max_epi8)
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::uint8_t, 64, _mm512_min_epu8,
+                                         _mm512_max_epu8)
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::int16_t, 32, _mm512_min_epi16,
+                                         _mm512_max_epi16)
+
+#undef KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<
+    std::int8_t, Experimental::simd_abi::avx512_fixed_size<64>>
+abs(Experimental::simd<
+    std::int8_t, Experimental::simd_abi::avx512_fixed_size<64>> const& a) {
+  return Experimental::simd<std::int8_t,
+                            Experimental::simd_abi::avx512_fixed_size<64>>(
+      _mm512_abs_epi8(static_cast<__m512i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<
+    std::uint8_t, Experimental::simd_abi::avx512_fixed_size<64>>
+abs(Experimental::simd<
+    std::uint8_t, Experimental::simd_abi::avx512_fixed_size<64>> const& a) {
+  return a;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<
+    std::int16_t, Experimental::simd_abi::avx512_fixed_size<32>>
+abs(Experimental::simd<
+    std::int16_t, Experimental::simd_abi::avx512_fixed_size<32>> const& a) {
+  return Experimental::simd<std::int16_t,
+                            Experimental::simd_abi::avx512_fixed_size<32>>(
+      _mm512_abs_epi16(static_cast<__m512i>(a)));
+}
+
+namespace Experimental {
+
+#define KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(TYPE, N, MASK, EPI, BLEND) \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                       \
+      simd<TYPE, simd_abi::avx512_fixed_size<N>>                            \
+      condition(simd_mask<TYPE, simd_abi::avx512_fixed_size<N>> const& a,   \
+                simd<TYPE, simd_abi::avx512_fixed_size<N>> const& b,        \
+                simd<TYPE, simd_abi::avx512_fixed_size<N>> const& c) {      \
+    return simd<TYPE, simd_abi::avx512_fixed_size<N>>(                      \
+        BLEND(static_cast<MASK>(a), static_cast<__m512i>(c),                \
+              static_cast<__m512i>(b)));                                    \
+  }                                                                         \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                       \
+      simd<TYPE, simd_abi::avx512_fixed_size<N>>                            \
+      add_sat(simd<TYPE, simd_abi::avx512_fixed_size<N>> const& a,          \
+              simd<TYPE, simd_abi::avx512_fixed_size<N>> const& b) {        \
+    return simd<TYPE, simd_abi::avx512_fixed_size<N>>(_mm512_adds_##EPI(    \
+        static_cast<__m512i>(a), static_cast<__m512i>(b)));                 \
+  }                                                                         \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                       \
+      simd<TYPE, simd_abi::avx512_fixed_size<N>>                            \
+      sub_sat(simd<TYPE, simd_abi::avx512_fixed_size<N>> const& a,          \
+              simd<TYPE, simd_abi::avx512_fixed_size<N>> const& b) {        \
+    return simd<TYPE, simd_abi::avx512_fixed_size<N>>(_mm512_subs_##EPI(    \
+        static_cast<__m512i>(a), static_cast<__m512i>(b)));                 \
+  }
+
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::int8_t, 64, __mmask64, epi8,
+                                         _mm512_mask_blend_epi8)
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::uint8_t, 64, __mmask64, epu8,
+                                         _mm512_mask_blend_epi8)
+KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS(std::int16_t, 32, __mmask32, epi16,
+                                         _mm512_mask_blend_epi16)
+
+#undef KOKKOS_IMPL_SIMD_AVX512_NARROW_FUNCTIONS
+
+// the bytes are widened to 16 bits, even and odd ones apart, for the 16-bit
+// multiply-add of adjacent pairs
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<16>>
+    widening_madd(
+        simd<std::int8_t, simd_abi::avx512_fixed_size<64>> const& a,
+        simd<std::int8_t, simd_abi::avx512_fixed_size<64>> const& b,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<16>> const& c) {
+  __m512i const a_value = static_cast<__m512i>(a);
+  __m512i const b_value = static_cast<__m512i>(b);
+  __m512i const even    = _mm512_madd_epi16(
+      _mm512_srai_epi16(_mm512_slli_epi16(a_value, 8), 8),
+      _mm512_srai_epi16(_mm512_slli_epi16(b_value, 8), 8));
+  __m512i const odd = _mm512_madd_epi16(_mm512_srai_epi16(a_value, 8),
+                                        _mm512_srai_epi16(b_value, 8));
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<16>>(_mm512_add_epi32(
+      static_cast<__m512i>(c), _mm512_add_epi32(even, odd)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<16>>
+    widening_madd(
+        simd<std::uint8_t, simd_abi::avx512_fixed_size<64>> const& a,
+        simd<std::uint8_t, simd_abi::avx512_fixed_size<64>> const& b,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<16>> const& c) {
+  __m512i const a_value  = static_cast<__m512i>(a);
+  __m512i const b_value  = static_cast<__m512i>(b);
+  __m512i const low_byte = _mm512_set1_epi16(0xff);
+  __m512i const even =
+      _mm512_madd_epi16(_mm512_and_si512(a_value, low_byte),
+                        _mm512_and_si512(b_value, low_byte));
+  __m512i const odd = _mm512_madd_epi16(_mm512_srli_epi16(a_value, 8),
+                                        _mm512_srli_epi16(b_value, 8));
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<16>>(_mm512_add_epi32(
+      static_cast<__m512i>(c), _mm512_add_epi32(even, odd)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<16>>
+    widening_madd(
+        simd<std::int16_t, simd_abi::avx512_fixed_size<32>> const& a,
+        simd<std::int16_t, simd_abi::avx512_fixed_size<32>> const& b,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<16>> const& c) {
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<16>>(
+      _mm512_add_epi32(static_cast<__m512i>(c),
+                       _mm512_madd_epi16(static_cast<__m512i>(a),
+                                         static_cast<__m512i>(b))));
+}
+
+// the sum of absolute differences with 0 adds up the unsigned bytes, the signed
+// ones are offset by 128 into the unsigned range
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::int8_t, simd_abi::avx512_fixed_size<64>> const& a) {
+  return std::int32_t(_mm512_reduce_add_epi64(_mm512_sad_epu8(
+             _mm512_xor_si512(static_cast<__m512i>(a),
+                              _mm512_set1_epi8(char(0x80))),
+             _mm512_setzero_si512()))) -
+         128 * 64;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::uint8_t, simd_abi::avx512_fixed_size<64>> const& a) {
+  return std::int32_t(_mm512_reduce_add_epi64(
+      _mm512_sad_epu8(static_cast<__m512i>(a), _mm512_setzero_si512())));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<std::int16_t, simd_abi::avx512_fixed_size<32>> const& a) {
+  return _mm512_reduce_add_epi32(
+      _mm512_madd_epi16(static_cast<__m512i>(a), _mm512_set1_epi16(1)));
+}
+
+#endif
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
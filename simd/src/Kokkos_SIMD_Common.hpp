@@ -19,7 +19,12 @@
 
 #include <cstring>
 
-#include <Kokkos_Core.hpp>
+// only the headers of the simd types, the translation units of a simd_dispatch
+// kernel must not get the rest of Kokkos
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>
+#include <Kokkos_ReductionIdentity.hpp>
 
 namespace Kokkos {
 
@@ -42,6 +47,34 @@ inline constexpr simd_flags<simd_alignment_vector_aligned> simd_flag_aligned{};
 using element_aligned_tag = simd_flags<>;
 using vector_aligned_tag  = simd_flags<simd_alignment_vector_aligned>;
 
+namespace Impl {
+
+// Reference to a lane of a vector register of integers. The register types
+// are declared with a fixed element type (long long for __m256i), accessing
+// the lanes through a pointer to another integer type violates strict
+// aliasing and optimizing compilers drop the accesses, so go through memcpy.
+template <class T>
+class simd_lane_reference {
+  char* m_lane;
+
+ public:
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_lane_reference(void* value_arg,
+                                                            int lane_arg)
+      : m_lane(static_cast<char*>(value_arg) + lane_arg * sizeof(T)) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_lane_reference
+  operator=(T value) const {
+    std::memcpy(m_lane, &value, sizeof(T));
+    return *this;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator T() const {
+    T value;
+    std::memcpy(&value, m_lane, sizeof(T));
+    return value;
+  }
+};
+
+}  // namespace Impl
+
 // class template declarations for const_where_expression and where_expression
 
 template <class M, class T>
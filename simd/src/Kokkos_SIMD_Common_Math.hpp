@@ -17,7 +17,11 @@
 #ifndef KOKKOS_SIMD_COMMON_MATH_HPP
 #define KOKKOS_SIMD_COMMON_MATH_HPP
 
-#include <Kokkos_Core.hpp>  // Kokkos::min, etc.
+#include <functional>
+
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>  // Kokkos::min, etc.
+#include <Kokkos_NumericTraits.hpp>
 
 namespace Kokkos {
 
@@ -69,6 +73,93 @@ reduce(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x, T,
   return result;
 }
 
+namespace Impl {
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION constexpr T saturated_add(T a, T b) {
+  if constexpr (std::is_unsigned_v<T>) {
+    T const sum = static_cast<T>(a + b);
+    return sum < a ? finite_max_v<T> : sum;
+  } else {
+    if (b > 0 && a > finite_max_v<T> - b) return finite_max_v<T>;
+    if (b < 0 && a < finite_min_v<T> - b) return finite_min_v<T>;
+    return static_cast<T>(a + b);
+  }
+}
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION constexpr T saturated_sub(T a, T b) {
+  if constexpr (std::is_unsigned_v<T>) {
+    return a < b ? T(0) : static_cast<T>(a - b);
+  } else {
+    if (b < 0 && a > finite_max_v<T> + b) return finite_max_v<T>;
+    if (b > 0 && a < finite_min_v<T> + b) return finite_min_v<T>;
+    return static_cast<T>(a - b);
+  }
+}
+
+}  // namespace Impl
+
+// integer addition and subtraction clamped to the range of T instead of
+// wrapping around
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> add_sat(
+    simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  static_assert(std::is_integral_v<T>, "add_sat requires a simd of integers");
+  simd<T, Abi> result;
+  for (std::size_t i = 0; i < simd<T, Abi>::size(); ++i) {
+    result[i] = Impl::saturated_add(a[i], b[i]);
+  }
+  return result;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi> sub_sat(
+    simd<T, Abi> const& a, simd<T, Abi> const& b) {
+  static_assert(std::is_integral_v<T>, "sub_sat requires a simd of integers");
+  simd<T, Abi> result;
+  for (std::size_t i = 0; i < simd<T, Abi>::size(); ++i) {
+    result[i] = Impl::saturated_sub(a[i], b[i]);
+  }
+  return result;
+}
+
+// c plus the 32-bit products of the 8 or 16-bit integers of a and b, the lanes
+// of a and b going to a lane of c are consecutive
+template <class T, class Abi, class AccumulatorAbi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION simd<std::int32_t, AccumulatorAbi>
+widening_madd(simd<T, Abi> const& a, simd<T, Abi> const& b,
+              simd<std::int32_t, AccumulatorAbi> const& c) {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= 2,
+                "widening_madd requires a simd of 8 or 16-bit integers");
+  constexpr std::size_t group =
+      simd<T, Abi>::size() / simd<std::int32_t, AccumulatorAbi>::size();
+  static_assert(group * simd<std::int32_t, AccumulatorAbi>::size() ==
+                    simd<T, Abi>::size(),
+                "the lanes of a simd of integers must split evenly over the "
+                "lanes of the accumulator");
+  simd<std::int32_t, AccumulatorAbi> result;
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    std::int32_t sum = c[i];
+    for (std::size_t j = 0; j < group; ++j) {
+      sum += std::int32_t(a[i * group + j]) * std::int32_t(b[i * group + j]);
+    }
+    result[i] = sum;
+  }
+  return result;
+}
+
+// the sum of the 8 or 16-bit integers of a, in 32-bit arithmetic
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<T, Abi> const& a) {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= 2,
+                "widening_sum requires a simd of 8 or 16-bit integers");
+  std::int32_t result = 0;
+  for (std::size_t i = 0; i < simd<T, Abi>::size(); ++i) result += a[i];
+  return result;
+}
+
 }  // namespace Experimental
 
 template <class T, class Abi>
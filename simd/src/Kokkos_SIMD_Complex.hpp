@@ -0,0 +1,559 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_COMPLEX_HPP
+#define KOKKOS_SIMD_COMPLEX_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Complex.hpp>
+#include <Kokkos_SIMD_Common.hpp>
+#include <Kokkos_SIMD_Common_Math.hpp>
+#include <Kokkos_SIMD_FixedSize.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+// Moves complex numbers between the interleaved storage of Kokkos::complex,
+// as in a View<Kokkos::complex<T>*>, and the simd of their real parts and
+// the simd of their imaginary parts
+template <class T, class Abi>
+struct SplitComplexStorage {
+  using simd_type = simd<T, Abi>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<T> const* ptr, simd_type& re, simd_type& im) {
+    re = simd_type([=](std::size_t i) { return ptr[i].real(); });
+    im = simd_type([=](std::size_t i) { return ptr[i].imag(); });
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<T>* ptr, simd_type const& re, simd_type const& im) {
+    T re_lanes[simd_type::size()];
+    T im_lanes[simd_type::size()];
+    re.copy_to(re_lanes, element_aligned_tag());
+    im.copy_to(im_lanes, element_aligned_tag());
+    for (std::size_t i = 0; i < simd_type::size(); ++i) {
+      ptr[i] = Kokkos::complex<T>(re_lanes[i], im_lanes[i]);
+    }
+  }
+};
+
+template <class T, int N>
+struct SplitComplexStorage<T, simd_abi::fixed_size<N>> {
+  using simd_type     = simd<T, simd_abi::fixed_size<N>>;
+  using part_abi_type = simd_abi::Impl::fixed_size_part_t<T, N>;
+  static constexpr std::size_t part_size = simd<T, part_abi_type>::size();
+  static constexpr std::size_t num_parts = fixed_size_num_parts<T, N>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<T> const* ptr, simd_type& re, simd_type& im) {
+    fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      SplitComplexStorage<T, part_abi_type>::load(
+          ptr + k * part_size, re.impl_get_part(k), im.impl_get_part(k));
+    });
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<T>* ptr, simd_type const& re, simd_type const& im) {
+    fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      SplitComplexStorage<T, part_abi_type>::store(
+          ptr + k * part_size, re.impl_get_part(k), im.impl_get_part(k));
+    });
+  }
+};
+
+#ifdef KOKKOS_SIMD_AVX2_HPP
+template <>
+struct SplitComplexStorage<double, simd_abi::avx2_fixed_size<4>> {
+  using simd_type = simd<double, simd_abi::avx2_fixed_size<4>>;
+
+  // the unpacks of the two halves leave the lanes in the order 0 2 1 3
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<double> const* ptr, simd_type& re, simd_type& im) {
+    auto const* mem    = reinterpret_cast<double const*>(ptr);
+    __m256d const low  = _mm256_loadu_pd(mem);
+    __m256d const high = _mm256_loadu_pd(mem + 4);
+    re = simd_type(_mm256_permute4x64_pd(_mm256_unpacklo_pd(low, high), 0xd8));
+    im = simd_type(_mm256_permute4x64_pd(_mm256_unpackhi_pd(low, high), 0xd8));
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<double>* ptr, simd_type const& re, simd_type const& im) {
+    auto* mem = reinterpret_cast<double*>(ptr);
+    __m256d const re_0213 =
+        _mm256_permute4x64_pd(static_cast<__m256d>(re), 0xd8);
+    __m256d const im_0213 =
+        _mm256_permute4x64_pd(static_cast<__m256d>(im), 0xd8);
+    _mm256_storeu_pd(mem, _mm256_unpacklo_pd(re_0213, im_0213));
+    _mm256_storeu_pd(mem + 4, _mm256_unpackhi_pd(re_0213, im_0213));
+  }
+};
+
+template <>
+struct SplitComplexStorage<float, simd_abi::avx2_fixed_size<4>> {
+  using simd_type = simd<float, simd_abi::avx2_fixed_size<4>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<float> const* ptr, simd_type& re, simd_type& im) {
+    auto const* mem   = reinterpret_cast<float const*>(ptr);
+    __m128 const low  = _mm_loadu_ps(mem);
+    __m128 const high = _mm_loadu_ps(mem + 4);
+    re = simd_type(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+    im = simd_type(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<float>* ptr, simd_type const& re, simd_type const& im) {
+    auto* mem = reinterpret_cast<float*>(ptr);
+    _mm_storeu_ps(mem, _mm_unpacklo_ps(static_cast<__m128>(re),
+                                       static_cast<__m128>(im)));
+    _mm_storeu_ps(mem + 4, _mm_unpackhi_ps(static_cast<__m128>(re),
+                                           static_cast<__m128>(im)));
+  }
+};
+
+template <>
+struct SplitComplexStorage<float, simd_abi::avx2_fixed_size<8>> {
+  using simd_type = simd<float, simd_abi::avx2_fixed_size<8>>;
+
+  // the shuffles and unpacks work within the 128-bit halves, the permutes of
+  // the 64-bit lanes put the pairs of complex numbers in order
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<float> const* ptr, simd_type& re, simd_type& im) {
+    auto const* mem   = reinterpret_cast<float const*>(ptr);
+    __m256 const low  = _mm256_loadu_ps(mem);
+    __m256 const high = _mm256_loadu_ps(mem + 8);
+    re                = simd_type(_mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(
+            _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))),
+        0xd8)));
+    im                = simd_type(_mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(
+            _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1))),
+        0xd8)));
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<float>* ptr, simd_type const& re, simd_type const& im) {
+    auto* mem            = reinterpret_cast<float*>(ptr);
+    __m256 const re_0213 = _mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(static_cast<__m256>(re)), 0xd8));
+    __m256 const im_0213 = _mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(static_cast<__m256>(im)), 0xd8));
+    _mm256_storeu_ps(mem, _mm256_unpacklo_ps(re_0213, im_0213));
+    _mm256_storeu_ps(mem + 8, _mm256_unpackhi_ps(re_0213, im_0213));
+  }
+};
+#endif
+
+#ifdef KOKKOS_SIMD_AVX512_HPP
+template <>
+struct SplitComplexStorage<double, simd_abi::avx512_fixed_size<8>> {
+  using simd_type = simd<double, simd_abi::avx512_fixed_size<8>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<double> const* ptr, simd_type& re, simd_type& im) {
+    auto const* mem    = reinterpret_cast<double const*>(ptr);
+    __m512d const low  = _mm512_loadu_pd(mem);
+    __m512d const high = _mm512_loadu_pd(mem + 8);
+    re                 = simd_type(_mm512_permutex2var_pd(
+        low, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), high));
+    im                 = simd_type(_mm512_permutex2var_pd(
+        low, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), high));
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<double>* ptr, simd_type const& re, simd_type const& im) {
+    auto* mem = reinterpret_cast<double*>(ptr);
+    _mm512_storeu_pd(mem, _mm512_permutex2var_pd(
+                              static_cast<__m512d>(re),
+                              _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11),
+                              static_cast<__m512d>(im)));
+    _mm512_storeu_pd(mem + 8, _mm512_permutex2var_pd(
+                                  static_cast<__m512d>(re),
+                                  _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15),
+                                  static_cast<__m512d>(im)));
+  }
+};
+
+template <>
+struct SplitComplexStorage<float, simd_abi::avx512_fixed_size<16>> {
+  using simd_type = simd<float, simd_abi::avx512_fixed_size<16>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<float> const* ptr, simd_type& re, simd_type& im) {
+    auto const* mem   = reinterpret_cast<float const*>(ptr);
+    __m512 const low  = _mm512_loadu_ps(mem);
+    __m512 const high = _mm512_loadu_ps(mem + 16);
+    re                = simd_type(_mm512_permutex2var_ps(
+        low,
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26,
+                          28, 30),
+        high));
+    im                = simd_type(_mm512_permutex2var_ps(
+        low,
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27,
+                          29, 31),
+        high));
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<float>* ptr, simd_type const& re, simd_type const& im) {
+    auto* mem = reinterpret_cast<float*>(ptr);
+    _mm512_storeu_ps(
+        mem, _mm512_permutex2var_ps(
+                 static_cast<__m512>(re),
+                 _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6,
+                                   22, 7, 23),
+                 static_cast<__m512>(im)));
+    _mm512_storeu_ps(
+        mem + 16, _mm512_permutex2var_ps(
+                      static_cast<__m512>(re),
+                      _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28,
+                                        13, 29, 14, 30, 15, 31),
+                      static_cast<__m512>(im)));
+  }
+};
+#endif
+
+#ifdef KOKKOS_SIMD_NEON_HPP
+template <>
+struct SplitComplexStorage<double, simd_abi::neon_fixed_size<2>> {
+  using simd_type = simd<double, simd_abi::neon_fixed_size<2>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<double> const* ptr, simd_type& re, simd_type& im) {
+    float64x2x2_t const lanes =
+        vld2q_f64(reinterpret_cast<double const*>(ptr));
+    re = simd_type(lanes.val[0]);
+    im = simd_type(lanes.val[1]);
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<double>* ptr, simd_type const& re, simd_type const& im) {
+    float64x2x2_t const lanes = {
+        {static_cast<float64x2_t>(re), static_cast<float64x2_t>(im)}};
+    vst2q_f64(reinterpret_cast<double*>(ptr), lanes);
+  }
+};
+
+template <>
+struct SplitComplexStorage<float, simd_abi::neon_fixed_size<2>> {
+  using simd_type = simd<float, simd_abi::neon_fixed_size<2>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<float> const* ptr, simd_type& re, simd_type& im) {
+    float32x2x2_t const lanes = vld2_f32(reinterpret_cast<float const*>(ptr));
+    re                        = simd_type(lanes.val[0]);
+    im                        = simd_type(lanes.val[1]);
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<float>* ptr, simd_type const& re, simd_type const& im) {
+    float32x2x2_t const lanes = {
+        {static_cast<float32x2_t>(re), static_cast<float32x2_t>(im)}};
+    vst2_f32(reinterpret_cast<float*>(ptr), lanes);
+  }
+};
+
+template <>
+struct SplitComplexStorage<float, simd_abi::neon_fixed_size<4>> {
+  using simd_type = simd<float, simd_abi::neon_fixed_size<4>>;
+
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void load(
+      Kokkos::complex<float> const* ptr, simd_type& re, simd_type& im) {
+    float32x4x2_t const lanes = vld2q_f32(reinterpret_cast<float const*>(ptr));
+    re                        = simd_type(lanes.val[0]);
+    im                        = simd_type(lanes.val[1]);
+  }
+  static KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void store(
+      Kokkos::complex<float>* ptr, simd_type const& re, simd_type const& im) {
+    float32x4x2_t const lanes = {
+        {static_cast<float32x4_t>(re), static_cast<float32x4_t>(im)}};
+    vst2q_f32(reinterpret_cast<float*>(ptr), lanes);
+  }
+};
+#endif
+
+/// \brief simd of complex numbers stored as the simd of their real parts and
+/// the simd of their imaginary parts
+///
+/// The arithmetic is the one of the real simd, copy_from and copy_to convert
+/// from and to the interleaved storage of Kokkos::complex. The masks are the
+/// ones of the real simd.
+template <class T, class Abi>
+class split_complex_simd {
+ public:
+  using value_type     = Kokkos::complex<T>;
+  using abi_type       = Abi;
+  using real_simd_type = simd<T, Abi>;
+  using mask_type      = simd_mask<T, Abi>;
+
+ private:
+  using simd_type = simd<value_type, abi_type>;
+
+  real_simd_type m_real;
+  real_simd_type m_imag;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION split_complex_simd(
+      G&& gen, std::index_sequence<Lanes...>) {
+    value_type const values[] = {static_cast<value_type>(
+        gen(std::integral_constant<std::size_t, Lanes>()))...};
+    copy_from(values, element_aligned_tag());
+  }
+
+ public:
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION split_complex_simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return real_simd_type::size();
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION split_complex_simd(U&& value) {
+    value_type const broadcast(std::forward<U>(value));
+    m_real = real_simd_type(broadcast.real());
+    m_imag = real_simd_type(broadcast.imag());
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION split_complex_simd(
+      real_simd_type const& re, real_simd_type const& im)
+      : m_real(re), m_imag(im) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit split_complex_simd(G&& gen)
+      : split_complex_simd(gen, std::make_index_sequence<size()>()) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return value_type(m_real[i], m_imag[i]);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    SplitComplexStorage<T, Abi>::load(ptr, m_real, m_imag);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    SplitComplexStorage<T, Abi>::load(ptr, m_real, m_imag);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    SplitComplexStorage<T, Abi>::store(ptr, m_real, m_imag);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    SplitComplexStorage<T, Abi>::store(ptr, m_real, m_imag);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION real_simd_type
+  real() const {
+    return m_real;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION real_simd_type
+  imag() const {
+    return m_imag;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_type
+  operator-() const noexcept {
+    return simd_type(-m_real, -m_imag);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator+(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_real + rhs.m_real, lhs.m_imag + rhs.m_imag);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator-(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_real - rhs.m_real, lhs.m_imag - rhs.m_imag);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator*(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(
+        Kokkos::fma(lhs.m_real, rhs.m_real, -(lhs.m_imag * rhs.m_imag)),
+        Kokkos::fma(lhs.m_real, rhs.m_imag, lhs.m_imag * rhs.m_real));
+  }
+
+  // like Kokkos::complex the operands are scaled by the 1-norm of rhs, the
+  // squared magnitude of rhs would overflow or underflow on its own
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator/(simd_type const& lhs, simd_type const& rhs) noexcept {
+    real_simd_type const scale =
+        Kokkos::abs(rhs.m_real) + Kokkos::abs(rhs.m_imag);
+    real_simd_type const lhs_real = lhs.m_real / scale;
+    real_simd_type const lhs_imag = lhs.m_imag / scale;
+    real_simd_type const rhs_real = rhs.m_real / scale;
+    real_simd_type const rhs_imag = rhs.m_imag / scale;
+    real_simd_type const denominator =
+        Kokkos::fma(rhs_real, rhs_real, rhs_imag * rhs_imag);
+    // the lanes dividing by zero keep the quotients of lhs by zero
+    auto const zero = scale == real_simd_type(T(0));
+    return simd_type(
+        condition(zero, lhs_real,
+                  Kokkos::fma(lhs_real, rhs_real, lhs_imag * rhs_imag) /
+                      denominator),
+        condition(zero, lhs_imag,
+                  Kokkos::fma(lhs_imag, rhs_real, -(lhs_real * rhs_imag)) /
+                      denominator));
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return (lhs.m_real == rhs.m_real) && (lhs.m_imag == rhs.m_imag);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+};
+
+template <class T, class Abi>
+inline constexpr bool is_split_complex_simd_v =
+    std::is_base_of_v<split_complex_simd<T, Abi>,
+                      simd<Kokkos::complex<T>, Abi>>;
+
+}  // namespace Impl
+
+// The simd ABIs with more than one lane store complex numbers split into
+// their real and imaginary parts, simd<Kokkos::complex<T>, simd_abi::scalar>
+// is the scalar simd of Kokkos::complex<T>.
+
+#ifdef KOKKOS_SIMD_AVX2_HPP
+template <class T, int N>
+class simd<Kokkos::complex<T>, simd_abi::avx2_fixed_size<N>>
+    : public Impl::split_complex_simd<T, simd_abi::avx2_fixed_size<N>> {
+  using base_type = Impl::split_complex_simd<T, simd_abi::avx2_fixed_size<N>>;
+
+ public:
+  using base_type::base_type;
+};
+#endif
+
+#ifdef KOKKOS_SIMD_AVX512_HPP
+template <class T, int N>
+class simd<Kokkos::complex<T>, simd_abi::avx512_fixed_size<N>>
+    : public Impl::split_complex_simd<T, simd_abi::avx512_fixed_size<N>> {
+  using base_type =
+      Impl::split_complex_simd<T, simd_abi::avx512_fixed_size<N>>;
+
+ public:
+  using base_type::base_type;
+};
+#endif
+
+#ifdef KOKKOS_SIMD_NEON_HPP
+template <class T, int N>
+class simd<Kokkos::complex<T>, simd_abi::neon_fixed_size<N>>
+    : public Impl::split_complex_simd<T, simd_abi::neon_fixed_size<N>> {
+  using base_type = Impl::split_complex_simd<T, simd_abi::neon_fixed_size<N>>;
+
+ public:
+  using base_type::base_type;
+};
+#endif
+
+template <class T, int N>
+class simd<Kokkos::complex<T>, simd_abi::fixed_size<N>>
+    : public Impl::split_complex_simd<T, simd_abi::fixed_size<N>> {
+  using base_type = Impl::split_complex_simd<T, simd_abi::fixed_size<N>>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Impl::is_split_complex_simd_v<T, Abi>, simd<Kokkos::complex<T>, Abi>>
+condition(simd_mask<T, Abi> const& a, simd<Kokkos::complex<T>, Abi> const& b,
+          simd<Kokkos::complex<T>, Abi> const& c) {
+  return simd<Kokkos::complex<T>, Abi>(condition(a, b.real(), c.real()),
+                                       condition(a, b.imag(), c.imag()));
+}
+
+}  // namespace Experimental
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Experimental::Impl::is_split_complex_simd_v<T, Abi>,
+    Experimental::simd<T, Abi>>
+real(Experimental::simd<Kokkos::complex<T>, Abi> const& a) {
+  return a.real();
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Experimental::Impl::is_split_complex_simd_v<T, Abi>,
+    Experimental::simd<T, Abi>>
+imag(Experimental::simd<Kokkos::complex<T>, Abi> const& a) {
+  return a.imag();
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Experimental::Impl::is_split_complex_simd_v<T, Abi>,
+    Experimental::simd<Kokkos::complex<T>, Abi>>
+conj(Experimental::simd<Kokkos::complex<T>, Abi> const& a) {
+  return Experimental::simd<Kokkos::complex<T>, Abi>(a.real(), -a.imag());
+}
+
+// the hypot of the real simd, like Kokkos::complex, the square of the
+// magnitude would overflow or underflow
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Experimental::Impl::is_split_complex_simd_v<T, Abi>,
+    Experimental::simd<T, Abi>>
+abs(Experimental::simd<Kokkos::complex<T>, Abi> const& a) {
+  return Kokkos::hypot(a.real(), a.imag());
+}
+
+// a * b + c with the multiply-adds of the real simd
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::enable_if_t<
+    Experimental::Impl::is_split_complex_simd_v<T, Abi>,
+    Experimental::simd<Kokkos::complex<T>, Abi>>
+fma(Experimental::simd<Kokkos::complex<T>, Abi> const& a,
+    Experimental::simd<Kokkos::complex<T>, Abi> const& b,
+    Experimental::simd<Kokkos::complex<T>, Abi> const& c) {
+  return Experimental::simd<Kokkos::complex<T>, Abi>(
+      Kokkos::fma(a.real(), b.real(),
+                  Kokkos::fma(-a.imag(), b.imag(), c.real())),
+      Kokkos::fma(a.real(), b.imag(),
+                  Kokkos::fma(a.imag(), b.real(), c.imag())));
+}
+
+// the overloads of the fixed_size ABI would be as good a match
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>
+    abs(Experimental::simd<Kokkos::complex<T>,
+                           Experimental::simd_abi::fixed_size<N>> const& a) {
+  return Kokkos::abs<T, Experimental::simd_abi::fixed_size<N>>(a);
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<
+    Kokkos::complex<T>, Experimental::simd_abi::fixed_size<N>>
+fma(Experimental::simd<Kokkos::complex<T>,
+                       Experimental::simd_abi::fixed_size<N>> const& a,
+    Experimental::simd<Kokkos::complex<T>,
+                       Experimental::simd_abi::fixed_size<N>> const& b,
+    Experimental::simd<Kokkos::complex<T>,
+                       Experimental::simd_abi::fixed_size<N>> const& c) {
+  return Kokkos::fma<T, Experimental::simd_abi::fixed_size<N>>(a, b, c);
+}
+
+}  // namespace Kokkos
+
+#endif
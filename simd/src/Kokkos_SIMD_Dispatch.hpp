@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_DISPATCH_HPP
+#define KOKKOS_SIMD_DISPATCH_HPP
+
+#include <utility>
+
+#include <Kokkos_SIMD.hpp>
+#include <impl/Kokkos_CPUDiscovery.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+// The widest instruction set of the host simd ABIs supported by the processor
+// the program runs on
+inline simd_isa host_simd_isa() { return Kokkos::Impl::host_simd_isa(); }
+
+/// \brief Versions of a host kernel compiled for several simd instruction sets
+///
+/// A version is a function calling the kernel, templated on the simd ABI,
+/// with simd_abi::for_isa of its instruction set. The versions for wider
+/// instruction sets than the configured architecture live in their own
+/// translation units compiled with the flags of their instruction set, see
+/// example/simd_dispatch. Calling the dispatch runs the widest version the
+/// processor supports, the scalar version is the fallback for all of them.
+///
+/// The translation units of the wider versions must only contain the kernel:
+/// every inline function or template instantiation they share with the rest
+/// of the program is compiled for the wider instruction set too, and the
+/// linker may keep that copy for all the callers. So these translation units
+/// include Kokkos_SIMD_Types.hpp rather than Kokkos_SIMD.hpp, and the kernel
+/// has internal linkage and works on raw pointers with the simd types of
+/// simd_abi::for_isa alone, whose functions are always inlined. The
+/// fixed_size and complex simd types also call lambdas and standard function
+/// objects, only inlined with the optimizations on. The parallel_for, the
+/// policies and the fences belong to code compiled for the configured
+/// architecture, which calls the dispatch from the body of its parallel loop.
+template <class Signature>
+class simd_dispatch;
+
+template <class R, class... Args>
+class simd_dispatch<R(Args...)> {
+ public:
+  using function_type = R (*)(Args...);
+
+  explicit simd_dispatch(function_type scalar_version) {
+    m_versions[index(simd_isa::scalar)] = scalar_version;
+    m_selected                          = select(host_simd_isa());
+  }
+
+  simd_dispatch& add(simd_isa isa, function_type version) {
+    m_versions[index(isa)] = version;
+    m_selected             = select(host_simd_isa());
+    return *this;
+  }
+
+  // the version run on a processor supporting the instruction sets up to isa
+  function_type select(simd_isa isa) const {
+    while (isa != simd_isa::scalar && !m_versions[index(isa)]) {
+      isa = narrower(isa);
+    }
+    return m_versions[index(isa)];
+  }
+
+  function_type selected() const { return m_selected; }
+
+  R operator()(Args... args) const {
+    return m_selected(std::forward<Args>(args)...);
+  }
+
+ private:
+  static constexpr int index(simd_isa isa) { return static_cast<int>(isa); }
+
+  static constexpr simd_isa narrower(simd_isa isa) {
+    return isa == simd_isa::avx512 ? simd_isa::avx2 : simd_isa::scalar;
+  }
+
+  function_type m_versions[4] = {};
+  function_type m_selected    = nullptr;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,873 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_FIXED_SIZE_HPP
+#define KOKKOS_SIMD_FIXED_SIZE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_SIMD_Common.hpp>
+#include <Kokkos_SIMD_Common_Math.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+// N lanes stored in several registers of the ABIs of the configured
+// architecture. The operations are unrolled over the parts, which are
+// independent of each other and can overlap in the pipeline.
+template <int N>
+class fixed_size {};
+
+namespace Impl {
+
+template <class... Abis>
+class abi_list {};
+
+// The ABIs of the configured architecture with a simd of type T, widest
+// first. The types without any only have the scalar ABI.
+template <class T>
+struct NativeAbis {
+  using type = abi_list<>;
+};
+
+#define KOKKOS_IMPL_SIMD_NATIVE_ABIS(TYPE, ...) \
+  template <>                                   \
+  struct NativeAbis<TYPE> {                     \
+    using type = abi_list<__VA_ARGS__>;         \
+  };
+
+#if defined(KOKKOS_ARCH_AVX512XEON)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(double, avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(float, avx512_fixed_size<16>,
+                             avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int8_t, avx512_fixed_size<64>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint8_t, avx512_fixed_size<64>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int16_t, avx512_fixed_size<32>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int32_t, avx512_fixed_size<16>,
+                             avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint32_t, avx512_fixed_size<16>,
+                             avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int64_t, avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint64_t, avx512_fixed_size<8>)
+#elif defined(KOKKOS_ARCH_AVX2)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(double, avx2_fixed_size<4>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(float, avx2_fixed_size<8>, avx2_fixed_size<4>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int8_t, avx2_fixed_size<32>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint8_t, avx2_fixed_size<32>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int16_t, avx2_fixed_size<16>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int32_t, avx2_fixed_size<8>,
+                             avx2_fixed_size<4>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int64_t, avx2_fixed_size<4>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint64_t, avx2_fixed_size<4>)
+#elif defined(KOKKOS_ARCH_ARM_NEON)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(double, neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(float, neon_fixed_size<4>, neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int8_t, neon_fixed_size<16>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint8_t, neon_fixed_size<16>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int16_t, neon_fixed_size<8>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int32_t, neon_fixed_size<4>,
+                             neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::int64_t, neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_NATIVE_ABIS(std::uint64_t, neon_fixed_size<2>)
+#endif
+
+#undef KOKKOS_IMPL_SIMD_NATIVE_ABIS
+
+template <class T, int N, class Abis>
+struct FirstFixedSizePart {
+  using type = scalar;
+};
+
+template <class T, int N, class Abi, class... Abis>
+struct FirstFixedSizePart<T, N, abi_list<Abi, Abis...>> {
+  using type = std::conditional_t<
+      N % static_cast<int>(simd<T, Abi>::size()) == 0, Abi,
+      typename FirstFixedSizePart<T, N, abi_list<Abis...>>::type>;
+};
+
+// The ABI of the parts of simd<T, fixed_size<N>>, the widest native ABI of T
+// with a width dividing N, scalar if there is none. Like host_native it does
+// not depend on the flags of the translation unit, the kernels of a
+// simd_dispatch agree with the rest of the program on the layout.
+template <class T, int N>
+struct FixedSizePart {
+  static_assert(N > 0, "fixed_size needs at least one lane");
+  using type =
+      typename FirstFixedSizePart<T, N, typename NativeAbis<T>::type>::type;
+};
+
+template <class T, int N>
+using fixed_size_part_t = typename FixedSizePart<T, N>::type;
+
+}  // namespace Impl
+
+}  // namespace simd_abi
+
+namespace Impl {
+
+// Calls f(k) for First <= k < Last, unrolled at compile time: the compilers
+// do not reliably unroll the short loops over the parts of a fixed_size simd
+template <std::size_t... K, class F>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void fixed_size_unroll(
+    std::index_sequence<K...>, F const& f) {
+  (f(K), ...);
+}
+
+template <std::size_t First, std::size_t Last, class F>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void fixed_size_unroll(F const& f) {
+  fixed_size_unroll(std::make_index_sequence<Last - First>(),
+                    [&](std::size_t k) { f(First + k); });
+}
+
+template <class T, int N>
+inline constexpr std::size_t fixed_size_num_parts =
+    N / simd<T, simd_abi::Impl::fixed_size_part_t<T, N>>::size();
+
+// The simd whose parts are op applied to the parts of the arguments
+template <class T, int N, class Op, class... Args>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<T, simd_abi::fixed_size<N>>
+    fixed_size_map(Op const& op, Args const&... args) {
+  simd<T, simd_abi::fixed_size<N>> result;
+  fixed_size_unroll<0, fixed_size_num_parts<T, N>>([&](std::size_t k) {
+    result.impl_get_part(k) = op(args.impl_get_part(k)...);
+  });
+  return result;
+}
+
+}  // namespace Impl
+
+template <class T, int N>
+class simd_mask<T, simd_abi::fixed_size<N>> {
+  using part_type =
+      simd_mask<T, simd_abi::Impl::fixed_size_part_t<T, N>>;
+  static constexpr std::size_t part_size = part_type::size();
+  static constexpr std::size_t num_parts = N / part_size;
+
+  part_type m_parts[num_parts];
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      G&& gen, std::index_sequence<Lanes...>) {
+    bool const values[] = {static_cast<bool>(
+        gen(std::integral_constant<std::size_t, Lanes>()))...};
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      m_parts[k] = part_type(
+          [&](std::size_t lane) { return values[k * part_size + lane]; });
+    });
+  }
+
+ public:
+  using value_type = bool;
+  using abi_type   = simd_abi::fixed_size<N>;
+  using reference  = typename part_type::reference;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return N;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(value_type value) {
+    part_type const broadcast(value);
+    Impl::fixed_size_unroll<0, num_parts>(
+        [&](std::size_t k) { m_parts[k] = broadcast; });
+  }
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      simd_mask<U, abi_type> const& other) {
+    using other_part_type =
+        simd_mask<U, simd_abi::Impl::fixed_size_part_t<U, N>>;
+    if constexpr (std::is_constructible_v<part_type, other_part_type const&>) {
+      Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+        m_parts[k] = part_type(other.impl_get_part(k));
+      });
+    } else {
+      for (std::size_t i = 0; i < size(); ++i) (*this)[i] = other[i];
+    }
+  }
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen)
+      : simd_mask(gen, std::make_index_sequence<N>()) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return m_parts[i / part_size][i % part_size];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return m_parts[i / part_size][i % part_size];
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION part_type&
+  impl_get_part(std::size_t k) {
+    return m_parts[k];
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION part_type const&
+  impl_get_part(std::size_t k) const {
+    return m_parts[k];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator||(simd_mask const& other) const {
+    simd_mask result;
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      result.m_parts[k] = m_parts[k] || other.m_parts[k];
+    });
+    return result;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator&&(simd_mask const& other) const {
+    simd_mask result;
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      result.m_parts[k] = m_parts[k] && other.m_parts[k];
+    });
+    return result;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    simd_mask result;
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      result.m_parts[k] = !m_parts[k];
+    });
+    return result;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      simd_mask const& other) const {
+    bool result = true;
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      result = result && m_parts[k] == other.m_parts[k];
+    });
+    return result;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      simd_mask const& other) const {
+    return !(*this == other);
+  }
+};
+
+template <class T, int N>
+class simd<T, simd_abi::fixed_size<N>> {
+  using part_type = simd<T, simd_abi::Impl::fixed_size_part_t<T, N>>;
+  static constexpr std::size_t part_size = part_type::size();
+  static constexpr std::size_t num_parts = N / part_size;
+
+  part_type m_parts[num_parts];
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(G&& gen,
+                                             std::index_sequence<Lanes...>) {
+    T const values[] = {static_cast<T>(
+        gen(std::integral_constant<std::size_t, Lanes>()))...};
+    copy_from(values, element_aligned_tag());
+  }
+
+ public:
+  using value_type = T;
+  using abi_type   = simd_abi::fixed_size<N>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = typename part_type::reference;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd()                       = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd const&)            = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(simd&&)                 = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd const&) = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd& operator=(simd&&)      = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return N;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value) {
+    part_type const broadcast(static_cast<value_type>(value));
+    Impl::fixed_size_unroll<0, num_parts>(
+        [&](std::size_t k) { m_parts[k] = broadcast; });
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<U, abi_type> const& other) {
+    using other_part_type = simd<U, simd_abi::Impl::fixed_size_part_t<U, N>>;
+    if constexpr (std::is_constructible_v<part_type, other_part_type const&>) {
+      Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+        m_parts[k] = part_type(other.impl_get_part(k));
+      });
+    } else {
+      for (std::size_t i = 0; i < size(); ++i) {
+        (*this)[i] = static_cast<value_type>(other[i]);
+      }
+    }
+  }
+  template <class G,
+            std::enable_if_t<
+                // basically, can you do { value_type r =
+                // gen(std::integral_constant<std::size_t, i>()); }
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen) noexcept
+      : simd(gen, std::make_index_sequence<N>()) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return m_parts[i / part_size][i % part_size];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return m_parts[i / part_size][i % part_size];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      m_parts[k].copy_from(ptr + k * part_size, element_aligned_tag());
+    });
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      m_parts[k].copy_from(ptr + k * part_size, vector_aligned_tag());
+    });
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      m_parts[k].copy_to(ptr + k * part_size, element_aligned_tag());
+    });
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      m_parts[k].copy_to(ptr + k * part_size, vector_aligned_tag());
+    });
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION part_type&
+  impl_get_part(std::size_t k) {
+    return m_parts[k];
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION part_type const&
+  impl_get_part(std::size_t k) const {
+    return m_parts[k];
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd
+  operator-() const noexcept {
+    return Impl::fixed_size_map<T, N>([](auto const& a) { return -a; }, *this);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::multiplies<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::divides<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::plus<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::minus<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(
+        [rhs](auto const& a) { return a >> rhs; }, lhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(
+        [](auto const& a, auto const& b) { return a >> b; }, lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(
+        [rhs](auto const& a) { return a << rhs; }, lhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(
+        [](auto const& a, auto const& b) { return a << b; }, lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator&(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::bit_and<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator|(
+      simd const& lhs, simd const& rhs) noexcept {
+    return Impl::fixed_size_map<T, N>(std::bit_or<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::less<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::greater<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::less_equal<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::greater_equal<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::equal_to<>(), lhs, rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) noexcept {
+    return compare(std::not_equal_to<>(), lhs, rhs);
+  }
+
+ private:
+  template <class Compare>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static mask_type compare(
+      Compare const& comp, simd const& lhs, simd const& rhs) {
+    mask_type result;
+    if constexpr (std::is_invocable_v<Compare const&, part_type const&,
+                                      part_type const&>) {
+      Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+        result.impl_get_part(k) = comp(lhs.m_parts[k], rhs.m_parts[k]);
+      });
+    } else {
+      // some ABIs do not order their integers, like the unsigned ones of AVX2
+      for (std::size_t i = 0; i < size(); ++i) result[i] = comp(lhs[i], rhs[i]);
+    }
+    return result;
+  }
+};
+
+}  // namespace Experimental
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>
+    abs(Experimental::simd<T, Experimental::simd_abi::fixed_size<N>> const&
+            a) {
+  if constexpr (std::is_signed_v<T>) {
+    return Experimental::Impl::fixed_size_map<T, N>(
+        [](auto const& x) { return Kokkos::abs(x); }, a);
+  }
+  return a;
+}
+
+// the rounding functions return double for the integral types, like the ones
+// of the other ABIs
+#define KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION(FUNC)                 \
+  template <class T, int N>                                                 \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION auto FUNC(            \
+      Experimental::simd<T, Experimental::simd_abi::fixed_size<N>> const&   \
+          a) {                                                              \
+    if constexpr (std::is_floating_point_v<T>) {                            \
+      return Experimental::Impl::fixed_size_map<T, N>(                      \
+          [](auto const& x) { return Kokkos::FUNC(x); }, a);                \
+    } else {                                                                \
+      return Experimental::simd<double,                                     \
+                                Experimental::simd_abi::fixed_size<N>>(a);  \
+    }                                                                       \
+  }
+
+KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION(floor)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION(ceil)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION(round)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION(trunc)
+
+#undef KOKKOS_IMPL_SIMD_FIXED_SIZE_ROUNDING_FUNCTION
+
+// the math functions are applied to the parts, which use the vectorized
+// overloads of their ABI where there are some
+#define KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(FUNC)                     \
+  template <class T, int N>                                                  \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>           \
+      FUNC(Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>      \
+               const& a) {                                                   \
+    return Experimental::Impl::fixed_size_map<T, N>(                         \
+        [](auto const& x) { return Kokkos::FUNC(x); }, a);                   \
+  }
+
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(exp)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(exp2)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(log)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(log10)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(log2)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(sqrt)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(cbrt)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(sin)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(cos)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(tan)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(asin)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(acos)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(atan)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(sinh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(cosh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(tanh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(asinh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(acosh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(atanh)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(erf)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(erfc)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(tgamma)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION(lgamma)
+
+#undef KOKKOS_IMPL_SIMD_FIXED_SIZE_UNARY_FUNCTION
+
+#define KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(FUNC)                   \
+  template <class T, int N>                                                 \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                       \
+      Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>          \
+      FUNC(Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>     \
+               const& a,                                                    \
+           Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>     \
+               const& b) {                                                  \
+    return Experimental::Impl::fixed_size_map<T, N>(                        \
+        [](auto const& x, auto const& y) { return Kokkos::FUNC(x, y); }, a, \
+        b);                                                                 \
+  }
+
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(min)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(max)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(pow)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(hypot)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(atan2)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION(copysign)
+
+#undef KOKKOS_IMPL_SIMD_FIXED_SIZE_BINARY_FUNCTION
+
+#define KOKKOS_IMPL_SIMD_FIXED_SIZE_TERNARY_FUNCTION(FUNC)                 \
+  template <class T, int N>                                                \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>         \
+      FUNC(Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>    \
+               const& a,                                                   \
+           Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>    \
+               const& b,                                                   \
+           Experimental::simd<T, Experimental::simd_abi::fixed_size<N>>    \
+               const& c) {                                                 \
+    return Experimental::Impl::fixed_size_map<T, N>(                       \
+        [](auto const& x, auto const& y, auto const& z) {                  \
+          return Kokkos::FUNC(x, y, z);                                    \
+        },                                                                 \
+        a, b, c);                                                          \
+  }
+
+KOKKOS_IMPL_SIMD_FIXED_SIZE_TERNARY_FUNCTION(fma)
+KOKKOS_IMPL_SIMD_FIXED_SIZE_TERNARY_FUNCTION(hypot)
+
+#undef KOKKOS_IMPL_SIMD_FIXED_SIZE_TERNARY_FUNCTION
+
+namespace Experimental {
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<T, simd_abi::fixed_size<N>>
+    condition(simd_mask<T, simd_abi::fixed_size<N>> const& a,
+              simd<T, simd_abi::fixed_size<N>> const& b,
+              simd<T, simd_abi::fixed_size<N>> const& c) {
+  constexpr std::size_t num_parts = Impl::fixed_size_num_parts<T, N>;
+  simd<T, simd_abi::fixed_size<N>> result;
+  Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+    result.impl_get_part(k) = condition(
+        a.impl_get_part(k), b.impl_get_part(k), c.impl_get_part(k));
+  });
+  return result;
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<T, simd_abi::fixed_size<N>>
+    add_sat(simd<T, simd_abi::fixed_size<N>> const& a,
+            simd<T, simd_abi::fixed_size<N>> const& b) {
+  return Impl::fixed_size_map<T, N>(
+      [](auto const& x, auto const& y) { return add_sat(x, y); }, a, b);
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<T, simd_abi::fixed_size<N>>
+    sub_sat(simd<T, simd_abi::fixed_size<N>> const& a,
+            simd<T, simd_abi::fixed_size<N>> const& b) {
+  return Impl::fixed_size_map<T, N>(
+      [](auto const& x, auto const& y) { return sub_sat(x, y); }, a, b);
+}
+
+// the parts of the integers go to the parts of the accumulator when there are
+// as many of them
+template <class T, int N, int M>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::fixed_size<M>>
+    widening_madd(simd<T, simd_abi::fixed_size<N>> const& a,
+                  simd<T, simd_abi::fixed_size<N>> const& b,
+                  simd<std::int32_t, simd_abi::fixed_size<M>> const& c) {
+  constexpr std::size_t num_parts = Impl::fixed_size_num_parts<T, N>;
+  if constexpr (num_parts == Impl::fixed_size_num_parts<std::int32_t, M>) {
+    simd<std::int32_t, simd_abi::fixed_size<M>> result;
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      result.impl_get_part(k) = widening_madd(
+          a.impl_get_part(k), b.impl_get_part(k), c.impl_get_part(k));
+    });
+    return result;
+  } else {
+    return widening_madd<T, simd_abi::fixed_size<N>, simd_abi::fixed_size<M>>(
+        a, b, c);
+  }
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t widening_sum(
+    simd<T, simd_abi::fixed_size<N>> const& a) {
+  constexpr std::size_t num_parts = Impl::fixed_size_num_parts<T, N>;
+  std::int32_t result             = 0;
+  Impl::fixed_size_unroll<0, num_parts>(
+      [&](std::size_t k) { result += widening_sum(a.impl_get_part(k)); });
+  return result;
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  constexpr std::size_t num_parts = Impl::fixed_size_num_parts<T, N>;
+  bool result = true;
+  Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+    result = result && all_of(a.impl_get_part(k));
+  });
+  return result;
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  constexpr std::size_t num_parts = Impl::fixed_size_num_parts<T, N>;
+  bool result = false;
+  Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+    result = result || any_of(a.impl_get_part(k));
+  });
+  return result;
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<T, simd_abi::fixed_size<N>> const& a) {
+  return !any_of(a);
+}
+
+template <class T, int N>
+class const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                             simd<T, simd_abi::fixed_size<N>>> {
+ public:
+  using abi_type   = simd_abi::fixed_size<N>;
+  using value_type = simd<T, abi_type>;
+  using mask_type  = simd_mask<T, abi_type>;
+
+ protected:
+  using part_abi_type = simd_abi::Impl::fixed_size_part_t<T, N>;
+  static constexpr std::size_t part_size =
+      simd<T, part_abi_type>::size();
+  static constexpr std::size_t num_parts = N / part_size;
+
+  // the index parts can be passed to the gathers and scatters of the parts
+  template <class Integral>
+  static constexpr bool index_by_parts_v =
+      std::is_same_v<Integral, std::int32_t> &&
+      std::is_same_v<simd_abi::Impl::fixed_size_part_t<Integral, N>,
+                     part_abi_type>;
+
+  value_type& m_value;
+  mask_type const& m_mask;
+
+ public:
+  const_where_expression(mask_type const& mask_arg, value_type const& value_arg)
+      : m_value(const_cast<value_type&>(value_arg)), m_mask(mask_arg) {}
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(T* mem, element_aligned_tag) const {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      where(m_mask.impl_get_part(k), m_value.impl_get_part(k))
+          .copy_to(mem + k * part_size, element_aligned_tag());
+    });
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_to(T* mem, vector_aligned_tag) const {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      where(m_mask.impl_get_part(k), m_value.impl_get_part(k))
+          .copy_to(mem + k * part_size, vector_aligned_tag());
+    });
+  }
+  template <class Integral>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+      std::enable_if_t<std::is_integral_v<Integral>>
+      scatter_to(T* mem, simd<Integral, abi_type> const& index) const {
+    if constexpr (index_by_parts_v<Integral>) {
+      Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+        where(m_mask.impl_get_part(k), m_value.impl_get_part(k))
+            .scatter_to(mem, index.impl_get_part(k));
+      });
+    } else {
+      for (std::size_t lane = 0; lane < value_type::size(); ++lane) {
+        if (m_mask[lane]) mem[index[lane]] = m_value[lane];
+      }
+    }
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type const&
+  impl_get_value() const {
+    return m_value;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION mask_type const&
+  impl_get_mask() const {
+    return m_mask;
+  }
+};
+
+template <class T, int N>
+class where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                       simd<T, simd_abi::fixed_size<N>>>
+    : public const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                                    simd<T, simd_abi::fixed_size<N>>> {
+  using base_type =
+      const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                             simd<T, simd_abi::fixed_size<N>>>;
+  using base_type::num_parts;
+  using base_type::part_size;
+
+ public:
+  using typename base_type::abi_type;
+  using typename base_type::mask_type;
+  using typename base_type::value_type;
+  where_expression(mask_type const& mask_arg, value_type& value_arg)
+      : base_type(mask_arg, value_arg) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(T const* mem, element_aligned_tag) {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      where(this->m_mask.impl_get_part(k), this->m_value.impl_get_part(k))
+          .copy_from(mem + k * part_size, element_aligned_tag());
+    });
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+  void copy_from(T const* mem, vector_aligned_tag) {
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      where(this->m_mask.impl_get_part(k), this->m_value.impl_get_part(k))
+          .copy_from(mem + k * part_size, vector_aligned_tag());
+    });
+  }
+  template <class Integral>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+      std::enable_if_t<std::is_integral_v<Integral>>
+      gather_from(T const* mem, simd<Integral, abi_type> const& index) {
+    if constexpr (base_type::template index_by_parts_v<Integral>) {
+      Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+        where(this->m_mask.impl_get_part(k), this->m_value.impl_get_part(k))
+            .gather_from(mem, index.impl_get_part(k));
+      });
+    } else {
+      for (std::size_t lane = 0; lane < value_type::size(); ++lane) {
+        if (this->m_mask[lane]) this->m_value[lane] = mem[index[lane]];
+      }
+    }
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void operator=(U&& x) {
+    auto const x_as_value_type = static_cast<value_type>(std::forward<U>(x));
+    Impl::fixed_size_unroll<0, num_parts>([&](std::size_t k) {
+      where(this->m_mask.impl_get_part(k), this->m_value.impl_get_part(k)) =
+          x_as_value_type.impl_get_part(k);
+    });
+  }
+};
+
+// The reductions first combine the parts lane by lane, which leaves a single
+// horizontal reduction instead of one per part. Both steps stay on the
+// vector operations and the stores of the parts.
+
+namespace Impl {
+
+template <class T, int N, class PartOp, class LaneOp>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T fixed_size_reduce(
+    simd_mask<T, simd_abi::fixed_size<N>> const& m,
+    simd<T, simd_abi::fixed_size<N>> const& v, T identity_element,
+    PartOp const& part_op, LaneOp const& lane_op) {
+  using part_type = simd<T, simd_abi::Impl::fixed_size_part_t<T, N>>;
+  constexpr std::size_t num_parts = fixed_size_num_parts<T, N>;
+  part_type const identity(identity_element);
+  part_type result =
+      condition(m.impl_get_part(0), v.impl_get_part(0), identity);
+  fixed_size_unroll<1, num_parts>([&](std::size_t k) {
+    result = part_op(
+        result, condition(m.impl_get_part(k), v.impl_get_part(k), identity));
+  });
+  T lanes[part_type::size()];
+  result.copy_to(lanes, element_aligned_tag());
+  T value = lanes[0];
+  for (std::size_t i = 1; i < part_type::size(); ++i) {
+    value = lane_op(value, lanes[i]);
+  }
+  return value;
+}
+
+}  // namespace Impl
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmin(const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                            simd<T, simd_abi::fixed_size<N>>> const& x) {
+  return Impl::fixed_size_reduce(
+      x.impl_get_mask(), x.impl_get_value(),
+      Kokkos::reduction_identity<T>::min(),
+      [](auto const& a, auto const& b) {
+        if constexpr (std::is_invocable_v<std::less<>, decltype(a),
+                                          decltype(b)>) {
+          return condition(b < a, b, a);
+        } else {
+          return Kokkos::min(a, b);
+        }
+      },
+      [](T a, T b) { return Kokkos::min(a, b); });
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+hmax(const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                            simd<T, simd_abi::fixed_size<N>>> const& x) {
+  return Impl::fixed_size_reduce(
+      x.impl_get_mask(), x.impl_get_value(),
+      Kokkos::reduction_identity<T>::max(),
+      [](auto const& a, auto const& b) {
+        if constexpr (std::is_invocable_v<std::less<>, decltype(a),
+                                          decltype(b)>) {
+          return condition(a < b, b, a);
+        } else {
+          return Kokkos::max(a, b);
+        }
+      },
+      [](T a, T b) { return Kokkos::max(a, b); });
+}
+
+template <class T, int N>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION T
+reduce(const_where_expression<simd_mask<T, simd_abi::fixed_size<N>>,
+                              simd<T, simd_abi::fixed_size<N>>> const& x,
+       T identity_element, std::plus<> op) {
+  return Impl::fixed_size_reduce(x.impl_get_mask(), x.impl_get_value(),
+                                 identity_element, op, op);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
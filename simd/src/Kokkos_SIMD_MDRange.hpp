@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_MDRANGE_HPP
+#define KOKKOS_SIMD_MDRANGE_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_SIMD.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+// Index of one chunk of the innermost dimension of an MDRangePolicy launched
+// through parallel_for_simd. The chunk covers the indices
+// [first(), first() + count()) and count() is only smaller than size() for the
+// last chunk of the range, in which case mask() selects the valid lanes.
+template <class T, class Abi = simd_abi::native<T>>
+class simd_index {
+ public:
+  using value_type = T;
+  using abi_type   = Abi;
+  using simd_type  = simd<T, Abi>;
+  using mask_type  = simd_mask<T, Abi>;
+  using index_type = std::int64_t;
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return simd_type::size();
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd_index(index_type first,
+                                                   index_type count)
+      : m_first(first), m_count(count) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION constexpr index_type first() const {
+    return m_first;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr index_type count() const {
+    return m_count;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr bool is_full() const {
+    return m_count == static_cast<index_type>(size());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION mask_type mask() const {
+    index_type const count = m_count;
+    return mask_type([=](std::size_t lane) {
+      return static_cast<index_type>(lane) < count;
+    });
+  }
+
+ private:
+  index_type m_first;
+  index_type m_count;
+};
+
+namespace Impl {
+
+// Wraps a functor taking a simd_index in its innermost argument so that it can
+// be launched over an MDRangePolicy whose innermost dimension enumerates
+// chunks instead of single indices.
+template <class Functor, class SimdIndex, int Rank, int SimdDim>
+struct ParallelForSimdFunctor {
+  using index_type = typename SimdIndex::index_type;
+
+  Functor m_functor;
+  index_type m_lower;
+  index_type m_upper;
+
+  template <class... Idx>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<sizeof...(Idx) == Rank>
+  operator()(Idx... idx) const {
+    Kokkos::Array<index_type, Rank> const indices{
+        static_cast<index_type>(idx)...};
+    invoke(std::make_index_sequence<Rank>(), indices);
+  }
+
+  template <class Tag, class... Idx>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<sizeof...(Idx) == Rank>
+  operator()(Tag const& tag, Idx... idx) const {
+    Kokkos::Array<index_type, Rank> const indices{
+        static_cast<index_type>(idx)...};
+    invoke(std::make_index_sequence<Rank>(), indices, tag);
+  }
+
+ private:
+  template <std::size_t I>
+  KOKKOS_FORCEINLINE_FUNCTION auto argument(
+      Kokkos::Array<index_type, Rank> const& indices) const {
+    if constexpr (I == SimdDim) {
+      constexpr auto width       = static_cast<index_type>(SimdIndex::size());
+      index_type const first     = m_lower + indices[I] * width;
+      index_type const remaining = m_upper - first;
+      return SimdIndex(first, remaining < width ? remaining : width);
+    } else {
+      return indices[I];
+    }
+  }
+
+  template <std::size_t... Is, class... Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void invoke(
+      std::index_sequence<Is...>,
+      Kokkos::Array<index_type, Rank> const& indices, Tag const&... tag) const {
+    m_functor(tag..., argument<Is>(indices)...);
+  }
+};
+
+}  // namespace Impl
+
+// Launches functor over policy with the innermost dimension (the last one for
+// Iterate::Right inner iteration, the first one for Iterate::Left) executed in
+// chunks of Simd::size() consecutive indices. The functor receives a
+// simd_index<typename Simd::value_type, typename Simd::abi_type> in place of
+// that index and is expected to handle a partial final chunk through
+// simd_index::mask(). The inner tile extent is divided by the vector width so
+// that each tile still covers the same index space.
+template <class Simd, class... Properties, class Functor>
+void parallel_for_simd(std::string_view label,
+                       MDRangePolicy<Properties...> const& policy,
+                       Functor const& functor) {
+  using policy_type = MDRangePolicy<Properties...>;
+  using simd_index_type =
+      simd_index<typename Simd::value_type, typename Simd::abi_type>;
+  using index_type           = typename simd_index_type::index_type;
+  constexpr int rank         = policy_type::rank;
+  constexpr int simd_dim     = policy_type::inner_direction == Iterate::Right
+                                   ? rank - 1
+                                   : 0;
+  constexpr index_type width = simd_index_type::size();
+
+  auto lower = policy.m_lower;
+  auto upper = policy.m_upper;
+  auto tile  = policy.m_tile;
+
+  index_type const simd_lower = lower[simd_dim];
+  index_type const simd_upper = upper[simd_dim];
+  lower[simd_dim]             = 0;
+  upper[simd_dim] = simd_upper > simd_lower
+                        ? (simd_upper - simd_lower + width - 1) / width
+                        : 0;
+  if (tile[simd_dim] > 0) tile[simd_dim] = (tile[simd_dim] + width - 1) / width;
+
+  Kokkos::parallel_for(
+      label, policy_type(policy.space(), lower, upper, tile),
+      Impl::ParallelForSimdFunctor<Functor, simd_index_type, rank, simd_dim>{
+          functor, simd_lower, simd_upper});
+}
+
+template <class Simd, class... Properties, class Functor>
+void parallel_for_simd(MDRangePolicy<Properties...> const& policy,
+                       Functor const& functor) {
+  parallel_for_simd<Simd>("", policy, functor);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
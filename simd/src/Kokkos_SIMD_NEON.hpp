@@ -19,6 +19,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 #include <Kokkos_SIMD_Common.hpp>
 
@@ -2687,6 +2688,537 @@ class where_expression<simd_mask<std::uint64_t, simd_abi::neon_fixed_size<2>>,
   }
 };
 
+// The 8 and 16-bit integers fill the register with 16 or 8 lanes, they share
+// their implementation through the bases below.
+
+namespace Impl {
+
+template <class Derived, int Bits>
+class neon_narrow_mask {
+  static constexpr int lanes = 128 / Bits;
+  using lane_type = std::conditional_t<Bits == 8, std::uint8_t, std::uint16_t>;
+
+ public:
+  using implementation_type =
+      std::conditional_t<Bits == 8, uint8x16_t, uint16x8_t>;
+
+ private:
+  implementation_type m_value;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static uint8x16_t bytes(
+      implementation_type const& value) {
+    if constexpr (Bits == 8) {
+      return value;
+    } else {
+      return vreinterpretq_u8_u16(value);
+    }
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static implementation_type from_bytes(
+      uint8x16_t const& value) {
+    if constexpr (Bits == 8) {
+      return value;
+    } else {
+      return vreinterpretq_u16_u8(value);
+    }
+  }
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static implementation_type generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    lane_type const values[] = {static_cast<lane_type>(
+        gen(std::integral_constant<std::size_t, Lanes>()) ? -1 : 0)...};
+    if constexpr (Bits == 8) {
+      return vld1q_u8(values);
+    } else {
+      return vld1q_u16(values);
+    }
+  }
+
+ public:
+  class reference {
+    implementation_type& m_mask;
+    int m_lane;
+
+   public:
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference(
+        implementation_type& mask_arg, int lane_arg)
+        : m_mask(mask_arg), m_lane(lane_arg) {}
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference
+    operator=(bool value) const {
+      m_mask[m_lane] = static_cast<lane_type>(value ? -1 : 0);
+      return *this;
+    }
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator bool() const {
+      return m_mask[m_lane] != 0;
+    }
+  };
+  using value_type = bool;
+  using abi_type   = simd_abi::neon_fixed_size<lanes>;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION neon_narrow_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit neon_narrow_mask(
+      value_type value)
+      : m_value(from_bytes(vdupq_n_u8(value ? 0xFF : 0))) {}
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION neon_narrow_mask(
+      simd_mask<U, abi_type> const& other)
+      : m_value(static_cast<implementation_type>(other)) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit neon_narrow_mask(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<lanes>())) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return lanes;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit neon_narrow_mask(
+      implementation_type const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit
+  operator implementation_type() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return static_cast<value_type>(
+        reference(const_cast<implementation_type&>(m_value), int(i)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Derived
+  operator||(neon_narrow_mask const& other) const {
+    return Derived(from_bytes(vorrq_u8(bytes(m_value), bytes(other.m_value))));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Derived
+  operator&&(neon_narrow_mask const& other) const {
+    return Derived(from_bytes(vandq_u8(bytes(m_value), bytes(other.m_value))));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Derived operator!() const {
+    return Derived(from_bytes(vmvnq_u8(bytes(m_value))));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      neon_narrow_mask const& other) const {
+    return vminvq_u8(vceqq_u8(bytes(m_value), bytes(other.m_value))) == 0xFF;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      neon_narrow_mask const& other) const {
+    return !operator==(other);
+  }
+};
+
+template <class T>
+class neon_narrow_simd {
+  static constexpr int lanes = 16 / sizeof(T);
+  using simd_type            = simd<T, simd_abi::neon_fixed_size<lanes>>;
+
+ public:
+  using implementation_type = std::conditional_t<
+      std::is_same_v<T, std::int8_t>, int8x16_t,
+      std::conditional_t<std::is_same_v<T, std::uint8_t>, uint8x16_t,
+                         int16x8_t>>;
+
+ private:
+  implementation_type m_value;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static implementation_type load(
+      T const* ptr) {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return vld1q_s8(ptr);
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return vld1q_u8(ptr);
+    } else {
+      return vld1q_s16(ptr);
+    }
+  }
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static implementation_type generate(
+      G&& gen, std::index_sequence<Lanes...>) {
+    T const values[] = {
+        static_cast<T>(gen(std::integral_constant<std::size_t, Lanes>()))...};
+    return load(values);
+  }
+
+ public:
+  using value_type = T;
+  using abi_type   = simd_abi::neon_fixed_size<lanes>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  class reference {
+    implementation_type& m_value;
+    int m_lane;
+
+   public:
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference(
+        implementation_type& value_arg, int lane_arg)
+        : m_value(value_arg), m_lane(lane_arg) {}
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference
+    operator=(value_type value) const {
+      m_value[m_lane] = value;
+      return *this;
+    }
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator value_type() const {
+      return m_value[m_lane];
+    }
+  };
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION neon_narrow_simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return lanes;
+  }
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION neon_narrow_simd(U&& value) {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      m_value = vdupq_n_s8(value_type(value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      m_value = vdupq_n_u8(value_type(value));
+    } else {
+      m_value = vdupq_n_s16(value_type(value));
+    }
+  }
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit neon_narrow_simd(G&& gen)
+      : m_value(generate(gen, std::make_index_sequence<lanes>())) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit neon_narrow_simd(
+      implementation_type const& value_in)
+      : m_value(value_in) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value, int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return reference(const_cast<implementation_type&>(m_value), int(i));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = load(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = load(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    copy_to(ptr, vector_aligned_tag());
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      vst1q_s8(ptr, m_value);
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      vst1q_u8(ptr, m_value);
+    } else {
+      vst1q_s16(ptr, m_value);
+    }
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION constexpr explicit
+  operator implementation_type() const {
+    return m_value;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_type
+  operator-() const noexcept {
+    return neon_narrow_simd(value_type(0)) - *this;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return mask_type(vceqq_s8(lhs.m_value, rhs.m_value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return mask_type(vceqq_u8(lhs.m_value, rhs.m_value));
+    } else {
+      return mask_type(vceqq_s16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(neon_narrow_simd const& lhs,
+            neon_narrow_simd const& rhs) noexcept {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return mask_type(vcgtq_s8(lhs.m_value, rhs.m_value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return mask_type(vcgtq_u8(lhs.m_value, rhs.m_value));
+    } else {
+      return mask_type(vcgtq_s16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(neon_narrow_simd const& lhs,
+            neon_narrow_simd const& rhs) noexcept {
+    return rhs > lhs;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    return !(lhs > rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    return !(rhs > lhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator-(neon_narrow_simd const& lhs,
+            neon_narrow_simd const& rhs) noexcept {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return simd_type(vsubq_s8(lhs.m_value, rhs.m_value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return simd_type(vsubq_u8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(vsubq_s16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator+(neon_narrow_simd const& lhs,
+            neon_narrow_simd const& rhs) noexcept {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return simd_type(vaddq_s8(lhs.m_value, rhs.m_value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return simd_type(vaddq_u8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(vaddq_s16(lhs.m_value, rhs.m_value));
+    }
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator*(neon_narrow_simd const& lhs,
+            neon_narrow_simd const& rhs) noexcept {
+    if constexpr (std::is_same_v<T, std::int8_t>) {
+      return simd_type(vmulq_s8(lhs.m_value, rhs.m_value));
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+      return simd_type(vmulq_u8(lhs.m_value, rhs.m_value));
+    } else {
+      return simd_type(vmulq_s16(lhs.m_value, rhs.m_value));
+    }
+  }
+  // NEON shifts bytes too (vshlq_s8, vshlq_u8), but x86 has no 8-bit shifts
+  // and the narrow ABIs keep the same operations on every architecture
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator>>(neon_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(
+        vshlq_s16(lhs.m_value, vdupq_n_s16(std::int16_t(-rhs))));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator>>(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    return simd_type(vshlq_s16(lhs.m_value, vnegq_s16(rhs.m_value)));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator<<(neon_narrow_simd const& lhs, int rhs) noexcept {
+    return simd_type(vshlq_s16(lhs.m_value, vdupq_n_s16(std::int16_t(rhs))));
+  }
+  template <class U = T, std::enable_if_t<sizeof(U) == 2, bool> = false>
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator<<(neon_narrow_simd const& lhs,
+             neon_narrow_simd const& rhs) noexcept {
+    return simd_type(vshlq_s16(lhs.m_value, rhs.m_value));
+  }
+};
+
+}  // namespace Impl
+
+template <class T>
+class simd_mask<T, simd_abi::neon_fixed_size<16>>
+    : public Impl::neon_narrow_mask<simd_mask<T, simd_abi::neon_fixed_size<16>>,
+                                    8> {
+  using base_type =
+      Impl::neon_narrow_mask<simd_mask<T, simd_abi::neon_fixed_size<16>>, 8>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <class T>
+class simd_mask<T, simd_abi::neon_fixed_size<8>>
+    : public Impl::neon_narrow_mask<simd_mask<T, simd_abi::neon_fixed_size<8>>,
+                                    16> {
+  using base_type =
+      Impl::neon_narrow_mask<simd_mask<T, simd_abi::neon_fixed_size<8>>, 16>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int8_t, simd_abi::neon_fixed_size<16>>
+    : public Impl::neon_narrow_simd<std::int8_t> {
+  using base_type = Impl::neon_narrow_simd<std::int8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::uint8_t, simd_abi::neon_fixed_size<16>>
+    : public Impl::neon_narrow_simd<std::uint8_t> {
+  using base_type = Impl::neon_narrow_simd<std::uint8_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+template <>
+class simd<std::int16_t, simd_abi::neon_fixed_size<8>>
+    : public Impl::neon_narrow_simd<std::int16_t> {
+  using base_type = Impl::neon_narrow_simd<std::int16_t>;
+
+ public:
+  using base_type::base_type;
+};
+
+}  // namespace Experimental
+
+#define KOKKOS_IMPL_SIMD_NEON_NARROW_FUNCTIONS(TYPE, N, SUFFIX)                \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::simd<TYPE, Experimental::simd_abi::neon_fixed_size<N>>     \
+      min(Experimental::simd<                                                  \
+              TYPE, Experimental::simd_abi::neon_fixed_size<N>> const& a,      \
+          Experimental::simd<                                                  \
+              TYPE, Experimental::simd_abi::neon_fixed_size<N>> const& b) {    \
+    using simd_type =                                                          \
+        Experimental::simd<TYPE, Experimental::simd_abi::neon_fixed_size<N>>;  \
+    return simd_type(vminq_##SUFFIX(                                           \
+        static_cast<typename simd_type::implementation_type>(a),               \
+        static_cast<typename simd_type::implementation_type>(b)));             \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::simd<TYPE, Experimental::simd_abi::neon_fixed_size<N>>     \
+      max(Experimental::simd<                                                  \
+              TYPE, Experimental::simd_abi::neon_fixed_size<N>> const& a,      \
+          Experimental::simd<                                                  \
+              TYPE, Experimental::simd_abi::neon_fixed_size<N>> const& b) {    \
+    using simd_type =                                                          \
+        Experimental::simd<TYPE, Experimental::simd_abi::neon_fixed_size<N>>;  \
+    return simd_type(vmaxq_##SUFFIX(                                           \
+        static_cast<typename simd_type::implementation_type>(a),               \
+        static_cast<typename simd_type::implementation_type>(b)));             \
+  }                                                                            \
+  namespace Experimental {                                                     \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      simd<TYPE, simd_abi::neon_fixed_size<N>>                                 \
+      condition(simd_mask<TYPE, simd_abi::neon_fixed_size<N>> const& a,        \
+                simd<TYPE, simd_abi::neon_fixed_size<N>> const& b,             \
+                simd<TYPE, simd_abi::neon_fixed_size<N>> const& c) {           \
+    using simd_type = simd<TYPE, simd_abi::neon_fixed_size<N>>;                \
+    return simd_type(vbslq_##SUFFIX(                                           \
+        static_cast<typename simd_type::mask_type::implementation_type>(a),    \
+        static_cast<typename simd_type::implementation_type>(b),               \
+        static_cast<typename simd_type::implementation_type>(c)));             \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      simd<TYPE, simd_abi::neon_fixed_size<N>>                                 \
+      add_sat(simd<TYPE, simd_abi::neon_fixed_size<N>> const& a,               \
+              simd<TYPE, simd_abi::neon_fixed_size<N>> const& b) {             \
+    using simd_type = simd<TYPE, simd_abi::neon_fixed_size<N>>;                \
+    return simd_type(vqaddq_##SUFFIX(                                          \
+        static_cast<typename simd_type::implementation_type>(a),               \
+        static_cast<typename simd_type::implementation_type>(b)));             \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      simd<TYPE, simd_abi::neon_fixed_size<N>>                                 \
+      sub_sat(simd<TYPE, simd_abi::neon_fixed_size<N>> const& a,               \
+              simd<TYPE, simd_abi::neon_fixed_size<N>> const& b) {             \
+    using simd_type = simd<TYPE, simd_abi::neon_fixed_size<N>>;                \
+    return simd_type(vqsubq_##SUFFIX(                                          \
+        static_cast<typename simd_type::implementation_type>(a),               \
+        static_cast<typename simd_type::implementation_type>(b)));             \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::int32_t             \
+  widening_sum(simd<TYPE, simd_abi::neon_fixed_size<N>> const& a) {            \
+    using simd_type = simd<TYPE, simd_abi::neon_fixed_size<N>>;                \
+    return vaddlvq_##SUFFIX(                                                   \
+        static_cast<typename simd_type::implementation_type>(a));              \
+  }                                                                            \
+  }
+
+KOKKOS_IMPL_SIMD_NEON_NARROW_FUNCTIONS(std::int8_t, 16, s8)
+KOKKOS_IMPL_SIMD_NEON_NARROW_FUNCTIONS(std::uint8_t, 16, u8)
+KOKKOS_IMPL_SIMD_NEON_NARROW_FUNCTIONS(std::int16_t, 8, s16)
+
+#undef KOKKOS_IMPL_SIMD_NEON_NARROW_FUNCTIONS
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int8_t, Experimental::simd_abi::neon_fixed_size<16>>
+    abs(Experimental::simd<
+        std::int8_t, Experimental::simd_abi::neon_fixed_size<16>> const& a) {
+  return Experimental::simd<std::int8_t,
+                            Experimental::simd_abi::neon_fixed_size<16>>(
+      vabsq_s8(static_cast<int8x16_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::uint8_t,
+                       Experimental::simd_abi::neon_fixed_size<16>>
+    abs(Experimental::simd<
+        std::uint8_t, Experimental::simd_abi::neon_fixed_size<16>> const& a) {
+  return a;
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int16_t, Experimental::simd_abi::neon_fixed_size<8>>
+    abs(Experimental::simd<
+        std::int16_t, Experimental::simd_abi::neon_fixed_size<8>> const& a) {
+  return Experimental::simd<std::int16_t,
+                            Experimental::simd_abi::neon_fixed_size<8>>(
+      vabsq_s16(static_cast<int16x8_t>(a)));
+}
+
+namespace Experimental {
+
+// the products of the low and high halves are widened, then their pairwise
+// sums are added up pairwise again
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::neon_fixed_size<4>>
+    widening_madd(simd<std::int8_t, simd_abi::neon_fixed_size<16>> const& a,
+                  simd<std::int8_t, simd_abi::neon_fixed_size<16>> const& b,
+                  simd<std::int32_t, simd_abi::neon_fixed_size<4>> const& c) {
+  int8x16_t const a_value = static_cast<int8x16_t>(a);
+  int8x16_t const b_value = static_cast<int8x16_t>(b);
+  int32x4_t const low =
+      vpaddlq_s16(vmull_s8(vget_low_s8(a_value), vget_low_s8(b_value)));
+  int32x4_t const high = vpaddlq_s16(vmull_high_s8(a_value, b_value));
+  return simd<std::int32_t, simd_abi::neon_fixed_size<4>>(
+      vaddq_s32(static_cast<int32x4_t>(c), vpaddq_s32(low, high)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::neon_fixed_size<4>>
+    widening_madd(simd<std::uint8_t, simd_abi::neon_fixed_size<16>> const& a,
+                  simd<std::uint8_t, simd_abi::neon_fixed_size<16>> const& b,
+                  simd<std::int32_t, simd_abi::neon_fixed_size<4>> const& c) {
+  uint8x16_t const a_value = static_cast<uint8x16_t>(a);
+  uint8x16_t const b_value = static_cast<uint8x16_t>(b);
+  uint32x4_t const low =
+      vpaddlq_u16(vmull_u8(vget_low_u8(a_value), vget_low_u8(b_value)));
+  uint32x4_t const high = vpaddlq_u16(vmull_high_u8(a_value, b_value));
+  return simd<std::int32_t, simd_abi::neon_fixed_size<4>>(
+      vaddq_s32(static_cast<int32x4_t>(c),
+                vreinterpretq_s32_u32(vpaddq_u32(low, high))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::neon_fixed_size<4>>
+    widening_madd(simd<std::int16_t, simd_abi::neon_fixed_size<8>> const& a,
+                  simd<std::int16_t, simd_abi::neon_fixed_size<8>> const& b,
+                  simd<std::int32_t, simd_abi::neon_fixed_size<4>> const& c) {
+  int16x8_t const a_value = static_cast<int16x8_t>(a);
+  int16x8_t const b_value = static_cast<int16x8_t>(b);
+  int32x4_t const low =
+      vmull_s16(vget_low_s16(a_value), vget_low_s16(b_value));
+  int32x4_t const high = vmull_high_s16(a_value, b_value);
+  return simd<std::int32_t, simd_abi::neon_fixed_size<4>>(
+      vaddq_s32(static_cast<int32x4_t>(c), vpaddq_s32(low, high)));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -17,11 +17,13 @@
 #ifndef KOKKOS_SIMD_SCALAR_HPP
 #define KOKKOS_SIMD_SCALAR_HPP
 
+#include <functional>
 #include <type_traits>
 #include <climits>
 #include <cfloat>
 
 #include <Kokkos_SIMD_Common.hpp>
+#include <desul/atomics/Common.hpp>  // dont_deduce_this_parameter_t
 
 #ifdef KOKKOS_SIMD_COMMON_MATH_HPP
 #error \
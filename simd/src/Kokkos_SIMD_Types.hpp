@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_TYPES_HPP
+#define KOKKOS_SIMD_TYPES_HPP
+
+// The simd types and their functions without the rest of Kokkos, for the
+// translation units of the kernels of a simd_dispatch compiled for a wider
+// instruction set than the configured architecture
+
+#include <impl/Kokkos_CPUDiscovery.hpp>  // HostSimdIsa
+
+#include <Kokkos_SIMD_Common.hpp>
+
+// suppress NVCC warnings with the [[nodiscard]] attribute on overloaded
+// operators implemented as hidden friends
+#if defined(KOKKOS_COMPILER_NVCC) && KOKKOS_COMPILER_NVCC < 1130
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattributes"
+#endif
+
+#include <Kokkos_SIMD_Scalar.hpp>
+
+#include <Kokkos_Macros.hpp>
+
+// FIXME_OPENMPTARGET The device pass disables all compiler macros checked
+#ifdef KOKKOS_ENABLE_OPENMPTARGET
+#if defined(KOKKOS_ARCH_AVX2)
+#include <Kokkos_SIMD_AVX2.hpp>
+#endif
+
+#if defined(KOKKOS_ARCH_AVX512XEON)
+#include <Kokkos_SIMD_AVX512.hpp>
+#endif
+
+#if defined(KOKKOS_ARCH_ARM_NEON)
+#include <Kokkos_SIMD_NEON.hpp>
+#endif
+#else  // KOKKOS_ENABLE_OPENMPTARGET
+#if defined(KOKKOS_ARCH_AVX) && !defined(__AVX__)
+#error "__AVX__ must be defined for KOKKOS_ARCH_AVX"
+#endif
+
+// Host translation units compiled for a wider instruction set than the
+// configured architecture, like the kernels of a simd_dispatch, also get the
+// ABIs of that instruction set
+#if !defined(__CUDACC__) && !defined(__HIPCC__) && \
+    !defined(SYCL_LANGUAGE_VERSION)
+#if defined(__AVX2__) && defined(__FMA__)
+#define KOKKOS_IMPL_SIMD_TARGET_AVX2
+#endif
+#if defined(__AVX512F__) && defined(__AVX512VL__) && \
+    defined(__AVX512DQ__) && defined(__FMA__)
+#define KOKKOS_IMPL_SIMD_TARGET_AVX512
+#endif
+#endif
+
+#if defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_IMPL_SIMD_TARGET_AVX2)
+#if !defined(__AVX2__)
+#error "__AVX2__ must be defined for KOKKOS_ARCH_AVX2"
+#endif
+#include <Kokkos_SIMD_AVX2.hpp>
+#endif
+
+#if defined(KOKKOS_ARCH_AVX512XEON) || defined(KOKKOS_IMPL_SIMD_TARGET_AVX512)
+#if !defined(__AVX512F__)
+#error "__AVX512F__ must be defined for KOKKOS_ARCH_AVX512XEON"
+#endif
+#include <Kokkos_SIMD_AVX512.hpp>
+#endif
+
+#if defined(KOKKOS_ARCH_ARM_NEON)
+#if !defined(__ARM_NEON)
+#error "__ARM_NEON must be definded for KOKKOS_ARCH_ARM_NEON"
+#endif
+#include <Kokkos_SIMD_NEON.hpp>
+#endif
+#endif
+
+#if defined(KOKKOS_COMPILER_NVCC) && KOKKOS_COMPILER_NVCC < 1130
+#pragma GCC diagnostic pop
+#endif
+
+#include <Kokkos_SIMD_Common_Math.hpp>
+#include <Kokkos_SIMD_FixedSize.hpp>
+#include <Kokkos_SIMD_Complex.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+using simd_isa = Kokkos::Impl::HostSimdIsa;
+
+namespace simd_abi {
+
+namespace Impl {
+
+template <simd_isa Isa>
+struct ForIsa;
+
+template <>
+struct ForIsa<simd_isa::scalar> {
+  using type = scalar;
+};
+
+#ifdef KOKKOS_SIMD_AVX2_HPP
+template <>
+struct ForIsa<simd_isa::avx2> {
+  using type = avx2_fixed_size<4>;
+};
+#endif
+
+#ifdef KOKKOS_SIMD_AVX512_HPP
+template <>
+struct ForIsa<simd_isa::avx512> {
+  using type = avx512_fixed_size<8>;
+};
+#endif
+
+#ifdef KOKKOS_SIMD_NEON_HPP
+template <>
+struct ForIsa<simd_isa::neon> {
+  using type = neon_fixed_size<2>;
+};
+#endif
+
+}  // namespace Impl
+
+// The ABI host_native would be for an instruction set, only available in the
+// translation units compiled for that instruction set
+template <simd_isa Isa>
+using for_isa = typename Impl::ForIsa<Isa>::type;
+
+}  // namespace simd_abi
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -23,3 +23,8 @@
 #include <TestSIMD_WhereExpressions.hpp>
 #include <TestSIMD_Reductions.hpp>
 #include <TestSIMD_Construction.hpp>
+#include <TestSIMD_MDRange.hpp>
+#include <TestSIMD_Dispatch.hpp>
+#include <TestSIMD_Complex.hpp>
+#include <TestSIMD_NarrowIntegers.hpp>
+#include <TestSIMD_FixedSize.hpp>
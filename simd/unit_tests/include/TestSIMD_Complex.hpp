@@ -0,0 +1,152 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_COMPLEX_HPP
+#define KOKKOS_TEST_SIMD_COMPLEX_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+template <typename Abi, typename DataType>
+inline void host_check_complex() {
+  if constexpr (!std::is_same_v<Abi, Kokkos::Experimental::simd_abi::scalar> &&
+                is_type_v<Kokkos::Experimental::simd<DataType, Abi>>) {
+    using complex_type = Kokkos::complex<DataType>;
+    using simd_type    = Kokkos::Experimental::simd<complex_type, Abi>;
+    using real_type    = Kokkos::Experimental::simd<DataType, Abi>;
+    constexpr std::size_t width = simd_type::size();
+    static_assert(std::is_same_v<typename simd_type::mask_type,
+                                 typename real_type::mask_type>);
+
+    // small halves, the products and sums are exact
+    Kokkos::View<complex_type*, Kokkos::HostSpace> a_view("a", width);
+    complex_type b[width];
+    complex_type c[width];
+    for (std::size_t i = 0; i < width; ++i) {
+      a_view(i) = complex_type(DataType(i) + 1, DataType(0.5) * i - 2);
+      b[i]      = complex_type(DataType(3) - i, DataType(1.5) + i);
+      c[i]      = complex_type(DataType(-0.5) * i, DataType(i) * 2);
+    }
+
+    simd_type a_simd;
+    simd_type b_simd;
+    simd_type c_simd;
+    a_simd.copy_from(a_view.data(), Kokkos::Experimental::simd_flag_default);
+    b_simd.copy_from(b, Kokkos::Experimental::simd_flag_default);
+    c_simd.copy_from(c, Kokkos::Experimental::simd_flag_default);
+
+    Kokkos::View<complex_type*, Kokkos::HostSpace> round_trip("round_trip",
+                                                              width);
+    a_simd.copy_to(round_trip.data(), Kokkos::Experimental::simd_flag_default);
+    real_type const re = Kokkos::real(a_simd);
+    real_type const im = Kokkos::imag(a_simd);
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(round_trip(i), a_view(i));
+      EXPECT_EQ(a_simd[i], a_view(i));
+      EXPECT_EQ(re[i], a_view(i).real());
+      EXPECT_EQ(im[i], a_view(i).imag());
+    }
+
+    simd_type const sum        = a_simd + b_simd;
+    simd_type const difference = a_simd - b_simd;
+    simd_type const product    = a_simd * b_simd;
+    simd_type const fused      = Kokkos::fma(a_simd, b_simd, c_simd);
+    simd_type const conjugate  = Kokkos::conj(a_simd);
+    simd_type const negation   = -a_simd;
+    simd_type const quotient   = a_simd / b_simd;
+    real_type const magnitude  = Kokkos::abs(b_simd);
+    for (std::size_t i = 0; i < width; ++i) {
+      complex_type const a_i = a_view(i);
+      EXPECT_EQ(sum[i], a_i + b[i]);
+      EXPECT_EQ(difference[i], a_i - b[i]);
+      EXPECT_EQ(product[i], a_i * b[i]);
+      EXPECT_EQ(fused[i], a_i * b[i] + c[i]);
+      EXPECT_EQ(conjugate[i], Kokkos::conj(a_i));
+      EXPECT_EQ(negation[i], -a_i);
+      complex_type const expected_quotient = a_i / b[i];
+      DataType const tolerance = 16 * Kokkos::Experimental::epsilon_v<DataType>;
+      EXPECT_NEAR(quotient[i].real(), expected_quotient.real(),
+                  tolerance * Kokkos::abs(expected_quotient));
+      EXPECT_NEAR(quotient[i].imag(), expected_quotient.imag(),
+                  tolerance * Kokkos::abs(expected_quotient));
+      EXPECT_NEAR(magnitude[i], Kokkos::abs(b[i]),
+                  tolerance * Kokkos::abs(b[i]));
+    }
+
+    // the squares of these magnitudes overflow or underflow, the quotients
+    // and the magnitudes do not
+    DataType const huge =
+        std::is_same_v<DataType, double> ? DataType(1e200) : DataType(1e30);
+    for (DataType const magnitude_scale : {huge, DataType(1) / huge}) {
+      complex_type x[width];
+      complex_type y[width];
+      for (std::size_t i = 0; i < width; ++i) {
+        x[i] = magnitude_scale *
+               complex_type(DataType(i) + 1, DataType(0.5) * i - 2);
+        y[i] = magnitude_scale *
+               complex_type(DataType(i) + 2, DataType(1.5) - i);
+      }
+      simd_type x_simd;
+      simd_type y_simd;
+      x_simd.copy_from(x, Kokkos::Experimental::simd_flag_default);
+      y_simd.copy_from(y, Kokkos::Experimental::simd_flag_default);
+      simd_type const scaled_quotient  = x_simd / y_simd;
+      real_type const scaled_magnitude = Kokkos::abs(y_simd);
+      DataType const tolerance = 16 * Kokkos::Experimental::epsilon_v<DataType>;
+      for (std::size_t i = 0; i < width; ++i) {
+        complex_type const expected_quotient = x[i] / y[i];
+        EXPECT_NEAR(scaled_quotient[i].real(), expected_quotient.real(),
+                    tolerance * Kokkos::abs(expected_quotient));
+        EXPECT_NEAR(scaled_quotient[i].imag(), expected_quotient.imag(),
+                    tolerance * Kokkos::abs(expected_quotient));
+        EXPECT_NEAR(scaled_magnitude[i], Kokkos::abs(y[i]),
+                    tolerance * Kokkos::abs(y[i]));
+      }
+    }
+
+    EXPECT_TRUE(all_of(a_simd == a_simd));
+    EXPECT_TRUE(none_of(a_simd != a_simd));
+    EXPECT_TRUE(all_of(simd_type(complex_type(1, 2)) ==
+                       simd_type(real_type(1), real_type(2))));
+    EXPECT_TRUE(all_of(
+        simd_type([&](std::size_t i) { return a_view(i); }) == a_simd));
+
+    auto const mask   = Kokkos::real(a_simd) < real_type(3);
+    simd_type const selected =
+        Kokkos::Experimental::condition(mask, a_simd, b_simd);
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(selected[i], mask[i] ? a_view(i) : b[i]);
+    }
+  }
+}
+
+template <typename Abi>
+inline void host_check_complex_all_types() {
+  host_check_complex<Abi, double>();
+  host_check_complex<Abi, float>();
+}
+
+template <typename... Abis>
+inline void host_check_complex_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  (host_check_complex_all_types<Abis>(), ...);
+}
+
+TEST(simd, host_complex) {
+  host_check_complex_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
+#endif
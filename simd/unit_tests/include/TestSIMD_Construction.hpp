@@ -39,6 +39,25 @@ inline void host_test_simd_traits() {
   EXPECT_TRUE(all_of(test_simd == result));
 }
 
+// the lanes are accessed around arithmetic on the whole register, the
+// integer ABIs used to lose them to strict aliasing
+template <typename Abi, typename DataType>
+inline void host_test_simd_lanes() {
+  using simd_type = Kokkos::Experimental::simd<DataType, Abi>;
+
+  simd_type a([](std::size_t i) { return DataType(i % 16 + 1); });
+  simd_type const twice = a + a;
+  for (std::size_t i = 0; i < simd_type::size(); ++i) {
+    EXPECT_EQ(twice[i], DataType(2 * (i % 16 + 1)));
+    a[i] = twice[i];
+  }
+  simd_type const result = a + simd_type(DataType(1));
+  for (std::size_t i = 0; i < simd_type::size(); ++i) {
+    EXPECT_EQ(result[i], DataType(2 * (i % 16 + 1) + 1));
+    EXPECT_EQ(DataType(a[i]), twice[i]);
+  }
+}
+
 template <typename Abi, typename DataType>
 inline void host_test_mask_traits() {
   using mask_type = Kokkos::Experimental::simd_mask<DataType, Abi>;
@@ -62,6 +81,7 @@ template <typename Abi, typename DataType>
 inline void host_check_construction() {
   if constexpr (is_type_v<Kokkos::Experimental::simd<DataType, Abi>>) {
     host_test_simd_traits<Abi, DataType>();
+    host_test_simd_lanes<Abi, DataType>();
     host_test_mask_traits<Abi, DataType>();
   }
 }
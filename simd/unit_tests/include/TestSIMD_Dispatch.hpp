@@ -0,0 +1,115 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_DISPATCH_HPP
+#define KOKKOS_TEST_SIMD_DISPATCH_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+namespace simd_dispatch_test {
+
+using Kokkos::Experimental::simd_isa;
+
+inline int scalar_version() { return 0; }
+inline int avx2_version() { return 1; }
+inline int avx512_version() { return 2; }
+
+// sum of the elements of x, every version of the dispatch test uses the same
+// kernel with the ABI of its instruction set
+template <class Abi>
+double sum(double const* x, int n) {
+  using simd_type = Kokkos::Experimental::simd<double, Abi>;
+  int const width = simd_type::size();
+  simd_type partial(0.0);
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    simd_type v;
+    v.copy_from(x + i, Kokkos::Experimental::simd_flag_default);
+    partial += v;
+  }
+  double lanes[simd_type::size()];
+  partial.copy_to(lanes, Kokkos::Experimental::simd_flag_default);
+  double result = 0.0;
+  for (double lane : lanes) result += lane;
+  for (; i < n; ++i) result += x[i];
+  return result;
+}
+
+template <simd_isa Isa>
+double sum_version(double const* x, int n) {
+  return sum<Kokkos::Experimental::simd_abi::for_isa<Isa>>(x, n);
+}
+
+}  // namespace simd_dispatch_test
+
+TEST(simd, dispatch_host_isa) {
+  using simd_dispatch_test::simd_isa;
+  simd_isa const isa = Kokkos::Experimental::host_simd_isa();
+  // the tests run, so the processor supports the configured architecture
+#if defined(KOKKOS_ARCH_AVX512XEON)
+  EXPECT_EQ(isa, simd_isa::avx512);
+#elif defined(KOKKOS_ARCH_AVX2)
+  EXPECT_TRUE(isa == simd_isa::avx2 || isa == simd_isa::avx512);
+#elif defined(KOKKOS_ARCH_ARM_NEON)
+  EXPECT_EQ(isa, simd_isa::neon);
+#endif
+  EXPECT_EQ(isa, Kokkos::Experimental::host_simd_isa());
+}
+
+TEST(simd, dispatch_select) {
+  using namespace simd_dispatch_test;
+  Kokkos::Experimental::simd_dispatch<int()> dispatch(scalar_version);
+  EXPECT_EQ(dispatch.select(simd_isa::avx512)(), 0);
+  EXPECT_EQ(dispatch(), 0);
+
+  dispatch.add(simd_isa::avx2, avx2_version);
+  EXPECT_EQ(dispatch.select(simd_isa::scalar)(), 0);
+  EXPECT_EQ(dispatch.select(simd_isa::avx2)(), 1);
+  EXPECT_EQ(dispatch.select(simd_isa::avx512)(), 1);
+  EXPECT_EQ(dispatch.select(simd_isa::neon)(), 0);
+
+  dispatch.add(simd_isa::avx512, avx512_version);
+  EXPECT_EQ(dispatch.select(simd_isa::avx2)(), 1);
+  EXPECT_EQ(dispatch.select(simd_isa::avx512)(), 2);
+  EXPECT_EQ(dispatch.selected(),
+            dispatch.select(Kokkos::Experimental::host_simd_isa()));
+  EXPECT_EQ(dispatch(), dispatch.selected()());
+}
+
+TEST(simd, dispatch_kernel) {
+  using namespace simd_dispatch_test;
+  Kokkos::Experimental::simd_dispatch<double(double const*, int)> dispatch(
+      sum_version<simd_isa::scalar>);
+  // the instruction sets of the configured architecture are supported
+#ifdef KOKKOS_SIMD_AVX2_HPP
+  dispatch.add(simd_isa::avx2, sum_version<simd_isa::avx2>);
+#endif
+#ifdef KOKKOS_SIMD_AVX512_HPP
+  dispatch.add(simd_isa::avx512, sum_version<simd_isa::avx512>);
+#endif
+#ifdef KOKKOS_SIMD_NEON_HPP
+  dispatch.add(simd_isa::neon, sum_version<simd_isa::neon>);
+#endif
+
+  double x[37];
+  for (int i = 0; i < 37; ++i) x[i] = i;
+  for (int n = 0; n <= 37; ++n) {
+    EXPECT_EQ(dispatch(x, n), n * (n - 1) / 2.) << "for n = " << n;
+  }
+}
+
+#endif
@@ -0,0 +1,171 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_FIXED_SIZE_HPP
+#define KOKKOS_TEST_SIMD_FIXED_SIZE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+// The lanes of simd<DataType, fixed_size<N>> are spread over several parts,
+// every operation is checked lane by lane against the scalar one so that the
+// lanes of all the parts are covered, including the last ones.
+template <typename DataType, int N>
+inline void host_check_fixed_size() {
+  using abi_type   = Kokkos::Experimental::simd_abi::fixed_size<N>;
+  using simd_type  = Kokkos::Experimental::simd<DataType, abi_type>;
+  using mask_type  = typename simd_type::mask_type;
+  using index_type = Kokkos::Experimental::simd<std::int32_t, abi_type>;
+  using part_abi_type =
+      Kokkos::Experimental::simd_abi::Impl::fixed_size_part_t<DataType, N>;
+  constexpr std::size_t part_size =
+      Kokkos::Experimental::simd<DataType, part_abi_type>::size();
+  static_assert(N % part_size == 0);
+
+  DataType a[N];
+  DataType b[N];
+  for (int i = 0; i < N; ++i) {
+    a[i] = static_cast<DataType>((7 * i) % 23 + 1);
+    b[i] = static_cast<DataType>((5 * i) % 19 + 2);
+  }
+
+  simd_type a_simd;
+  simd_type b_simd;
+  a_simd.copy_from(a, Kokkos::Experimental::simd_flag_default);
+  b_simd.copy_from(b, Kokkos::Experimental::simd_flag_default);
+  simd_type const generated([&](std::size_t i) { return b[i]; });
+  DataType round_trip[N];
+  a_simd.copy_to(round_trip, Kokkos::Experimental::simd_flag_default);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(a_simd[i], a[i]);
+    EXPECT_EQ(round_trip[i], a[i]);
+    EXPECT_EQ(generated[i], b[i]);
+  }
+
+  simd_type const sum        = a_simd + b_simd;
+  simd_type const difference = b_simd - a_simd;
+  simd_type const product    = a_simd * b_simd;
+  simd_type const minimum    = Kokkos::min(a_simd, b_simd);
+  simd_type const maximum    = Kokkos::max(a_simd, b_simd);
+  mask_type const less       = a_simd < b_simd;
+  simd_type const selected =
+      Kokkos::Experimental::condition(less, a_simd, b_simd);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(sum[i], static_cast<DataType>(a[i] + b[i]));
+    EXPECT_EQ(difference[i], static_cast<DataType>(b[i] - a[i]));
+    EXPECT_EQ(product[i], static_cast<DataType>(a[i] * b[i]));
+    EXPECT_EQ(minimum[i], std::min(a[i], b[i]));
+    EXPECT_EQ(maximum[i], std::max(a[i], b[i]));
+    EXPECT_EQ(less[i], a[i] < b[i]);
+    EXPECT_EQ((a_simd == generated)[i], a[i] == b[i]);
+    EXPECT_EQ(selected[i], a[i] < b[i] ? a[i] : b[i]);
+  }
+  if constexpr (std::is_floating_point_v<DataType>) {
+    simd_type const quotient = a_simd / b_simd;
+    for (int i = 0; i < N; ++i) EXPECT_EQ(quotient[i], a[i] / b[i]);
+  }
+
+  // a mask set in a different pattern in every part
+  mask_type const mask([](std::size_t i) { return (i * i + i / 3) % 5 < 2; });
+  DataType expected_sum = 0;
+  DataType expected_min = Kokkos::reduction_identity<DataType>::min();
+  DataType expected_max = Kokkos::reduction_identity<DataType>::max();
+  for (int i = 0; i < N; ++i) {
+    if (mask[i]) {
+      expected_sum += a[i];
+      expected_min = std::min(expected_min, a[i]);
+      expected_max = std::max(expected_max, a[i]);
+    }
+  }
+  EXPECT_EQ(Kokkos::Experimental::reduce(
+                Kokkos::Experimental::where(mask, a_simd), DataType(0),
+                std::plus<>()),
+            expected_sum);
+  EXPECT_EQ(Kokkos::Experimental::hmin(
+                Kokkos::Experimental::where(mask, a_simd)),
+            expected_min);
+  EXPECT_EQ(Kokkos::Experimental::hmax(
+                Kokkos::Experimental::where(mask, a_simd)),
+            expected_max);
+
+  // masked loads and stores, the lanes out of the mask keep their value
+  simd_type loaded(DataType(0));
+  Kokkos::Experimental::where(mask, loaded)
+      .copy_from(a, Kokkos::Experimental::simd_flag_default);
+  DataType stored[N];
+  std::fill(stored, stored + N, DataType(0));
+  Kokkos::Experimental::where(mask, b_simd)
+      .copy_to(stored, Kokkos::Experimental::simd_flag_default);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(loaded[i], mask[i] ? a[i] : DataType(0));
+    EXPECT_EQ(stored[i], mask[i] ? b[i] : DataType(0));
+  }
+
+  // the indices cross the parts: lane i reads and writes element N - 1 - i
+  index_type const index(
+      [](std::size_t i) { return std::int32_t(N - 1 - int(i)); });
+  simd_type gathered(DataType(0));
+  Kokkos::Experimental::where(mask, gathered).gather_from(a, index);
+  DataType scattered[N];
+  std::fill(scattered, scattered + N, DataType(0));
+  Kokkos::Experimental::where(mask, b_simd).scatter_to(scattered, index);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_EQ(gathered[i], mask[i] ? a[N - 1 - i] : DataType(0));
+    EXPECT_EQ(scattered[N - 1 - i], mask[i] ? b[i] : DataType(0));
+  }
+}
+
+template <int N, typename... DataTypes>
+inline void host_check_fixed_size_all_types(
+    Kokkos::Experimental::Impl::data_types<DataTypes...>) {
+  (host_check_fixed_size<DataTypes, N>(), ...);
+}
+
+// The parts are the widest native ABI with a width dividing N, the scalar ABI
+// when there is none
+template <int N>
+inline void host_check_fixed_size_part() {
+  using namespace Kokkos::Experimental::simd_abi;
+  using native_type = Kokkos::Experimental::simd<double, Impl::host_native>;
+  using expected_type =
+      std::conditional_t<N % native_type::size() == 0, Impl::host_native,
+                         scalar>;
+  EXPECT_TRUE((std::is_same_v<Impl::fixed_size_part_t<double, N>,
+                              expected_type>));
+}
+
+TEST(simd, host_fixed_size) {
+  using DataTypes = Kokkos::Experimental::Impl::data_type_set;
+  // several registers of every native ABI
+  host_check_fixed_size_all_types<32>(DataTypes());
+  host_check_fixed_size_all_types<64>(DataTypes());
+  // widths the native ABIs of some types do not divide
+  host_check_fixed_size_all_types<12>(DataTypes());
+  host_check_fixed_size_all_types<5>(DataTypes());
+
+  host_check_fixed_size_part<64>();
+  host_check_fixed_size_part<12>();
+  host_check_fixed_size_part<6>();
+  host_check_fixed_size_part<5>();
+  host_check_fixed_size_part<1>();
+}
+
+#endif
@@ -0,0 +1,167 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_MDRANGE_HPP
+#define KOKKOS_TEST_SIMD_MDRANGE_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+struct SimdMDRangeTag {};
+
+template <typename Simd, typename ViewType>
+struct SimdMDRangeAxpy {
+  using simd_type  = Simd;
+  using value_type = typename Simd::value_type;
+  using index_type =
+      Kokkos::Experimental::simd_index<value_type, typename Simd::abi_type>;
+
+  ViewType m_x;
+  ViewType m_y;
+  ViewType m_hits;
+
+  // y(i, k) = 2 * x(i, k) + y(i, k) over one chunk of the contiguous dimension
+  void operator()(std::int64_t i, index_type k) const {
+    simd_type x;
+    simd_type y;
+    if (k.is_full()) {
+      x.copy_from(&m_x(i, k.first()), Kokkos::Experimental::simd_flag_default);
+      y.copy_from(&m_y(i, k.first()), Kokkos::Experimental::simd_flag_default);
+      y = simd_type(2) * x + y;
+      y.copy_to(&m_y(i, k.first()), Kokkos::Experimental::simd_flag_default);
+    } else {
+      x = simd_type(0);
+      y = simd_type(0);
+      where(k.mask(), x)
+          .copy_from(&m_x(i, k.first()),
+                     Kokkos::Experimental::simd_flag_default);
+      where(k.mask(), y)
+          .copy_from(&m_y(i, k.first()),
+                     Kokkos::Experimental::simd_flag_default);
+      y = simd_type(2) * x + y;
+      where(k.mask(), y)
+          .copy_to(&m_y(i, k.first()), Kokkos::Experimental::simd_flag_default);
+    }
+    for (std::int64_t lane = 0; lane < k.count(); ++lane) {
+      m_hits(i, k.first() + lane) += 1;
+    }
+  }
+
+  // the same for the transposed layout, the contiguous dimension comes first
+  void operator()(index_type k, std::int64_t i) const {
+    for (std::int64_t lane = 0; lane < k.count(); ++lane) {
+      m_y(k.first() + lane, i) += 2 * m_x(k.first() + lane, i);
+      m_hits(k.first() + lane, i) += 1;
+    }
+  }
+
+  void operator()(SimdMDRangeTag, std::int64_t i, index_type k) const {
+    (*this)(i, k);
+  }
+};
+
+template <typename Simd, typename Layout, Kokkos::Iterate Direction,
+          typename... Tag>
+inline void host_check_simd_mdrange(int n0, int n1, int lower, int tile) {
+  using value_type = typename Simd::value_type;
+  using view_type  = Kokkos::View<value_type**, Layout, Kokkos::HostSpace>;
+  using policy_type =
+      Kokkos::MDRangePolicy<Kokkos::DefaultHostExecutionSpace,
+                            Kokkos::Rank<2, Direction, Direction>, Tag...>;
+
+  view_type x("x", n0, n1);
+  view_type y("y", n0, n1);
+  view_type hits("hits", n0, n1);
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      x(i, j) = static_cast<value_type>(i + j);
+      y(i, j) = static_cast<value_type>(1);
+    }
+  }
+
+  Kokkos::Experimental::parallel_for_simd<Simd>(
+      "simd_mdrange", policy_type({lower, lower}, {n0, n1}, {tile, tile}),
+      SimdMDRangeAxpy<Simd, view_type>{x, y, hits});
+  Kokkos::fence();
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      bool const inside = i >= lower && j >= lower;
+      ASSERT_EQ(hits(i, j), inside ? 1 : 0) << "at (" << i << ", " << j << ")";
+      ASSERT_EQ(y(i, j), inside ? static_cast<value_type>(2 * (i + j) + 1)
+                                : static_cast<value_type>(1))
+          << "at (" << i << ", " << j << ")";
+    }
+  }
+}
+
+template <typename Abi, typename DataType>
+inline void host_check_simd_mdrange() {
+  if constexpr (is_type_v<Kokkos::Experimental::simd<DataType, Abi>> &&
+                std::is_floating_point_v<DataType>) {
+    using simd_type = Kokkos::Experimental::simd<DataType, Abi>;
+    int const width = simd_type::size();
+
+    // full chunks only, then a masked remainder of every possible length
+    for (int extra = 0; extra < width; ++extra) {
+      int const n1 = 3 * width + extra;
+      host_check_simd_mdrange<simd_type, Kokkos::LayoutRight,
+                              Kokkos::Iterate::Right>(5, n1, 0, 0);
+      host_check_simd_mdrange<simd_type, Kokkos::LayoutRight,
+                              Kokkos::Iterate::Right>(5, n1, 1, 2 * width);
+      host_check_simd_mdrange<simd_type, Kokkos::LayoutRight,
+                              Kokkos::Iterate::Right, SimdMDRangeTag>(
+          4, n1, 0, width + 1);
+      host_check_simd_mdrange<simd_type, Kokkos::LayoutLeft,
+                              Kokkos::Iterate::Left>(n1, 5, 1, 0);
+    }
+  }
+}
+
+template <typename Abi, typename... DataTypes>
+inline void host_check_simd_mdrange_all_types(
+    Kokkos::Experimental::Impl::data_types<DataTypes...>) {
+  (host_check_simd_mdrange<Abi, DataTypes>(), ...);
+}
+
+template <typename... Abis>
+inline void host_check_simd_mdrange_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  using DataTypes = Kokkos::Experimental::Impl::data_type_set;
+  (host_check_simd_mdrange_all_types<Abis>(DataTypes()), ...);
+}
+
+TEST(simd, host_mdrange) {
+  host_check_simd_mdrange_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
+TEST(simd, simd_index) {
+  using simd_index_type = Kokkos::Experimental::simd_index<double>;
+  constexpr auto width  = static_cast<std::int64_t>(simd_index_type::size());
+
+  simd_index_type const full(8, width);
+  ASSERT_TRUE(full.is_full());
+  ASSERT_EQ(full.first(), 8);
+  ASSERT_TRUE(all_of(full.mask()));
+
+  simd_index_type const partial(8, width - 1);
+  ASSERT_FALSE(partial.is_full());
+  for (std::int64_t lane = 0; lane < width; ++lane) {
+    ASSERT_EQ(partial.mask()[lane], lane < width - 1);
+  }
+}
+
+#endif
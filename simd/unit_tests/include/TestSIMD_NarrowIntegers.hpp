@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_NARROW_INTEGERS_HPP
+#define KOKKOS_TEST_SIMD_NARROW_INTEGERS_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+template <typename Abi, typename DataType, typename AccumulatorAbi>
+inline void host_check_narrow_integers() {
+  if constexpr (is_type_v<Kokkos::Experimental::simd<DataType, Abi>>) {
+    using simd_type        = Kokkos::Experimental::simd<DataType, Abi>;
+    using mask_type        = typename simd_type::mask_type;
+    using accumulator_type = Kokkos::Experimental::simd<std::int32_t,
+                                                        AccumulatorAbi>;
+    constexpr std::size_t width = simd_type::size();
+    constexpr int group         = width / accumulator_type::size();
+    constexpr int lowest        = std::numeric_limits<DataType>::min();
+    constexpr int highest       = std::numeric_limits<DataType>::max();
+    auto const wrap  = [](int value) { return static_cast<DataType>(value); };
+    auto const clamp = [=](int value) {
+      return static_cast<DataType>(std::clamp(value, lowest, highest));
+    };
+
+    // both ends of the range, the sums and differences saturate
+    DataType a[width];
+    DataType b[width];
+    for (std::size_t i = 0; i < width; ++i) {
+      int const k = i;
+      a[i]        = wrap(k % 2 ? highest - 3 * k : lowest + 5 * k);
+      b[i]        = wrap(k % 3 ? 7 * k - 20 : highest - k);
+    }
+
+    simd_type a_simd;
+    simd_type b_simd;
+    a_simd.copy_from(a, Kokkos::Experimental::simd_flag_default);
+    b_simd.copy_from(b, Kokkos::Experimental::simd_flag_default);
+    DataType round_trip[width];
+    a_simd.copy_to(round_trip, Kokkos::Experimental::simd_flag_default);
+    simd_type const generated([&](std::size_t i) { return b[i]; });
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(round_trip[i], a[i]);
+      EXPECT_EQ(a_simd[i], a[i]);
+      EXPECT_EQ(generated[i], b[i]);
+    }
+
+    simd_type const sum        = a_simd + b_simd;
+    simd_type const difference = a_simd - b_simd;
+    simd_type const product    = a_simd * b_simd;
+    simd_type const negation   = -a_simd;
+    simd_type const minimum    = Kokkos::min(a_simd, b_simd);
+    simd_type const maximum    = Kokkos::max(a_simd, b_simd);
+    simd_type const magnitude  = Kokkos::abs(a_simd);
+    simd_type const saturated_sum =
+        Kokkos::Experimental::add_sat(a_simd, b_simd);
+    simd_type const saturated_difference =
+        Kokkos::Experimental::sub_sat(a_simd, b_simd);
+    mask_type const less = a_simd < b_simd;
+    simd_type const selected =
+        Kokkos::Experimental::condition(less, a_simd, b_simd);
+    for (std::size_t i = 0; i < width; ++i) {
+      int const x = a[i];
+      int const y = b[i];
+      EXPECT_EQ(sum[i], wrap(x + y));
+      EXPECT_EQ(difference[i], wrap(x - y));
+      EXPECT_EQ(product[i], wrap(x * y));
+      EXPECT_EQ(negation[i], wrap(-x));
+      EXPECT_EQ(minimum[i], std::min(a[i], b[i]));
+      EXPECT_EQ(maximum[i], std::max(a[i], b[i]));
+      EXPECT_EQ(magnitude[i], wrap(x < 0 ? -x : x));
+      EXPECT_EQ(saturated_sum[i], clamp(x + y));
+      EXPECT_EQ(saturated_difference[i], clamp(x - y));
+      EXPECT_EQ(less[i], x < y);
+      EXPECT_EQ((a_simd > b_simd)[i], x > y);
+      EXPECT_EQ((a_simd <= b_simd)[i], x <= y);
+      EXPECT_EQ((a_simd >= b_simd)[i], x >= y);
+      EXPECT_EQ((a_simd == generated)[i], x == y);
+      EXPECT_EQ((a_simd != generated)[i], x != y);
+      EXPECT_EQ(selected[i], x < y ? a[i] : b[i]);
+    }
+    if constexpr (sizeof(DataType) == 2) {
+      simd_type const shifted_right = a_simd >> 3;
+      simd_type const shifted_left  = a_simd << 3;
+      for (std::size_t i = 0; i < width; ++i) {
+        EXPECT_EQ(shifted_right[i], wrap(a[i] >> 3));
+        EXPECT_EQ(shifted_left[i], wrap(a[i] * 8));
+      }
+    }
+
+    mask_type mask([](std::size_t i) { return i % 3 == 0; });
+    mask[1] = true;
+    mask[0] = false;
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(mask[i], i == 1 || (i != 0 && i % 3 == 0));
+      EXPECT_EQ((!mask)[i], !mask[i]);
+      EXPECT_EQ((mask && less)[i], mask[i] && less[i]);
+      EXPECT_EQ((mask || less)[i], mask[i] || less[i]);
+    }
+    EXPECT_TRUE(((a_simd < b_simd) || (a_simd == b_simd)) ==
+                (a_simd <= b_simd));
+    EXPECT_TRUE(all_of(mask_type(true)));
+    EXPECT_TRUE(none_of(mask_type(false)));
+
+    accumulator_type const accumulator(
+        [](std::size_t i) { return std::int32_t(1000 * i) - 7; });
+    accumulator_type const accumulated =
+        Kokkos::Experimental::widening_madd(a_simd, b_simd, accumulator);
+    for (std::size_t i = 0; i < accumulator_type::size(); ++i) {
+      std::int32_t expected = accumulator[i];
+      for (int j = 0; j < group; ++j) {
+        expected += std::int32_t(a[i * group + j]) * b[i * group + j];
+      }
+      EXPECT_EQ(accumulated[i], expected);
+    }
+    std::int32_t expected_sum = 0;
+    for (std::size_t i = 0; i < width; ++i) expected_sum += a[i];
+    EXPECT_EQ(Kokkos::Experimental::widening_sum(a_simd), expected_sum);
+    EXPECT_EQ(Kokkos::Experimental::widening_sum(simd_type(lowest)),
+              int(width) * lowest);
+    EXPECT_EQ(Kokkos::Experimental::widening_sum(simd_type(highest)),
+              int(width) * highest);
+  }
+}
+
+// the 8-bit integers are in ByteAbi and the 16-bit ones in ShortAbi, both
+// accumulate into AccumulatorAbi
+template <typename ByteAbi, typename ShortAbi, typename AccumulatorAbi>
+inline void host_check_narrow_integers_all_types() {
+  host_check_narrow_integers<ByteAbi, std::int8_t, AccumulatorAbi>();
+  host_check_narrow_integers<ByteAbi, std::uint8_t, AccumulatorAbi>();
+  host_check_narrow_integers<ShortAbi, std::int16_t, AccumulatorAbi>();
+}
+
+TEST(simd, host_narrow_integers) {
+  using namespace Kokkos::Experimental::simd_abi;
+  host_check_narrow_integers_all_types<scalar, scalar, scalar>();
+  host_check_narrow_integers_all_types<fixed_size<32>, fixed_size<16>,
+                                       fixed_size<8>>();
+#ifdef KOKKOS_SIMD_AVX2_HPP
+  host_check_narrow_integers_all_types<avx2_fixed_size<32>,
+                                       avx2_fixed_size<16>,
+                                       avx2_fixed_size<8>>();
+#endif
+#ifdef KOKKOS_SIMD_AVX512_HPP
+  host_check_narrow_integers_all_types<avx512_fixed_size<64>,
+                                       avx512_fixed_size<32>,
+                                       avx512_fixed_size<16>>();
+#endif
+#ifdef KOKKOS_SIMD_NEON_HPP
+  host_check_narrow_integers_all_types<neon_fixed_size<16>,
+                                       neon_fixed_size<8>,
+                                       neon_fixed_size<4>>();
+#endif
+}
+
+#endif